@@ -1,4 +1,7 @@
-find_package(CUDAToolkit REQUIRED)
+# Host-only benchmarks are built without CUDA.
+if (NOT CCCL_BENCHMARK_HOST_ONLY)
+  find_package(CUDAToolkit REQUIRED)
+endif()
 
 set(cccl_revision "")
 find_package(Git)
@@ -35,7 +38,12 @@ endfunction()
 function(create_benchmark_registry)
   get_meta_path(meta_path)
 
-  set(ctk_version "${CUDAToolkit_VERSION}")
+  if (CCCL_BENCHMARK_HOST_ONLY)
+    # There is no CTK, so the host compiler identifies the build instead.
+    set(ctk_version "${CMAKE_CXX_COMPILER_ID}-${CMAKE_CXX_COMPILER_VERSION}")
+  else()
+    set(ctk_version "${CUDAToolkit_VERSION}")
+  endif()
   message(STATUS "CTK version: ${ctk_version}")
 
   file(REMOVE "${meta_path}")
@@ -0,0 +1,36 @@
+# Host benchmarks time host code with the host-only stand-in for NVBench of nvbench_helper
+# (see cub/benchmarks/nvbench_helper/nvbench_helper/host_nvbench.cuh). They need neither NVBench nor a GPU, and write
+# their results in NVBench's JSON layout, so that run.py and compare.py work on them as well.
+
+# Builds the stand-in once, and stores the name of its target in `target_name_var`.
+function(cccl_get_host_nvbench target_name_var)
+  set(target_name cccl.host_nvbench)
+  set(${target_name_var} ${target_name} PARENT_SCOPE)
+
+  if (TARGET ${target_name})
+    return()
+  endif()
+
+  set(nvbench_helper_dir "${CMAKE_SOURCE_DIR}/cub/benchmarks/nvbench_helper/nvbench_helper")
+
+  # host_nvbench.cu is plain C++, wrap it so that it is built by the host compiler:
+  set(host_nvbench_src "${CMAKE_BINARY_DIR}/benchmarks/host_nvbench.cpp")
+  file(CONFIGURE OUTPUT "${host_nvbench_src}" CONTENT "#include <${nvbench_helper_dir}/host_nvbench.cu>\n")
+
+  add_library(${target_name} STATIC "${host_nvbench_src}")
+  cccl_configure_target(${target_name} DIALECT 17)
+  target_include_directories(${target_name} PUBLIC
+    "${nvbench_helper_dir}"
+    "${CMAKE_SOURCE_DIR}/c2h/include"
+    "${CMAKE_SOURCE_DIR}/libcudacxx/include"
+  )
+endfunction()
+
+# Adds the host benchmark `target_name` built from `bench_src`.
+function(cccl_add_host_benchmark target_name bench_src)
+  cccl_get_host_nvbench(host_nvbench_target)
+
+  add_executable(${target_name} "${bench_src}")
+  cccl_configure_target(${target_name} DIALECT 17)
+  target_link_libraries(${target_name} PRIVATE ${host_nvbench_target})
+endfunction()
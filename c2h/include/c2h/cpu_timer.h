@@ -82,6 +82,12 @@ public:
     return static_cast<std::uint64_t>(us.count());
   }
 
+  double elapsed_seconds() const
+  {
+    auto duration = std::chrono::high_resolution_clock::now() - m_start;
+    return std::chrono::duration<double>(duration).count();
+  }
+
   void print_elapsed_seconds(const std::string& label)
   {
     printf("%0.6f s: %s\n", this->elapsed_us() / 1000000.f, label.c_str());
@@ -0,0 +1,1259 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#include <host_nvbench.cuh>
+
+namespace nvbench
+{
+
+std::vector<int64_t> range(int64_t start, int64_t end, int64_t stride)
+{
+  std::vector<int64_t> result;
+  for (int64_t value = start; value <= end; value += stride)
+  {
+    result.push_back(value);
+  }
+  return result;
+}
+
+namespace
+{
+
+template <typename T>
+const T& find_axis_value(const std::map<std::string, T>& values, const std::string& axis_name)
+{
+  auto it = values.find(axis_name);
+  if (it == values.end())
+  {
+    throw std::runtime_error("no axis named '" + axis_name + "'");
+  }
+  return it->second;
+}
+
+template <typename T>
+const T& find_axis_value_or(const std::map<std::string, T>& values, const std::string& axis_name, const T& value)
+{
+  auto it = values.find(axis_name);
+  return it == values.end() ? value : it->second;
+}
+
+} // namespace
+
+int64_t state::get_int64(const std::string& axis_name) const
+{
+  return find_axis_value(m_int64s, axis_name);
+}
+
+int64_t state::get_int64_or_default(const std::string& axis_name, int64_t default_value) const
+{
+  return find_axis_value_or(m_int64s, axis_name, default_value);
+}
+
+float64_t state::get_float64(const std::string& axis_name) const
+{
+  return find_axis_value(m_float64s, axis_name);
+}
+
+float64_t state::get_float64_or_default(const std::string& axis_name, float64_t default_value) const
+{
+  return find_axis_value_or(m_float64s, axis_name, default_value);
+}
+
+const std::string& state::get_string(const std::string& axis_name) const
+{
+  return find_axis_value(m_strings, axis_name);
+}
+
+const std::string&
+state::get_string_or_default(const std::string& axis_name, const std::string& default_value) const
+{
+  return find_axis_value_or(m_strings, axis_name, default_value);
+}
+
+void state::add_element_count(std::size_t elements, std::string)
+{
+  m_element_count += elements;
+}
+
+void state::skip(std::string reason)
+{
+  m_skipped     = true;
+  m_skip_reason = std::move(reason);
+}
+
+namespace
+{
+
+double mean(const std::vector<double>& samples)
+{
+  double sum = 0.0;
+  for (double sample : samples)
+  {
+    sum += sample;
+  }
+  return sum / static_cast<double>(samples.size());
+}
+
+// relative standard deviation of the samples, in percent
+double noise(const std::vector<double>& samples)
+{
+  if (samples.size() < 2)
+  {
+    return INFINITY;
+  }
+
+  const double m = mean(samples);
+  double sum     = 0.0;
+  for (double sample : samples)
+  {
+    sum += (sample - m) * (sample - m);
+  }
+  return std::sqrt(sum / static_cast<double>(samples.size() - 1)) / m * 100.0;
+}
+
+} // namespace
+
+bool state::keep_sampling(double total_seconds) const
+{
+  if (total_seconds >= m_timeout)
+  {
+    return false;
+  }
+  if (m_samples.size() < m_min_samples || total_seconds < m_min_time)
+  {
+    return true;
+  }
+  return noise(m_samples) > m_max_noise;
+}
+
+benchmark_base& benchmark_base::set_name(std::string name)
+{
+  m_name = std::move(name);
+  return *this;
+}
+
+benchmark_base& benchmark_base::set_type_axes_names(std::vector<std::string> names)
+{
+  if (names.size() != m_type_axes)
+  {
+    throw std::runtime_error("benchmark '" + m_name + "' has " + std::to_string(m_type_axes) + " type axes");
+  }
+  for (std::size_t i = 0; i < names.size(); ++i)
+  {
+    m_axes[i].name = std::move(names[i]);
+  }
+  return *this;
+}
+
+benchmark_base& benchmark_base::add_int64_axis(std::string name, std::vector<int64_t> values)
+{
+  detail::axis a{};
+  a.name   = std::move(name);
+  a.type   = detail::axis_type::int64;
+  a.int64s = std::move(values);
+  for (int64_t value : a.int64s)
+  {
+    a.input_strings.push_back(std::to_string(value));
+    a.descriptions.push_back("");
+  }
+  m_axes.push_back(std::move(a));
+  return *this;
+}
+
+benchmark_base& benchmark_base::add_int64_power_of_two_axis(std::string name, std::vector<int64_t> exponents)
+{
+  detail::axis a{};
+  a.name  = std::move(name);
+  a.flags = "pow2";
+  a.type  = detail::axis_type::int64;
+  for (int64_t exponent : exponents)
+  {
+    const int64_t value = int64_t{1} << exponent;
+    a.int64s.push_back(value);
+    a.input_strings.push_back(std::to_string(exponent));
+    a.descriptions.push_back("2^" + std::to_string(exponent) + " = " + std::to_string(value));
+  }
+  m_axes.push_back(std::move(a));
+  return *this;
+}
+
+benchmark_base& benchmark_base::add_float64_axis(std::string name, std::vector<float64_t> values)
+{
+  detail::axis a{};
+  a.name     = std::move(name);
+  a.type     = detail::axis_type::float64;
+  a.float64s = std::move(values);
+  for (float64_t value : a.float64s)
+  {
+    std::ostringstream input_string;
+    input_string << value;
+    a.input_strings.push_back(input_string.str());
+    a.descriptions.push_back("");
+  }
+  m_axes.push_back(std::move(a));
+  return *this;
+}
+
+benchmark_base& benchmark_base::add_string_axis(std::string name, std::vector<std::string> values)
+{
+  detail::axis a{};
+  a.name          = std::move(name);
+  a.type          = detail::axis_type::string;
+  a.input_strings = std::move(values);
+  a.descriptions.resize(a.input_strings.size());
+  m_axes.push_back(std::move(a));
+  return *this;
+}
+
+namespace
+{
+
+std::vector<std::unique_ptr<benchmark_base>>& benchmarks()
+{
+  static std::vector<std::unique_ptr<benchmark_base>> registry;
+  return registry;
+}
+
+} // namespace
+
+benchmark_base& add_benchmark(std::unique_ptr<benchmark_base> bench)
+{
+  benchmarks().push_back(std::move(bench));
+  return *benchmarks().back();
+}
+
+benchmark_base& register_benchmark(std::string name, void (*run)(state&))
+{
+  auto bench     = std::make_unique<benchmark_base>();
+  bench->m_name  = std::move(name);
+  bench->m_type_configs.push_back(run);
+  return add_benchmark(std::move(bench));
+}
+
+namespace detail
+{
+
+// Writes JSON in the layout NVBench uses, as far as the benchmark scripts read it.
+class json_writer
+{
+  std::ostream& m_os;
+  std::vector<bool> m_first;
+
+  void separate()
+  {
+    if (!m_first.empty())
+    {
+      if (!m_first.back())
+      {
+        m_os << ',';
+      }
+      m_first.back() = false;
+    }
+  }
+
+public:
+  explicit json_writer(std::ostream& os)
+      : m_os(os)
+  {}
+
+  json_writer& key(const std::string& k)
+  {
+    separate();
+    string_literal(k);
+    m_os << ':';
+    // the value that follows must not be separated again
+    m_first.push_back(true);
+    m_pending_value = true;
+    return *this;
+  }
+
+  void begin_object()
+  {
+    value_prefix();
+    m_os << '{';
+    m_first.push_back(true);
+  }
+
+  void end_object()
+  {
+    m_first.pop_back();
+    m_os << '}';
+  }
+
+  void begin_array()
+  {
+    value_prefix();
+    m_os << '[';
+    m_first.push_back(true);
+  }
+
+  void end_array()
+  {
+    m_first.pop_back();
+    m_os << ']';
+  }
+
+  void value(const std::string& v)
+  {
+    value_prefix();
+    string_literal(v);
+  }
+
+  void value(const char* v)
+  {
+    value(std::string(v));
+  }
+
+  void value(int64_t v)
+  {
+    value_prefix();
+    m_os << v;
+  }
+
+  void value(double v)
+  {
+    value_prefix();
+    if (std::isfinite(v))
+    {
+      char buffer[32];
+      std::snprintf(buffer, sizeof(buffer), "%.17g", v);
+      m_os << buffer;
+    }
+    else
+    {
+      m_os << "null";
+    }
+  }
+
+  void value(bool v)
+  {
+    value_prefix();
+    m_os << (v ? "true" : "false");
+  }
+
+  template <typename T>
+  void member(const std::string& k, const T& v)
+  {
+    key(k);
+    value(v);
+  }
+
+private:
+  bool m_pending_value{false};
+
+  void value_prefix()
+  {
+    if (m_pending_value)
+    {
+      m_first.pop_back();
+      m_pending_value = false;
+    }
+    else
+    {
+      separate();
+    }
+  }
+
+  void string_literal(const std::string& s)
+  {
+    m_os << '"';
+    for (char c : s)
+    {
+      switch (c)
+      {
+        case '"':
+          m_os << "\\\"";
+          break;
+        case '\\':
+          m_os << "\\\\";
+          break;
+        case '\n':
+          m_os << "\\n";
+          break;
+        case '\t':
+          m_os << "\\t";
+          break;
+        default:
+          if (static_cast<unsigned char>(c) < 0x20)
+          {
+            char buffer[8];
+            std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+            m_os << buffer;
+          }
+          else
+          {
+            m_os << c;
+          }
+      }
+    }
+    m_os << '"';
+  }
+};
+
+struct axis_override
+{
+  std::string name;
+  std::string flags;
+  std::vector<std::string> values;
+};
+
+struct benchmark_selection
+{
+  benchmark_base* bench;
+  std::vector<axis_override> overrides;
+};
+
+struct summary_value
+{
+  std::string name;
+  std::string type;
+  std::string string_value;
+  int64_t int64_value;
+  double float64_value;
+};
+
+struct summary
+{
+  std::string tag;
+  std::string name;
+  std::string hint;
+  std::vector<summary_value> data;
+};
+
+class runner
+{
+public:
+  int main(int argc, char** argv);
+
+private:
+  std::size_t m_min_samples{10};
+  double m_min_time{0.5};
+  double m_max_noise{0.5};
+  double m_timeout{15.0};
+
+  std::string m_json_path;
+  bool m_json_bin{false};
+  std::size_t m_next_bin{0};
+
+  std::vector<std::string> m_argv;
+  std::ofstream m_md_file;
+
+  static void print_usage();
+  static std::vector<std::string> parse_values(const std::string& spec);
+  static axis_override parse_override(const std::string& spec);
+  static benchmark_base* find_benchmark(const std::string& name_or_index);
+  static void apply_override(const benchmark_base& bench, std::vector<axis>& axes, const axis_override& o);
+
+  static void write_device(json_writer& json);
+  static void write_axes(json_writer& json, const std::vector<axis>& axes);
+  static void write_summary(json_writer& json, const summary& s);
+
+  void print_markdown(std::ostringstream& md);
+  void run_benchmark(json_writer* json, std::size_t index, const benchmark_selection& selection);
+  std::vector<summary> summarize(const state& s);
+};
+
+void runner::print_usage()
+{
+  std::cout << "usage: <benchmark> [-b <name or index>] [-a <axis>=<values>] [--json <path>] [--jsonbin <path>]\n"
+               "                   [--md <path>] [--jsonlist-benches] [--jsonlist-devices] [--min-samples <n>]\n"
+               "                   [--min-time <seconds>] [--max-noise <percent>] [--timeout <seconds>]\n";
+}
+
+std::vector<std::string> runner::parse_values(const std::string& spec)
+{
+  if (spec.empty() || spec.front() != '[')
+  {
+    return {spec};
+  }
+  if (spec.back() != ']')
+  {
+    throw std::runtime_error("unterminated value list '" + spec + "'");
+  }
+
+  const std::string inner = spec.substr(1, spec.size() - 2);
+
+  // [start:end] or [start:end:stride]
+  if (inner.find(':') != std::string::npos && inner.find(',') == std::string::npos)
+  {
+    std::vector<int64_t> bounds;
+    std::istringstream is(inner);
+    std::string bound;
+    while (std::getline(is, bound, ':'))
+    {
+      bounds.push_back(std::stoll(bound));
+    }
+    if (bounds.size() < 2 || bounds.size() > 3)
+    {
+      throw std::runtime_error("invalid range '" + spec + "'");
+    }
+
+    std::vector<std::string> result;
+    for (int64_t value : range(bounds[0], bounds[1], bounds.size() == 3 ? bounds[2] : 1))
+    {
+      result.push_back(std::to_string(value));
+    }
+    return result;
+  }
+
+  std::vector<std::string> result;
+  std::istringstream is(inner);
+  std::string value;
+  while (std::getline(is, value, ','))
+  {
+    result.push_back(value);
+  }
+  return result;
+}
+
+axis_override runner::parse_override(const std::string& spec)
+{
+  const std::size_t equals = spec.find('=');
+  if (equals == std::string::npos)
+  {
+    throw std::runtime_error("invalid axis '" + spec + "', expected <name>=<values>");
+  }
+
+  axis_override result;
+  result.name                = spec.substr(0, equals);
+  const std::size_t brackets = result.name.find('[');
+  if (brackets != std::string::npos && result.name.back() == ']')
+  {
+    result.flags = result.name.substr(brackets + 1, result.name.size() - brackets - 2);
+    result.name  = result.name.substr(0, brackets);
+  }
+  result.values = parse_values(spec.substr(equals + 1));
+  return result;
+}
+
+benchmark_base* runner::find_benchmark(const std::string& name_or_index)
+{
+  for (auto& bench : benchmarks())
+  {
+    if (bench->m_name == name_or_index)
+    {
+      return bench.get();
+    }
+  }
+
+  if (!name_or_index.empty() && std::all_of(name_or_index.begin(), name_or_index.end(), ::isdigit))
+  {
+    const std::size_t index = std::stoull(name_or_index);
+    if (index < benchmarks().size())
+    {
+      return benchmarks()[index].get();
+    }
+  }
+
+  throw std::runtime_error("no benchmark named '" + name_or_index + "'");
+}
+
+void runner::apply_override(const benchmark_base& bench, std::vector<axis>& axes, const axis_override& o)
+{
+  auto it = std::find_if(axes.begin(), axes.end(), [&](const axis& a) {
+    return a.name == o.name;
+  });
+  if (it == axes.end())
+  {
+    throw std::runtime_error("benchmark '" + bench.m_name + "' has no axis named '" + o.name + "'");
+  }
+
+  axis& a = *it;
+  if (!o.flags.empty() && o.flags != a.flags)
+  {
+    throw std::runtime_error("axis '" + o.name + "' does not take the flags '" + o.flags + "'");
+  }
+
+  axis result{};
+  result.name  = a.name;
+  result.flags = o.flags;
+  result.type  = a.type;
+
+  for (const std::string& input : o.values)
+  {
+    switch (a.type)
+    {
+      case axis_type::type: {
+        auto type = std::find(a.input_strings.begin(), a.input_strings.end(), input);
+        if (type == a.input_strings.end())
+        {
+          throw std::runtime_error("axis '" + a.name + "' has no type '" + input + "'");
+        }
+        result.input_strings.push_back(input);
+        result.descriptions.push_back(a.descriptions[type - a.input_strings.begin()]);
+        break;
+      }
+      case axis_type::int64: {
+        const int64_t number = std::stoll(input);
+        if (o.flags == "pow2")
+        {
+          result.int64s.push_back(int64_t{1} << number);
+          result.descriptions.push_back("2^" + input + " = " + std::to_string(int64_t{1} << number));
+        }
+        else
+        {
+          result.int64s.push_back(number);
+          result.descriptions.push_back("");
+        }
+        result.input_strings.push_back(input);
+        break;
+      }
+      case axis_type::float64:
+        result.float64s.push_back(std::stod(input));
+        result.input_strings.push_back(input);
+        result.descriptions.push_back("");
+        break;
+      case axis_type::string:
+        result.input_strings.push_back(input);
+        result.descriptions.push_back("");
+        break;
+    }
+  }
+
+  a = std::move(result);
+}
+
+void runner::write_device(json_writer& json)
+{
+  std::string name = "Host";
+#if defined(__linux__)
+  std::ifstream cpuinfo("/proc/cpuinfo");
+  std::string line;
+  while (std::getline(cpuinfo, line))
+  {
+    if (line.rfind("model name", 0) == 0)
+    {
+      const std::size_t colon = line.find(':');
+      if (colon != std::string::npos && colon + 2 <= line.size())
+      {
+        name = line.substr(colon + 2);
+      }
+      break;
+    }
+  }
+#endif
+
+  json.begin_object();
+  json.member("id", int64_t{0});
+  json.member("name", name);
+  json.member("sm_version", int64_t{0});
+  json.member("ptx_version", int64_t{0});
+  json.member("number_of_sms", static_cast<int64_t>(std::thread::hardware_concurrency()));
+  json.member("global_memory_bus_width", int64_t{0});
+  json.member("ecc_state", false);
+  json.end_object();
+}
+
+void runner::write_axes(json_writer& json, const std::vector<axis>& axes)
+{
+  json.key("axes");
+  json.begin_array();
+  for (const axis& a : axes)
+  {
+    json.begin_object();
+    json.member("name", a.name);
+    json.member("type",
+                a.type == axis_type::type    ? "type"
+                : a.type == axis_type::int64 ? "int64"
+                : a.type == axis_type::float64
+                  ? "float64"
+                  : "string");
+    json.member("flags", a.flags);
+    json.key("values");
+    json.begin_array();
+    for (std::size_t i = 0; i < a.input_strings.size(); ++i)
+    {
+      json.begin_object();
+      json.member("input_string", a.input_strings[i]);
+      json.member("description", a.descriptions[i]);
+      switch (a.type)
+      {
+        case axis_type::type:
+          break;
+        case axis_type::int64:
+          json.member("value", a.int64s[i]);
+          break;
+        case axis_type::float64:
+          json.member("value", a.float64s[i]);
+          break;
+        case axis_type::string:
+          json.member("value", a.input_strings[i]);
+          break;
+      }
+      json.end_object();
+    }
+    json.end_array();
+    json.end_object();
+  }
+  json.end_array();
+}
+
+void runner::write_summary(json_writer& json, const summary& s)
+{
+  json.begin_object();
+  json.member("tag", s.tag);
+  json.member("name", s.name);
+  json.member("hint", s.hint);
+  json.key("data");
+  json.begin_array();
+  for (const summary_value& v : s.data)
+  {
+    json.begin_object();
+    json.member("name", v.name);
+    json.member("type", v.type);
+    if (v.type == "string")
+    {
+      json.member("value", v.string_value);
+    }
+    else if (v.type == "int64")
+    {
+      // like NVBench, to keep all 64 bits
+      json.member("value", std::to_string(v.int64_value));
+    }
+    else
+    {
+      json.member("value", v.float64_value);
+    }
+    json.end_object();
+  }
+  json.end_array();
+  json.end_object();
+}
+
+std::vector<summary> runner::summarize(const state& s)
+{
+  std::vector<summary> result;
+  const std::vector<double>& samples = s.m_samples;
+  if (samples.empty())
+  {
+    return result;
+  }
+
+  auto float64_summary = [&](std::string tag, std::string name, std::string hint, double value) {
+    result.push_back(summary{std::move(tag), std::move(name), std::move(hint), {{"value", "float64", "", 0, value}}});
+  };
+
+  const double mean_time      = mean(samples);
+  const int64_t sample_count = static_cast<int64_t>(samples.size());
+
+  result.push_back(summary{"nv/cold/sample_size", "Samples", "sample_size", {{"value", "int64", "", sample_count, 0}}});
+  float64_summary("nv/cold/time/cpu/mean", "CPU Time", "duration", mean_time);
+  float64_summary("nv/cold/time/cpu/stdev/relative", "Noise", "percentage", noise(samples) / 100.0);
+  const auto min_max = std::minmax_element(samples.begin(), samples.end());
+  float64_summary("nv/cold/time/cpu/min", "Min CPU Time", "duration", *min_max.first);
+  float64_summary("nv/cold/time/cpu/max", "Max CPU Time", "duration", *min_max.second);
+
+  if (s.m_element_count > 0)
+  {
+    float64_summary("nv/cold/bw/item_rate", "Elem/s", "item_rate", static_cast<double>(s.m_element_count) / mean_time);
+  }
+  if (s.m_global_memory_bytes > 0)
+  {
+    float64_summary("nv/cold/bw/global/bytes_per_second",
+                    "GlobalMem BW",
+                    "byte_rate",
+                    static_cast<double>(s.m_global_memory_bytes) / mean_time);
+  }
+
+  if (m_json_bin)
+  {
+    const std::filesystem::path directory = m_json_path + "-bin";
+    std::filesystem::create_directories(directory);
+    const std::string filename = (directory / (std::to_string(m_next_bin++) + ".bin")).string();
+
+    // little endian 32 bit floats, in seconds
+    std::ofstream bin(filename, std::ios::binary);
+    for (double sample : samples)
+    {
+      const float value = static_cast<float>(sample);
+      bin.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    result.push_back(summary{"nv/json/bin:nv/cold/sample_times",
+                             "Samples Times File",
+                             "file/sample_times",
+                             {{"filename", "string", filename, 0, 0}, {"size", "int64", "", sample_count, 0}}});
+  }
+
+  return result;
+}
+
+void runner::print_markdown(std::ostringstream& md)
+{
+  std::cout << md.str() << std::flush;
+  if (m_md_file.is_open())
+  {
+    m_md_file << md.str() << std::flush;
+  }
+  md.str({});
+}
+
+namespace
+{
+
+std::string format_duration(double seconds)
+{
+  char buffer[32];
+  if (seconds >= 1.0)
+  {
+    std::snprintf(buffer, sizeof(buffer), "%.3f s", seconds);
+  }
+  else if (seconds >= 1e-3)
+  {
+    std::snprintf(buffer, sizeof(buffer), "%.3f ms", seconds * 1e3);
+  }
+  else
+  {
+    std::snprintf(buffer, sizeof(buffer), "%.3f us", seconds * 1e6);
+  }
+  return buffer;
+}
+
+std::string format_rate(double rate, const char* unit)
+{
+  const char* prefixes[] = {"", "K", "M", "G", "T"};
+  std::size_t prefix     = 0;
+  while (rate >= 1000.0 && prefix + 1 < sizeof(prefixes) / sizeof(*prefixes))
+  {
+    rate /= 1000.0;
+    ++prefix;
+  }
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%.3f%s%s", rate, prefixes[prefix], unit);
+  return buffer;
+}
+
+} // namespace
+
+void runner::run_benchmark(json_writer* json, std::size_t index, const benchmark_selection& selection)
+{
+  benchmark_base& bench = *selection.bench;
+
+  std::vector<axis> axes = bench.m_axes;
+  for (const axis_override& o : selection.overrides)
+  {
+    apply_override(bench, axes, o);
+  }
+
+  if (json)
+  {
+    json->begin_object();
+    json->member("name", bench.m_name);
+    json->member("index", static_cast<int64_t>(index));
+    json->member("min_samples", static_cast<int64_t>(m_min_samples));
+    json->member("min_time", m_min_time);
+    json->member("max_noise", m_max_noise / 100.0);
+    json->member("timeout", m_timeout);
+    json->key("devices");
+    json->begin_array();
+    json->value(int64_t{0});
+    json->end_array();
+    write_axes(*json, axes);
+    json->key("states");
+    json->begin_array();
+  }
+
+  std::ostringstream md;
+  md << "\n## " << bench.m_name << "\n\n|";
+  for (const axis& a : axes)
+  {
+    md << ' ' << a.name << " |";
+  }
+  md << " Samples | CPU Time | Noise | Elem/s | BW |\n|";
+  for (std::size_t i = 0; i < axes.size() + 5; ++i)
+  {
+    md << "---|";
+  }
+  md << '\n';
+  print_markdown(md);
+
+  // the type configurations are laid out with the first type axis varying the slowest
+  std::vector<std::size_t> type_axis_sizes;
+  for (std::size_t i = 0; i < bench.m_type_axes; ++i)
+  {
+    type_axis_sizes.push_back(bench.m_axes[i].input_strings.size());
+  }
+
+  std::vector<std::size_t> point(axes.size(), 0);
+  bool done = std::any_of(axes.begin(), axes.end(), [](const axis& a) {
+    return a.input_strings.empty();
+  });
+  while (!done)
+  {
+    state s;
+    s.m_min_samples = m_min_samples;
+    s.m_min_time    = m_min_time;
+    s.m_max_noise   = m_max_noise;
+    s.m_timeout     = m_timeout;
+
+    std::size_t type_config = 0;
+    std::string name        = "Device=0";
+    for (std::size_t i = 0; i < axes.size(); ++i)
+    {
+      const axis& a             = axes[i];
+      const std::string& input  = a.input_strings[point[i]];
+      switch (a.type)
+      {
+        case axis_type::type: {
+          const auto& all_types = bench.m_axes[i].input_strings;
+          const auto type       = std::find(all_types.begin(), all_types.end(), input) - all_types.begin();
+          type_config           = type_config * type_axis_sizes[i] + static_cast<std::size_t>(type);
+          break;
+        }
+        case axis_type::int64:
+          s.m_int64s[a.name] = a.int64s[point[i]];
+          break;
+        case axis_type::float64:
+          s.m_float64s[a.name] = a.float64s[point[i]];
+          break;
+        case axis_type::string:
+          s.m_strings[a.name] = input;
+          break;
+      }
+      name += ' ' + a.name + '=' + input;
+    }
+
+    try
+    {
+      bench.m_type_configs[type_config](s);
+    }
+    catch (const std::exception& e)
+    {
+      s.skip(std::string("exception: ") + e.what());
+    }
+
+    std::vector<summary> summaries = summarize(s);
+
+    md << '|';
+    for (std::size_t i = 0; i < axes.size(); ++i)
+    {
+      const std::string& description = axes[i].descriptions[point[i]];
+      md << ' '
+         << (axes[i].type == axis_type::type || description.empty() ? axes[i].input_strings[point[i]] : description)
+         << " |";
+    }
+    if (s.m_skipped || s.m_samples.empty())
+    {
+      md << " skipped: " << (s.m_skipped ? s.m_skip_reason : "no samples") << " | | | | |\n";
+    }
+    else
+    {
+      const double mean_time = mean(s.m_samples);
+      char noise_string[32];
+      std::snprintf(noise_string, sizeof(noise_string), "%.2f%%", noise(s.m_samples));
+      md << ' ' << s.m_samples.size() << " | " << format_duration(mean_time) << " | " << noise_string << " | "
+         << (s.m_element_count ? format_rate(s.m_element_count / mean_time, "") : "") << " | "
+         << (s.m_global_memory_bytes ? format_rate(s.m_global_memory_bytes / mean_time, "B/s") : "") << " |\n";
+    }
+    print_markdown(md);
+
+    if (json)
+    {
+      json->begin_object();
+      json->member("name", name);
+      json->member("device", int64_t{0});
+      json->member("type_config_index", static_cast<int64_t>(type_config));
+      json->key("axis_values");
+      json->begin_array();
+      for (std::size_t i = 0; i < axes.size(); ++i)
+      {
+        const axis& a = axes[i];
+        json->begin_object();
+        json->member("name", a.name);
+        switch (a.type)
+        {
+          case axis_type::type:
+            json->member("type", "type");
+            json->member("value", a.input_strings[point[i]]);
+            break;
+          case axis_type::int64:
+            json->member("type", "int64");
+            json->member("value", a.int64s[point[i]]);
+            break;
+          case axis_type::float64:
+            json->member("type", "float64");
+            json->member("value", a.float64s[point[i]]);
+            break;
+          case axis_type::string:
+            json->member("type", "string");
+            json->member("value", a.input_strings[point[i]]);
+            break;
+        }
+        json->end_object();
+      }
+      json->end_array();
+      json->key("summaries");
+      json->begin_array();
+      for (const summary& sum : summaries)
+      {
+        write_summary(*json, sum);
+      }
+      json->end_array();
+      json->member("is_skipped", s.m_skipped);
+      if (s.m_skipped)
+      {
+        json->member("skip_reason", s.m_skip_reason);
+      }
+      json->end_object();
+    }
+
+    // the last axis varies the fastest
+    done = true;
+    for (std::size_t i = axes.size(); i-- > 0;)
+    {
+      if (++point[i] < axes[i].input_strings.size())
+      {
+        done = false;
+        break;
+      }
+      point[i] = 0;
+    }
+  }
+
+  if (json)
+  {
+    json->end_array();
+    json->end_object();
+  }
+}
+
+int runner::main(int argc, char** argv)
+{
+  m_argv.assign(argv, argv + argc);
+
+  std::vector<benchmark_selection> selections;
+  std::vector<axis_override> global_overrides;
+
+  auto next_arg = [&](int& i) -> std::string {
+    if (i + 1 >= argc)
+    {
+      throw std::runtime_error(std::string("missing value for ") + argv[i]);
+    }
+    return argv[++i];
+  };
+
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string arg = argv[i];
+    if (arg == "-h" || arg == "--help")
+    {
+      print_usage();
+      return 0;
+    }
+    else if (arg == "--jsonlist-benches")
+    {
+      json_writer json(std::cout);
+      json.begin_object();
+      json.key("benchmarks");
+      json.begin_array();
+      for (std::size_t b = 0; b < benchmarks().size(); ++b)
+      {
+        json.begin_object();
+        json.member("name", benchmarks()[b]->m_name);
+        json.member("index", static_cast<int64_t>(b));
+        write_axes(json, benchmarks()[b]->m_axes);
+        json.end_object();
+      }
+      json.end_array();
+      json.end_object();
+      std::cout << '\n';
+      return 0;
+    }
+    else if (arg == "--jsonlist-devices")
+    {
+      json_writer json(std::cout);
+      json.begin_object();
+      json.key("devices");
+      json.begin_array();
+      write_device(json);
+      json.end_array();
+      json.end_object();
+      std::cout << '\n';
+      return 0;
+    }
+    else if (arg == "-b" || arg == "--benchmark")
+    {
+      selections.push_back(benchmark_selection{find_benchmark(next_arg(i)), global_overrides});
+    }
+    else if (arg == "-a" || arg == "--axis")
+    {
+      axis_override o = parse_override(next_arg(i));
+      if (selections.empty())
+      {
+        global_overrides.push_back(std::move(o));
+      }
+      else
+      {
+        selections.back().overrides.push_back(std::move(o));
+      }
+    }
+    else if (arg == "--json" || arg == "--jsonbin")
+    {
+      m_json_path = next_arg(i);
+      m_json_bin  = arg == "--jsonbin";
+    }
+    else if (arg == "--md")
+    {
+      const std::string path = next_arg(i);
+      m_md_file.open(path);
+      if (!m_md_file)
+      {
+        throw std::runtime_error("cannot write '" + path + "'");
+      }
+    }
+    else if (arg == "--min-samples")
+    {
+      m_min_samples = std::stoull(next_arg(i));
+    }
+    else if (arg == "--min-time")
+    {
+      m_min_time = std::stod(next_arg(i));
+    }
+    else if (arg == "--max-noise")
+    {
+      m_max_noise = std::stod(next_arg(i));
+    }
+    else if (arg == "--timeout")
+    {
+      m_timeout = std::stod(next_arg(i));
+    }
+    else if (arg == "--stopping-criterion")
+    {
+      const std::string criterion = next_arg(i);
+      if (criterion != "stdrel" && criterion != "entropy")
+      {
+        throw std::runtime_error("unknown stopping criterion '" + criterion + "'");
+      }
+    }
+    else if (arg == "-d" || arg == "--device" || arg == "--devices")
+    {
+      const std::string device = next_arg(i);
+      if (device != "0" && device != "all")
+      {
+        throw std::runtime_error("only device 0, the host, is available");
+      }
+    }
+    else
+    {
+      print_usage();
+      throw std::runtime_error("unknown option '" + arg + "'");
+    }
+  }
+
+  if (selections.empty())
+  {
+    for (auto& bench : benchmarks())
+    {
+      selections.push_back(benchmark_selection{bench.get(), global_overrides});
+    }
+  }
+
+  // overrides given before any -b come first and apply only to the benchmarks which have the axis
+  std::vector<bool> used(global_overrides.size(), false);
+  for (benchmark_selection& selection : selections)
+  {
+    const auto& axes = selection.bench->m_axes;
+    std::vector<axis_override> overrides;
+    for (std::size_t i = 0; i < selection.overrides.size(); ++i)
+    {
+      const axis_override& o = selection.overrides[i];
+      if (i < global_overrides.size())
+      {
+        if (std::none_of(axes.begin(), axes.end(), [&](const axis& a) {
+              return a.name == o.name;
+            }))
+        {
+          continue;
+        }
+        used[i] = true;
+      }
+      overrides.push_back(o);
+    }
+    selection.overrides = std::move(overrides);
+  }
+  for (std::size_t i = 0; i < global_overrides.size(); ++i)
+  {
+    if (!used[i])
+    {
+      throw std::runtime_error("no benchmark has an axis named '" + global_overrides[i].name + "'");
+    }
+  }
+
+  std::ofstream json_file;
+  std::unique_ptr<json_writer> json;
+  if (!m_json_path.empty())
+  {
+    json_file.open(m_json_path);
+    if (!json_file)
+    {
+      throw std::runtime_error("cannot write '" + m_json_path + "'");
+    }
+    json = std::make_unique<json_writer>(json_file);
+    json->begin_object();
+    json->key("meta");
+    json->begin_object();
+    json->key("argv");
+    json->begin_array();
+    for (const std::string& arg : m_argv)
+    {
+      json->value(arg);
+    }
+    json->end_array();
+    json->end_object();
+    json->key("devices");
+    json->begin_array();
+    write_device(*json);
+    json->end_array();
+    json->key("benchmarks");
+    json->begin_array();
+  }
+
+  std::ostringstream md;
+  md << "# Benchmark Results\n";
+  print_markdown(md);
+  for (const benchmark_selection& selection : selections)
+  {
+    const std::size_t index = static_cast<std::size_t>(
+      std::find_if(benchmarks().begin(),
+                   benchmarks().end(),
+                   [&](const std::unique_ptr<benchmark_base>& bench) {
+                     return bench.get() == selection.bench;
+                   })
+      - benchmarks().begin());
+    run_benchmark(json.get(), index, selection);
+  }
+
+  if (json)
+  {
+    json->end_array();
+    json->end_object();
+    json_file << '\n';
+  }
+
+  return 0;
+}
+
+} // namespace detail
+
+} // namespace nvbench
+
+int main(int argc, char** argv)
+{
+  try
+  {
+    return nvbench::detail::runner{}.main(argc, argv);
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "error: " << e.what() << '\n';
+    return 1;
+  }
+}
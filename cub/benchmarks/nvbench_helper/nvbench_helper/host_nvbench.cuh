@@ -0,0 +1,390 @@
+#pragma once
+
+// A host-only stand-in for the parts of NVBench used by the benchmarks. It allows building the benchmarks of the
+// CPP, OMP and TBB systems without CUDA. Every run of a benchmark is timed with the CPU clock, and the results are
+// written in the JSON format of NVBench, so that the benchmark scripts (run.py, compare.py, ...) work unchanged.
+//
+// Supported command line options:
+//   -b, --benchmark <name or index>  run only the given benchmark; may be repeated
+//   -a, --axis <name[flags]=values>  override the values of an axis, for all benchmarks if given before any -b
+//   --json <path>                    write results as JSON
+//   --jsonbin <path>                 write results as JSON, with the sample times in binary files next to it
+//   --md <path>                      write the markdown table to a file as well
+//   --jsonlist-benches               print the benchmarks and their axes as JSON
+//   --jsonlist-devices               print the host as the only device, as JSON
+//   --min-samples <n>                minimal number of samples of every state (default 10)
+//   --min-time <seconds>             minimal total time of the samples of every state (default 0.5)
+//   --max-noise <percent>            relative standard deviation at which sampling stops (default 0.5)
+//   --timeout <seconds>              time after which sampling stops regardless of noise (default 15)
+//   --stopping-criterion <name>      accepted for compatibility; "stdrel" and "entropy" both use the noise above
+//   -d, --device <id>                accepted for compatibility; only device 0, the host, exists
+
+#include <c2h/cpu_timer.h>
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#if !defined(__CUDACC__)
+#  if !defined(__host__)
+#    define __host__
+#  endif
+#  if !defined(__device__)
+#    define __device__
+#  endif
+#  if !defined(__forceinline__)
+#    define __forceinline__ inline
+#  endif
+#endif
+
+namespace nvbench
+{
+
+using int8_t    = std::int8_t;
+using int16_t   = std::int16_t;
+using int32_t   = std::int32_t;
+using int64_t   = std::int64_t;
+using uint8_t   = std::uint8_t;
+using uint16_t  = std::uint16_t;
+using uint32_t  = std::uint32_t;
+using uint64_t  = std::uint64_t;
+using float32_t = float;
+using float64_t = double;
+
+template <typename... Ts>
+struct type_list
+{};
+
+template <typename T>
+struct type_strings
+{
+  static std::string input_string()
+  {
+    return typeid(T).name();
+  }
+
+  static std::string description()
+  {
+    return typeid(T).name();
+  }
+};
+
+std::vector<int64_t> range(int64_t start, int64_t end, int64_t stride = 1);
+
+// There are no streams on the host, so a launch carries nothing.
+struct launch
+{};
+
+namespace exec_tag
+{
+namespace impl
+{
+
+enum flags : unsigned
+{
+  none     = 0,
+  timer    = 1,
+  sync     = 2,
+  no_batch = 4
+};
+
+template <unsigned Flags>
+struct tag
+{
+  static constexpr bool has_timer = (Flags & flags::timer) != 0;
+};
+
+template <unsigned A, unsigned B>
+constexpr tag<A | B> operator|(tag<A>, tag<B>)
+{
+  return {};
+}
+
+} // namespace impl
+
+// Every run is synchronous and measured on its own, so sync and no_batch change nothing.
+inline constexpr impl::tag<impl::timer> timer{};
+inline constexpr impl::tag<impl::sync> sync{};
+inline constexpr impl::tag<impl::no_batch> no_batch{};
+
+} // namespace exec_tag
+
+// The timer handed to benchmarks executed with exec_tag::timer.
+class timer
+{
+  c2h::cpu_timer m_timer;
+  double m_elapsed{0.0};
+
+public:
+  void start()
+  {
+    m_timer.reset();
+  }
+
+  void stop()
+  {
+    m_elapsed += m_timer.elapsed_seconds();
+  }
+
+  double elapsed_seconds() const
+  {
+    return m_elapsed;
+  }
+};
+
+namespace detail
+{
+class runner;
+} // namespace detail
+
+class state
+{
+public:
+  int64_t get_int64(const std::string& axis_name) const;
+  int64_t get_int64_or_default(const std::string& axis_name, int64_t default_value) const;
+  float64_t get_float64(const std::string& axis_name) const;
+  float64_t get_float64_or_default(const std::string& axis_name, float64_t default_value) const;
+  const std::string& get_string(const std::string& axis_name) const;
+  const std::string& get_string_or_default(const std::string& axis_name, const std::string& default_value) const;
+
+  void add_element_count(std::size_t elements, std::string column_name = {});
+
+  template <typename T>
+  void add_global_memory_reads(std::size_t count, std::string = {})
+  {
+    m_global_memory_bytes += count * sizeof(T);
+  }
+
+  template <typename T>
+  void add_global_memory_writes(std::size_t count, std::string = {})
+  {
+    m_global_memory_bytes += count * sizeof(T);
+  }
+
+  void skip(std::string reason);
+
+  bool is_skipped() const
+  {
+    return m_skipped;
+  }
+
+  template <unsigned Flags, typename KernelLauncher>
+  void exec(exec_tag::impl::tag<Flags> tag, KernelLauncher&& kernel_launcher)
+  {
+    // the first run is a warm-up and not recorded
+    run_once(tag, kernel_launcher);
+
+    c2h::cpu_timer total;
+    do
+    {
+      m_samples.push_back(run_once(tag, kernel_launcher));
+    } while (keep_sampling(total.elapsed_seconds()));
+  }
+
+  template <typename KernelLauncher>
+  void exec(KernelLauncher&& kernel_launcher)
+  {
+    exec(exec_tag::impl::tag<exec_tag::impl::none>{}, kernel_launcher);
+  }
+
+private:
+  friend class detail::runner;
+
+  template <unsigned Flags, typename KernelLauncher>
+  static double run_once(exec_tag::impl::tag<Flags>, KernelLauncher& kernel_launcher)
+  {
+    launch l;
+    if constexpr (exec_tag::impl::tag<Flags>::has_timer)
+    {
+      nvbench::timer t;
+      kernel_launcher(l, t);
+      return t.elapsed_seconds();
+    }
+    else
+    {
+      c2h::cpu_timer t;
+      kernel_launcher(l);
+      return t.elapsed_seconds();
+    }
+  }
+
+  bool keep_sampling(double total_seconds) const;
+
+  std::map<std::string, int64_t> m_int64s;
+  std::map<std::string, float64_t> m_float64s;
+  std::map<std::string, std::string> m_strings;
+
+  std::size_t m_min_samples{10};
+  double m_min_time{0.5};
+  double m_max_noise{0.5};
+  double m_timeout{15.0};
+
+  std::size_t m_element_count{0};
+  std::size_t m_global_memory_bytes{0};
+  bool m_skipped{false};
+  std::string m_skip_reason;
+  std::vector<double> m_samples;
+};
+
+namespace detail
+{
+
+enum class axis_type
+{
+  type,
+  int64,
+  float64,
+  string
+};
+
+struct axis
+{
+  std::string name;
+  std::string flags;
+  axis_type type;
+
+  std::vector<std::string> input_strings;
+  std::vector<std::string> descriptions;
+  std::vector<int64_t> int64s;
+  std::vector<float64_t> float64s;
+};
+
+// Runs the benchmark for one combination of the values of the type axes, in the order of TypeAxes.
+using type_config_runner = void (*)(state&);
+
+template <typename Generator, typename Chosen, typename... Axes>
+struct type_configs;
+
+template <typename Generator, typename... Chosen>
+struct type_configs<Generator, type_list<Chosen...>>
+{
+  static void run(state& s)
+  {
+    Generator{}(s, type_list<Chosen...>{});
+  }
+
+  static void append(std::vector<type_config_runner>& configs)
+  {
+    configs.push_back(&run);
+  }
+};
+
+template <typename Generator, typename... Chosen, typename... Ts, typename... Axes>
+struct type_configs<Generator, type_list<Chosen...>, type_list<Ts...>, Axes...>
+{
+  static void append(std::vector<type_config_runner>& configs)
+  {
+    (type_configs<Generator, type_list<Chosen..., Ts>, Axes...>::append(configs), ...);
+  }
+};
+
+template <typename... Ts>
+axis make_type_axis(type_list<Ts...>)
+{
+  axis result{};
+  result.type          = axis_type::type;
+  result.input_strings = {type_strings<Ts>::input_string()...};
+  result.descriptions  = {type_strings<Ts>::description()...};
+  return result;
+}
+
+} // namespace detail
+
+class benchmark_base
+{
+public:
+  benchmark_base& set_name(std::string name);
+  benchmark_base& set_type_axes_names(std::vector<std::string> names);
+  benchmark_base& add_int64_axis(std::string name, std::vector<int64_t> values);
+  benchmark_base& add_int64_power_of_two_axis(std::string name, std::vector<int64_t> exponents);
+  benchmark_base& add_float64_axis(std::string name, std::vector<float64_t> values);
+  benchmark_base& add_string_axis(std::string name, std::vector<std::string> values);
+
+private:
+  friend class detail::runner;
+
+  template <typename Generator, typename... TypeAxes>
+  friend benchmark_base& register_benchmark(std::string name, type_list<TypeAxes...>);
+
+  friend benchmark_base& register_benchmark(std::string name, void (*run)(state&));
+
+  std::string m_name;
+
+  // the type axes come first, in the order of the type configurations
+  std::size_t m_type_axes{0};
+  std::vector<detail::axis> m_axes;
+  std::vector<detail::type_config_runner> m_type_configs;
+};
+
+benchmark_base& add_benchmark(std::unique_ptr<benchmark_base> bench);
+
+template <typename Generator, typename... TypeAxes>
+benchmark_base& register_benchmark(std::string name, type_list<TypeAxes...>)
+{
+  auto bench = std::make_unique<benchmark_base>();
+  bench->m_name = std::move(name);
+  bench->m_type_axes = sizeof...(TypeAxes);
+  (bench->m_axes.push_back(detail::make_type_axis(TypeAxes{})), ...);
+  detail::type_configs<Generator, type_list<>, TypeAxes...>::append(bench->m_type_configs);
+  return add_benchmark(std::move(bench));
+}
+
+benchmark_base& register_benchmark(std::string name, void (*run)(state&));
+
+} // namespace nvbench
+
+#define NVBENCH_DECLARE_TYPE_STRINGS(Type, InputString, Description) \
+  namespace nvbench                                                   \
+  {                                                                   \
+  template <>                                                         \
+  struct type_strings<Type>                                           \
+  {                                                                   \
+    static std::string input_string()                                 \
+    {                                                                 \
+      return InputString;                                             \
+    }                                                                 \
+    static std::string description()                                  \
+    {                                                                 \
+      return Description;                                             \
+    }                                                                 \
+  };                                                                  \
+  }
+
+NVBENCH_DECLARE_TYPE_STRINGS(bool, "B8", "bool");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::int8_t, "I8", "int8_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::int16_t, "I16", "int16_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::int32_t, "I32", "int32_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::int64_t, "I64", "int64_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::uint8_t, "U8", "uint8_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::uint16_t, "U16", "uint16_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::uint32_t, "U32", "uint32_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::uint64_t, "U64", "uint64_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::float32_t, "F32", "float");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::float64_t, "F64", "double");
+
+#define NVBENCH_HOST_CONCAT_IMPL(a, b) a##b
+#define NVBENCH_HOST_CONCAT(a, b)      NVBENCH_HOST_CONCAT_IMPL(a, b)
+
+#define NVBENCH_TYPE_AXES(...) nvbench::type_list<__VA_ARGS__>
+
+#define NVBENCH_BENCH_TYPES(KernelGenerator, TypeAxes)                                            \
+  struct NVBENCH_HOST_CONCAT(KernelGenerator##_generator_, __LINE__)                               \
+  {                                                                                               \
+    template <typename... Ts>                                                                     \
+    void operator()(nvbench::state& state, nvbench::type_list<Ts...> types) const                 \
+    {                                                                                             \
+      KernelGenerator(state, types);                                                              \
+    }                                                                                             \
+  };                                                                                              \
+  static nvbench::benchmark_base& NVBENCH_HOST_CONCAT(KernelGenerator##_benchmark_, __LINE__) =   \
+    nvbench::register_benchmark<NVBENCH_HOST_CONCAT(KernelGenerator##_generator_, __LINE__)>(     \
+      #KernelGenerator, TypeAxes{})
+
+#define NVBENCH_BENCH(KernelGenerator)                                                          \
+  static nvbench::benchmark_base& NVBENCH_HOST_CONCAT(KernelGenerator##_benchmark_, __LINE__) = \
+    nvbench::register_benchmark(#KernelGenerator, &KernelGenerator)
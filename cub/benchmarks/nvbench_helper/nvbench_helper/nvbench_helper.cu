@@ -1,4 +1,6 @@
-#include <cub/device/device_copy.cuh>
+#if !defined(NVBENCH_HELPER_HOST_ONLY)
+#  include <cub/device/device_copy.cuh>
+#endif
 
 #include <thrust/binary_search.h>
 #include <thrust/count.h>
@@ -15,12 +17,17 @@
 #include <thrust/scan.h>
 #include <thrust/tabulate.h>
 
+#include <cuda/std/bit>
+
 #include <cstdint>
+#include <optional>
 #include <random>
 #include <type_traits>
 
 #include "thrust/device_vector.h"
-#include <curand.h>
+#if !defined(NVBENCH_HELPER_HOST_ONLY)
+#  include <curand.h>
+#endif
 #include <nvbench_helper.cuh>
 
 namespace
@@ -89,6 +96,10 @@ const double* host_generator_t::new_constant(std::size_t num_items, double val)
   return h_distribution;
 }
 
+#if defined(NVBENCH_HELPER_HOST_ONLY)
+// Without CUDA the device system is one of the host systems, so its data is generated on the host as well.
+using device_generator_t = host_generator_t;
+#else
 class device_generator_t
 {
 public:
@@ -113,6 +124,7 @@ private:
   curandGenerator_t m_gen;
   thrust::device_vector<double> m_distribution;
 };
+#endif // NVBENCH_HELPER_HOST_ONLY
 
 template <typename T>
 struct random_to_item_t
@@ -138,6 +150,7 @@ struct random_to_item_t
   }
 };
 
+#if !defined(NVBENCH_HELPER_HOST_ONLY)
 const double* device_generator_t::new_uniform_distribution(seed_t seed, std::size_t num_items)
 {
   m_distribution.resize(num_items);
@@ -167,6 +180,7 @@ const double* device_generator_t::new_constant(std::size_t num_items, double val
   thrust::fill_n(thrust::device, d_distribution, num_items, val);
   return d_distribution;
 }
+#endif // NVBENCH_HELPER_HOST_ONLY
 
 struct and_t
 {
@@ -178,32 +192,32 @@ struct and_t
 
   __host__ __device__ float operator()(float a, float b) const
   {
-    const std::uint32_t result = reinterpret_cast<std::uint32_t&>(a) & reinterpret_cast<std::uint32_t&>(b);
-    return reinterpret_cast<const float&>(result);
+    const std::uint32_t result = cuda::std::bit_cast<std::uint32_t>(a) & cuda::std::bit_cast<std::uint32_t>(b);
+    return cuda::std::bit_cast<float>(result);
   }
 
   __host__ __device__ double operator()(double a, double b) const
   {
-    const std::uint64_t result = reinterpret_cast<std::uint64_t&>(a) & reinterpret_cast<std::uint64_t&>(b);
-    return reinterpret_cast<const double&>(result);
+    const std::uint64_t result = cuda::std::bit_cast<std::uint64_t>(a) & cuda::std::bit_cast<std::uint64_t>(b);
+    return cuda::std::bit_cast<double>(result);
   }
 
   __host__ __device__ complex operator()(complex a, complex b) const
   {
-    double a_real = a.real();
-    double a_imag = a.imag();
+    const double a_real = a.real();
+    const double a_imag = a.imag();
 
-    double b_real = b.real();
-    double b_imag = b.imag();
+    const double b_real = b.real();
+    const double b_imag = b.imag();
 
     const std::uint64_t result_real =
-      reinterpret_cast<std::uint64_t&>(a_real) & reinterpret_cast<std::uint64_t&>(b_real);
+      cuda::std::bit_cast<std::uint64_t>(a_real) & cuda::std::bit_cast<std::uint64_t>(b_real);
 
     const std::uint64_t result_imag =
-      reinterpret_cast<std::uint64_t&>(a_imag) & reinterpret_cast<std::uint64_t&>(b_imag);
+      cuda::std::bit_cast<std::uint64_t>(a_imag) & cuda::std::bit_cast<std::uint64_t>(b_imag);
 
-    return {static_cast<float>(reinterpret_cast<const double&>(result_real)),
-            static_cast<float>(reinterpret_cast<const double&>(result_imag))};
+    return {static_cast<float>(cuda::std::bit_cast<double>(result_real)),
+            static_cast<float>(cuda::std::bit_cast<double>(result_imag))};
   }
 };
 
@@ -489,7 +503,8 @@ void generator_t::power_law_segment_offsets(
   const std::size_t total_segments   = device_segment_offsets.size() - 1;
   const double* uniform_distribution = dist.new_lognormal_distribution(seed, total_segments);
 
-  if (thrust::count(exec, uniform_distribution, uniform_distribution + total_segments, 0.0) == total_segments)
+  if (thrust::count(exec, uniform_distribution, uniform_distribution + total_segments, 0.0)
+      == static_cast<std::ptrdiff_t>(total_segments))
   {
     uniform_distribution = dist.new_constant(total_segments, 1.0);
   }
@@ -576,7 +591,8 @@ struct offset_to_size_t
 };
 
 template <typename T>
-void gen_key_segments(executor exec, seed_t seed, cuda::std::span<T> keys, cuda::std::span<std::size_t> segment_offsets)
+void gen_key_segments(
+  executor exec, seed_t /* seed */, cuda::std::span<T> keys, cuda::std::span<std::size_t> segment_offsets)
 {
   thrust::counting_iterator<int> iota(0);
   offset_to_iterator_t<T> dst_transform_op{keys.data()};
@@ -587,6 +603,7 @@ void gen_key_segments(executor exec, seed_t seed, cuda::std::span<T> keys, cuda:
   auto d_range_dsts  = thrust::make_transform_iterator(segment_offsets.data(), dst_transform_op);
   auto d_range_sizes = thrust::make_transform_iterator(iota, offset_to_size_t{segment_offsets.data()});
 
+#if !defined(NVBENCH_HELPER_HOST_ONLY)
   if (exec == executor::device)
   {
     std::uint8_t* d_temp_storage   = nullptr;
@@ -600,13 +617,15 @@ void gen_key_segments(executor exec, seed_t seed, cuda::std::span<T> keys, cuda:
     cub::DeviceCopy::Batched(
       d_temp_storage, temp_storage_bytes, d_range_srcs, d_range_dsts, d_range_sizes, total_segments);
     cudaDeviceSynchronize();
+    return;
   }
-  else
+#else // ^^^ !NVBENCH_HELPER_HOST_ONLY ^^^ / vvv NVBENCH_HELPER_HOST_ONLY vvv
+  (void) exec;
+#endif // NVBENCH_HELPER_HOST_ONLY
+
+  for (std::size_t sid = 0; sid < total_segments; sid++)
   {
-    for (std::size_t sid = 0; sid < total_segments; sid++)
-    {
-      thrust::copy(d_range_srcs[sid], d_range_srcs[sid] + d_range_sizes[sid], d_range_dsts[sid]);
-    }
+    thrust::copy(d_range_srcs[sid], d_range_srcs[sid] + d_range_sizes[sid], d_range_dsts[sid]);
   }
 }
 
@@ -10,7 +10,11 @@
 #include <map>
 #include <stdexcept>
 
-#include <nvbench/nvbench.cuh>
+#if defined(NVBENCH_HELPER_HOST_ONLY)
+#  include <host_nvbench.cuh>
+#else
+#  include <nvbench/nvbench.cuh>
+#endif
 
 #if defined(_MSC_VER)
 #  define NVBENCH_HELPER_HAS_I128 0
@@ -565,24 +569,24 @@ private:
 };
 
 #if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
-auto policy(caching_allocator_t& alloc)
+inline auto policy(caching_allocator_t& alloc)
 {
   return thrust::cuda::par(alloc);
 }
 #else
-auto policy(caching_allocator_t&)
+inline auto policy(caching_allocator_t&)
 {
   return thrust::device;
 }
 #endif
 
 #if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
-auto policy(caching_allocator_t& alloc, nvbench::launch& launch)
+inline auto policy(caching_allocator_t& alloc, nvbench::launch& launch)
 {
   return thrust::cuda::par(alloc).on(launch.get_stream());
 }
 #else
-auto policy(caching_allocator_t&, nvbench::launch&)
+inline auto policy(caching_allocator_t&, nvbench::launch&)
 {
   return thrust::device;
 }
@@ -0,0 +1,97 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Measures how many tasks per second a run loop accepts from a growing number of producer threads, while one thread
+// runs the loop.
+
+#include <cuda/experimental/__async/async.cuh>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <host_nvbench.cuh>
+
+namespace cudax_async = cuda::experimental::__async;
+
+// Counts down when the run loop executes it.
+struct countdown_receiver
+{
+  using receiver_concept = cudax_async::receiver_t;
+  std::atomic<int>* remaining;
+
+  void set_value() && noexcept
+  {
+    remaining->fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  template <class Error>
+  void set_error(Error) && noexcept
+  {}
+
+  void set_stopped() && noexcept {}
+};
+
+using run_loop_sender_t = decltype(cudax_async::schedule(cudax_async::run_loop{}.get_scheduler()));
+
+// Operation states are immovable, so construct them in place.
+struct task
+{
+  task(cudax_async::run_loop& loop, std::atomic<int>& remaining)
+      : op{cudax_async::connect(cudax_async::schedule(loop.get_scheduler()), countdown_receiver{&remaining})}
+  {}
+
+  cudax_async::connect_result_t<run_loop_sender_t, countdown_receiver> op;
+};
+
+static void throughput(nvbench::state& state)
+{
+  const auto producers   = static_cast<int>(state.get_int64("Producers"));
+  const int per_producer = (1 << 18) / producers;
+  const int total        = per_producer * producers;
+
+  state.add_element_count(total);
+
+  state.exec(nvbench::exec_tag::timer | nvbench::exec_tag::sync, [&](nvbench::launch&, auto& timer) {
+    cudax_async::run_loop loop;
+    std::atomic<int> remaining{total};
+    std::vector<std::unique_ptr<task>> tasks;
+    tasks.reserve(total);
+    for (int i = 0; i < total; ++i)
+    {
+      tasks.push_back(std::make_unique<task>(loop, remaining));
+    }
+
+    timer.start();
+    std::thread consumer{[&] {
+      loop.run();
+    }};
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p)
+    {
+      threads.emplace_back([&, p] {
+        for (int i = 0; i < per_producer; ++i)
+        {
+          cudax_async::start(tasks[p * per_producer + i]->op);
+        }
+      });
+    }
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+    loop.finish();
+    consumer.join();
+    timer.stop();
+  });
+}
+
+NVBENCH_BENCH(throughput).set_name("throughput").add_int64_axis("Producers", {1, 2, 4, 8, 16, 32, 64});
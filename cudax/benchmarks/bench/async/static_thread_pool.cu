@@ -0,0 +1,63 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Fans out tasks onto a scheduler and waits until all of them ran. The "Scheduler" axis compares the
+// static_thread_pool with a thread_context, which runs every task on the same thread.
+
+#include <cuda/experimental/__async/async.cuh>
+
+#include <atomic>
+#include <thread>
+
+#include <host_nvbench.cuh>
+
+namespace cudax_async = cuda::experimental::__async;
+
+template <class Sched>
+static void run_fan_out_fan_in(nvbench::state& state, Sched sched)
+{
+  const auto tasks = static_cast<int>(state.get_int64("Tasks"));
+  std::atomic<int> remaining{0};
+
+  state.add_element_count(tasks);
+
+  state.exec([&](nvbench::launch&) {
+    remaining = tasks;
+    for (int i = 0; i < tasks; ++i)
+    {
+      cudax_async::start_detached(cudax_async::schedule(sched) | cudax_async::then([&] {
+                                    --remaining;
+                                  }));
+    }
+    while (remaining != 0)
+    {
+      std::this_thread::yield();
+    }
+  });
+}
+
+static void fan_out_fan_in(nvbench::state& state)
+{
+  if (state.get_string("Scheduler") == "thread_context")
+  {
+    cudax_async::thread_context context;
+    run_fan_out_fan_in(state, context.get_scheduler());
+  }
+  else
+  {
+    cudax_async::static_thread_pool pool;
+    run_fan_out_fan_in(state, pool.get_scheduler());
+  }
+}
+
+NVBENCH_BENCH(fan_out_fan_in)
+  .set_name("fan_out_fan_in")
+  .add_int64_axis("Tasks", {1, 8, 64, 512})
+  .add_string_axis("Scheduler", {"thread_context", "static_thread_pool"});
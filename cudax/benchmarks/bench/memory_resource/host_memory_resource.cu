@@ -0,0 +1,77 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Allocates a batch of blocks and frees them again. The "Resource" axis compares the host_memory_resource with the
+// global operator new.
+
+#include <cuda/experimental/memory_resource.cuh>
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+#include <host_nvbench.cuh>
+
+namespace cudax = cuda::experimental;
+
+constexpr int batch = 1000;
+
+template <class Allocate, class Deallocate>
+static void run_batch(nvbench::state& state, Allocate allocate, Deallocate deallocate)
+{
+  const auto bytes = static_cast<std::size_t>(state.get_int64("Bytes"));
+  std::vector<void*> ptrs(batch);
+
+  state.add_element_count(batch);
+
+  state.exec([&](nvbench::launch&) {
+    for (auto& ptr : ptrs)
+    {
+      ptr = allocate(bytes);
+    }
+    for (auto* ptr : ptrs)
+    {
+      deallocate(ptr, bytes);
+    }
+  });
+}
+
+static void allocate_deallocate(nvbench::state& state)
+{
+  if (state.get_string("Resource") == "operator new")
+  {
+    run_batch(
+      state,
+      [](std::size_t bytes) {
+        return ::operator new(bytes);
+      },
+      [](void* ptr, std::size_t) {
+        ::operator delete(ptr);
+      });
+  }
+  else
+  {
+    cudax::mr::host_memory_pool pool{};
+    cudax::mr::host_memory_resource res{pool};
+    run_batch(
+      state,
+      [&](std::size_t bytes) {
+        return res.allocate(bytes);
+      },
+      [&](void* ptr, std::size_t bytes) {
+        res.deallocate(ptr, bytes);
+      });
+  }
+}
+
+NVBENCH_BENCH(allocate_deallocate)
+  .set_name("allocate_deallocate")
+  .add_int64_axis("Bytes", {16, 256, 4096, 65536})
+  .add_string_axis("Resource", {"operator new", "host_memory_resource"});
@@ -26,6 +26,7 @@
 
 // Include the other implementation headers:
 #include <cuda/experimental/__async/basic_sender.cuh>
+#include <cuda/experimental/__async/bulk.cuh>
 #include <cuda/experimental/__async/conditional.cuh>
 #include <cuda/experimental/__async/continue_on.cuh>
 #include <cuda/experimental/__async/cpos.cuh>
@@ -38,6 +39,7 @@
 #include <cuda/experimental/__async/sequence.cuh>
 #include <cuda/experimental/__async/start_detached.cuh>
 #include <cuda/experimental/__async/start_on.cuh>
+#include <cuda/experimental/__async/static_thread_pool.cuh>
 #include <cuda/experimental/__async/stop_token.cuh>
 #include <cuda/experimental/__async/sync_wait.cuh>
 #include <cuda/experimental/__async/then.cuh>
@@ -0,0 +1,280 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_ASYNC_DETAIL_BULK
+#define __CUDAX_ASYNC_DETAIL_BULK
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__type_traits/conditional.h>
+#include <cuda/std/__type_traits/is_integral.h>
+#include <cuda/std/__type_traits/is_same.h>
+
+#include <cuda/experimental/__async/completion_signatures.cuh>
+#include <cuda/experimental/__async/cpos.cuh>
+#include <cuda/experimental/__async/env.cuh>
+#include <cuda/experimental/__async/exception.cuh>
+#include <cuda/experimental/__async/meta.cuh>
+#include <cuda/experimental/__async/queries.cuh>
+#include <cuda/experimental/__async/type_traits.cuh>
+#include <cuda/experimental/__async/utility.cuh>
+
+#include <cuda/experimental/__async/prologue.cuh>
+
+namespace cuda::experimental::__async
+{
+// Forward-declare the bulk algorithm tag types:
+struct bulk_t;
+struct bulk_chunked_t;
+
+namespace __bulk
+{
+// Both algorithms are implemented in terms of a chunk function, which is called
+// with a range of indices [__begin, __end) and the predecessor's values. This
+// adapts the element function of bulk to a chunk function.
+template <class _Fn>
+struct __loop_fn
+{
+  _Fn __fn_;
+
+  template <class _Shape, class... _As>
+  _CUDAX_API void operator()(_Shape __begin, _Shape __end, _As&... __as) //
+    noexcept(__nothrow_callable<_Fn&, _Shape, _As&...>)
+  {
+    for (; __begin != __end; ++__begin)
+    {
+      __fn_(__begin, __as...);
+    }
+  }
+};
+
+template <class _Tag, class _Fn>
+using __chunk_fn_t = _CUDA_VSTD::conditional_t<_CUDA_VSTD::is_same_v<_Tag, bulk_t>, __loop_fn<_Fn>, _Fn>;
+
+// The scheduler on which a sender completes with a value, if it has one.
+template <class _Sndr>
+using __value_scheduler_t = //
+  decltype(get_completion_scheduler<set_value_t>(__async::get_env(__declval<const _Sndr&>())));
+
+// A scheduler customizes bulk and bulk_chunked with member functions of the
+// same names that take the predecessor, the shape and the function.
+template <class _Sndr, class _Shape, class _Fn>
+using __custom_bulk_t =
+  decltype(__declval<__value_scheduler_t<_Sndr>>().bulk(__declval<_Sndr>(), __declval<_Shape>(), __declval<_Fn>()));
+
+template <class _Sndr, class _Shape, class _Fn>
+using __custom_bulk_chunked_t = decltype(__declval<__value_scheduler_t<_Sndr>>().bulk_chunked(
+  __declval<_Sndr>(), __declval<_Shape>(), __declval<_Fn>()));
+
+template <class _Tag, class _Sndr, class _Shape, class _Fn>
+inline constexpr bool __is_customized =
+  _CUDA_VSTD::is_same_v<_Tag, bulk_t>
+    ? __type_valid_v<__custom_bulk_t, _Sndr, _Shape, _Fn>
+    : __type_valid_v<__custom_bulk_chunked_t, _Sndr, _Shape, _Fn>;
+
+// The default implementation calls the chunk function once with the whole index
+// space on the thread on which the predecessor completes.
+template <class _Rcvr, class _CvSndr, class _Shape, class _Fn>
+struct __opstate_t
+{
+  _CUDAX_API friend env_of_t<_Rcvr> get_env(const __opstate_t* __self) noexcept
+  {
+    return __async::get_env(__self->__rcvr_);
+  }
+
+  template <class... _As>
+  using __value_completions = //
+    __concat_completion_signatures<completion_signatures<set_value_t(_As...)>,
+                                   __eptr_completion_unless<__nothrow_callable<_Fn&, _Shape, _Shape, _As&...>>>;
+
+  using operation_state_concept = operation_state_t;
+  using completion_signatures   = //
+    transform_completion_signatures<completion_signatures_of_t<_CvSndr, __opstate_t*>,
+                                    __async::completion_signatures<>,
+                                    __value_completions>;
+
+  _Rcvr __rcvr_;
+  _Shape __shape_;
+  _Fn __fn_;
+  connect_result_t<_CvSndr, __opstate_t*> __opstate_;
+
+  _CUDAX_API __opstate_t(_CvSndr&& __sndr, _Rcvr __rcvr, _Shape __shape, _Fn __fn)
+      : __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
+      , __shape_{__shape}
+      , __fn_{static_cast<_Fn&&>(__fn)}
+      , __opstate_{__async::connect(static_cast<_CvSndr&&>(__sndr), this)}
+  {}
+
+  _CUDAX_IMMOVABLE(__opstate_t);
+
+  _CUDAX_API void start() & noexcept
+  {
+    __async::start(__opstate_);
+  }
+
+  template <class... _As>
+  _CUDAX_API void set_value(_As&&... __as) noexcept
+  {
+    if constexpr (__nothrow_callable<_Fn&, _Shape, _Shape, _As&...>)
+    {
+      __fn_(_Shape(0), __shape_, __as...);
+      __async::set_value(static_cast<_Rcvr&&>(__rcvr_), static_cast<_As&&>(__as)...);
+    }
+    else
+    {
+      _CUDAX_TRY( //
+        ({ //
+          __fn_(_Shape(0), __shape_, __as...);
+          __async::set_value(static_cast<_Rcvr&&>(__rcvr_), static_cast<_As&&>(__as)...);
+        }),
+        _CUDAX_CATCH(...)( //
+          { //
+            __async::set_error(static_cast<_Rcvr&&>(__rcvr_), ::std::current_exception());
+          }))
+    }
+  }
+
+  template <class _Error>
+  _CUDAX_API void set_error(_Error&& __error) noexcept
+  {
+    __async::set_error(static_cast<_Rcvr&&>(__rcvr_), static_cast<_Error&&>(__error));
+  }
+
+  _CUDAX_API void set_stopped() noexcept
+  {
+    __async::set_stopped(static_cast<_Rcvr&&>(__rcvr_));
+  }
+};
+
+template <class _Tag, class _Sndr, class _Shape, class _Fn>
+struct __sndr_t
+{
+  using sender_concept = sender_t;
+  _CCCL_NO_UNIQUE_ADDRESS _Tag __tag_;
+  _Shape __shape_;
+  _Fn __fn_;
+  _Sndr __sndr_;
+
+  template <class _Rcvr>
+  _CUDAX_API auto connect(_Rcvr __rcvr) && //
+    noexcept(__nothrow_constructible<__opstate_t<_Rcvr, _Sndr, _Shape, _Fn>, _Sndr, _Rcvr, _Shape, _Fn>) //
+    -> __opstate_t<_Rcvr, _Sndr, _Shape, _Fn>
+  {
+    return __opstate_t<_Rcvr, _Sndr, _Shape, _Fn>{
+      static_cast<_Sndr&&>(__sndr_), static_cast<_Rcvr&&>(__rcvr), __shape_, static_cast<_Fn&&>(__fn_)};
+  }
+
+  template <class _Rcvr>
+  _CUDAX_API auto connect(_Rcvr __rcvr) const& //
+    noexcept(__nothrow_constructible<__opstate_t<_Rcvr, const _Sndr&, _Shape, _Fn>,
+                                     const _Sndr&,
+                                     _Rcvr,
+                                     _Shape,
+                                     const _Fn&>) //
+    -> __opstate_t<_Rcvr, const _Sndr&, _Shape, _Fn>
+  {
+    return __opstate_t<_Rcvr, const _Sndr&, _Shape, _Fn>{__sndr_, static_cast<_Rcvr&&>(__rcvr), __shape_, __fn_};
+  }
+
+  _CUDAX_API env_of_t<_Sndr> get_env() const noexcept
+  {
+    return __async::get_env(__sndr_);
+  }
+};
+
+template <class _Tag>
+struct __algorithm_t
+{
+  template <class _Shape, class _Fn>
+  struct __closure_t
+  {
+    _Shape __shape_;
+    _Fn __fn_;
+
+    template <class _Sndr>
+    _CUDAX_TRIVIAL_API auto operator()(_Sndr __sndr) //
+      -> __call_result_t<_Tag, _Sndr, _Shape, _Fn>
+    {
+      return _Tag()(static_cast<_Sndr&&>(__sndr), __shape_, static_cast<_Fn&&>(__fn_));
+    }
+
+    template <class _Sndr>
+    _CUDAX_TRIVIAL_API friend auto operator|(_Sndr __sndr, __closure_t&& __self) //
+      -> __call_result_t<_Tag, _Sndr, _Shape, _Fn>
+    {
+      return _Tag()(static_cast<_Sndr&&>(__sndr), __self.__shape_, static_cast<_Fn&&>(__self.__fn_));
+    }
+  };
+
+  template <class _Sndr, class _Shape, class _Fn>
+  _CUDAX_TRIVIAL_API auto operator()(_Sndr __sndr, _Shape __shape, _Fn __fn) const
+  {
+    static_assert(_CUDA_VSTD::is_integral_v<_Shape>, "the shape of a bulk operation must be an integral type");
+    if constexpr (__is_customized<_Tag, _Sndr, _Shape, _Fn>)
+    {
+      // Let the scheduler on which the predecessor completes run the operation.
+      auto __sch = get_completion_scheduler<set_value_t>(__async::get_env(__sndr));
+      if constexpr (_CUDA_VSTD::is_same_v<_Tag, bulk_t>)
+      {
+        return __sch.bulk(static_cast<_Sndr&&>(__sndr), __shape, static_cast<_Fn&&>(__fn));
+      }
+      else
+      {
+        return __sch.bulk_chunked(static_cast<_Sndr&&>(__sndr), __shape, static_cast<_Fn&&>(__fn));
+      }
+    }
+    else
+    {
+      using __sndr_t = __bulk::__sndr_t<_Tag, _Sndr, _Shape, __chunk_fn_t<_Tag, _Fn>>;
+      // If the incoming sender is non-dependent, we can check the completion
+      // signatures of the composed sender immediately.
+      if constexpr (__is_non_dependent_sender<_Sndr>)
+      {
+        using __completions = completion_signatures_of_t<__sndr_t>;
+        static_assert(__is_completion_signatures<__completions>);
+      }
+      return __sndr_t{{}, __shape, {static_cast<_Fn&&>(__fn)}, static_cast<_Sndr&&>(__sndr)};
+    }
+  }
+
+  template <class _Shape, class _Fn>
+  _CUDAX_TRIVIAL_API auto operator()(_Shape __shape, _Fn __fn) const noexcept
+  {
+    return __closure_t<_Shape, _Fn>{__shape, static_cast<_Fn&&>(__fn)};
+  }
+};
+} // namespace __bulk
+
+//! bulk(sndr, shape, fn): once sndr completes with values as..., calls
+//! fn(i, as...) for each i in [0, shape) and then completes with the values.
+//! Schedulers that can run the calls in parallel customize bulk; otherwise the
+//! calls run in a loop on the thread on which sndr completes.
+_CCCL_GLOBAL_CONSTANT struct bulk_t : __bulk::__algorithm_t<bulk_t>
+{
+} bulk{};
+
+//! bulk_chunked(sndr, shape, fn): like bulk, but calls fn(begin, end, as...)
+//! for disjoint ranges [begin, end) that together cover [0, shape).
+_CCCL_GLOBAL_CONSTANT struct bulk_chunked_t : __bulk::__algorithm_t<bulk_chunked_t>
+{
+} bulk_chunked{};
+} // namespace cuda::experimental::__async
+
+#include <cuda/experimental/__async/epilogue.cuh>
+
+#endif
@@ -232,7 +232,7 @@ struct continue_on_t::__sndr_t
 
   struct __attrs_t
   {
-    __sndr_t* __sndr;
+    const __sndr_t* __sndr;
 
     template <class _SetTag>
     _CUDAX_API auto query(get_completion_scheduler_t<_SetTag>) const noexcept
@@ -23,17 +23,19 @@
 
 #include <cuda/experimental/__detail/config.cuh>
 
-// libcu++ does not have <cuda/std/mutex> or <cuda/std/condition_variable>
+// The run loop parks its thread, which only makes sense on the host
 #if !defined(__CUDA_ARCH__)
 
+#  include <cuda/std/atomic>
+
 #  include <cuda/experimental/__async/completion_signatures.cuh>
 #  include <cuda/experimental/__async/env.cuh>
 #  include <cuda/experimental/__async/exception.cuh>
 #  include <cuda/experimental/__async/queries.cuh>
 #  include <cuda/experimental/__async/utility.cuh>
 
-#  include <condition_variable>
-#  include <mutex>
+#  include <atomic>
+#  include <thread>
 
 #  include <cuda/experimental/__async/prologue.cuh>
 
@@ -47,23 +49,14 @@ struct __task : __immovable
 
   __task() = default;
 
-  _CUDAX_API explicit __task(__task* __next, __task* __tail) noexcept
-      : __next_{__next}
-      , __tail_{__tail}
-  {}
-
   _CUDAX_API explicit __task(__task* __next, __execute_fn_t* __execute) noexcept
       : __next_{__next}
       , __execute_fn_{__execute}
   {}
 
-  __task* __next_ = this;
-
-  union
-  {
-    __task* __tail_ = nullptr;
-    __execute_fn_t* __execute_fn_;
-  };
+  // Atomic so that queues can link tasks without a lock.
+  ::std::atomic<__task*> __next_{nullptr};
+  __execute_fn_t* __execute_fn_ = nullptr;
 
   _CUDAX_API void __execute() noexcept
   {
@@ -100,12 +93,8 @@ struct __operation : __task
         }))
   }
 
-  _CUDAX_API explicit __operation(__task* __tail_) noexcept
-      : __task{this, __tail_}
-  {}
-
-  _CUDAX_API __operation(__task* __next_, run_loop* __loop, _Rcvr __rcvr)
-      : __task{__next_, &__execute_impl}
+  _CUDAX_API __operation(run_loop* __loop, _Rcvr __rcvr)
+      : __task{nullptr, &__execute_impl}
       , __loop_{__loop}
       , __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
   {}
@@ -113,6 +102,10 @@ struct __operation : __task
   _CUDAX_API void start() & noexcept;
 };
 
+// A run loop executes the tasks scheduled on it, in order, on the one thread that
+// calls run(). Tasks are queued in an intrusive lock-free multi-producer/single-
+// consumer queue (Dmitry Vyukov's), so scheduling a task never takes a lock, and
+// the thread that runs the loop only sleeps when the queue is empty.
 class run_loop
 {
   template <class... _Ts>
@@ -122,10 +115,7 @@ class run_loop
   friend struct __operation;
 
 public:
-  run_loop() noexcept
-  {
-    __head.__next_ = __head.__tail_ = &__head;
-  }
+  run_loop() noexcept = default;
 
   class __scheduler
   {
@@ -138,12 +128,9 @@ public:
       template <class _Rcvr>
       _CUDAX_API auto connect(_Rcvr __rcvr) const noexcept -> __operation<_Rcvr>
       {
-        return {&__loop_->__head, __loop_, static_cast<_Rcvr&&>(__rcvr)};
+        return {__loop_, static_cast<_Rcvr&&>(__rcvr)};
       }
 
-    private:
-      friend __scheduler;
-
       struct __env
       {
         run_loop* __loop_;
@@ -160,6 +147,9 @@ public:
         return __env{__loop_};
       }
 
+    private:
+      friend __scheduler;
+
       _CUDAX_API explicit __schedule_task(run_loop* __loop) noexcept
           : __loop_(__loop)
       {}
@@ -209,30 +199,39 @@ public:
   _CUDAX_API void finish();
 
 private:
-  _CUDAX_API void __push_back(__task* __tsk);
-  _CUDAX_API auto __pop_front() -> __task*;
-
-  ::std::mutex __mutex{};
-  ::std::condition_variable __cv{};
-  __task __head{};
-  bool __stop = false;
+  _CUDAX_API void __push_back(__task* __tsk) noexcept;
+  _CUDAX_API void __link(__task* __tsk) noexcept;
+  _CUDAX_API auto __pop_front() noexcept -> __task*;
+  _CUDAX_API auto __try_pop_front() noexcept -> __task*;
+  _CUDAX_API bool __empty() noexcept;
+  _CUDAX_API void __park() noexcept;
+  _CUDAX_API void __enter() noexcept;
+  _CUDAX_API void __leave() noexcept;
+
+  // Bit 0 of __state is set while the consumer sleeps. The other bits count the
+  // threads in __push_back or finish, which run() waits for before it returns,
+  // because the run loop may be destroyed as soon as it does.
+  static constexpr int __sleeping = 1;
+  static constexpr int __producer = 2;
+
+  // The consumer pops from __front, producers push after __back. The queue is
+  // never empty: when all tasks are popped, it holds __stub.
+  __task __stub{};
+  __task* __front = &__stub;
+  ::std::atomic<__task*> __back{&__stub};
+  ::cuda::std::atomic<int> __state{0};
+  ::cuda::std::atomic<bool> __stop{false};
 };
 
 template <class _Rcvr>
-_CUDAX_API inline void __operation<_Rcvr>::start() & noexcept {
-  _CUDAX_TRY( //
-    ({ //
-      __loop_->__push_back(this); //
-    }), //
-    _CUDAX_CATCH(...)( //
-      { //
-        set_error(static_cast<_Rcvr&&>(__rcvr_), ::std::current_exception()); //
-      })) //
+_CUDAX_API inline void __operation<_Rcvr>::start() & noexcept
+{
+  __loop_->__push_back(this);
 }
 
 _CUDAX_API inline void run_loop::run()
 {
-  for (__task* __tsk = __pop_front(); __tsk != &__head; __tsk = __pop_front())
+  for (__task* __tsk = __pop_front(); __tsk != nullptr; __tsk = __pop_front())
   {
     __tsk->__execute();
   }
@@ -240,30 +239,129 @@ _CUDAX_API inline void run_loop::run()
 
 _CUDAX_API inline void run_loop::finish()
 {
-  ::std::unique_lock __lock{__mutex};
-  __stop = true;
-  __cv.notify_all();
+  __enter();
+  __stop.store(true, ::cuda::std::memory_order_seq_cst);
+  __leave();
+}
+
+_CUDAX_API inline void run_loop::__push_back(__task* __tsk) noexcept
+{
+  __enter();
+  __link(__tsk);
+  __leave();
+}
+
+_CUDAX_API inline void run_loop::__link(__task* __tsk) noexcept
+{
+  // Swap the task in as the new back, then link the old back to it. Until the
+  // link is stored, the consumer cannot reach the task and waits for it.
+  __tsk->__next_.store(nullptr, ::std::memory_order_relaxed);
+  __task* __prev = __back.exchange(__tsk, ::std::memory_order_seq_cst);
+  __prev->__next_.store(__tsk, ::std::memory_order_release);
+}
+
+// Returns nullptr when there is no task that can be popped yet, which is either
+// because the queue is empty or because a producer has not linked its task yet.
+_CUDAX_API inline auto run_loop::__try_pop_front() noexcept -> __task*
+{
+  __task* __tsk  = __front;
+  __task* __next = __tsk->__next_.load(::std::memory_order_acquire);
+  if (__tsk == &__stub)
+  {
+    if (__next == nullptr)
+    {
+      return nullptr;
+    }
+    __front = __tsk = __next;
+    __next          = __next->__next_.load(::std::memory_order_acquire);
+  }
+
+  if (__next == nullptr)
+  {
+    // __tsk is the last linked task. Unless a producer is about to link another
+    // task after it, push the stub after it so that it can be popped.
+    if (__tsk != __back.load(::std::memory_order_acquire))
+    {
+      return nullptr;
+    }
+    __link(&__stub);
+    __next = __tsk->__next_.load(::std::memory_order_acquire);
+    if (__next == nullptr)
+    {
+      return nullptr;
+    }
+  }
+
+  __front = __next;
+  return __tsk;
+}
+
+_CUDAX_API inline bool run_loop::__empty() noexcept
+{
+  return __front == &__stub && __back.load(::std::memory_order_seq_cst) == &__stub;
+}
+
+_CUDAX_API inline auto run_loop::__pop_front() noexcept -> __task*
+{
+  while (true)
+  {
+    if (__task* __tsk = __try_pop_front())
+    {
+      return __tsk;
+    }
+    else if (!__empty())
+    {
+      // A producer is between the two steps of __push_back.
+      ::std::this_thread::yield();
+    }
+    else if (__stop.load(::cuda::std::memory_order_acquire))
+    {
+      while (__state.load(::cuda::std::memory_order_acquire) >= __producer)
+      {
+        ::std::this_thread::yield();
+      }
+      // The producers that were still running may have pushed more tasks.
+      if (__empty())
+      {
+        return nullptr;
+      }
+    }
+    else
+    {
+      __park();
+    }
+  }
+}
+
+// Setting the sleeping bit before checking the queue again, and pushing before
+// checking the sleeping bit in __leave, are all sequentially consistent. So
+// either the consumer sees the new task, or the producer sees that it sleeps.
+_CUDAX_API inline void run_loop::__park() noexcept
+{
+  const int __old = __state.fetch_or(__sleeping, ::cuda::std::memory_order_seq_cst) | __sleeping;
+  if (__empty() && !__stop.load(::cuda::std::memory_order_seq_cst))
+  {
+    // Also returns when the number of producers changes, which is harmless.
+    __state.wait(__old, ::cuda::std::memory_order_acquire);
+  }
+  __state.fetch_and(~__sleeping, ::cuda::std::memory_order_relaxed);
 }
 
-_CUDAX_API inline void run_loop::__push_back(__task* __tsk)
+_CUDAX_API inline void run_loop::__enter() noexcept
 {
-  ::std::unique_lock __lock{__mutex};
-  __tsk->__next_ = &__head;
-  __head.__tail_ = __head.__tail_->__next_ = __tsk;
-  __cv.notify_one();
+  __state.fetch_add(__producer, ::cuda::std::memory_order_seq_cst);
 }
 
-_CUDAX_API inline auto run_loop::__pop_front() -> __task*
+_CUDAX_API inline void run_loop::__leave() noexcept
 {
-  ::std::unique_lock __lock{__mutex};
-  __cv.wait(__lock, [this] {
-    return __head.__next_ != &__head || __stop;
-  });
-  if (__head.__tail_ == __head.__next_)
+  // Only the producer that clears the sleeping bit pays for the notification.
+  if ((__state.load(::cuda::std::memory_order_seq_cst) & __sleeping) != 0
+      && (__state.fetch_and(~__sleeping, ::cuda::std::memory_order_seq_cst) & __sleeping) != 0)
   {
-    __head.__tail_ = &__head;
+    __state.notify_one();
   }
-  return __async::__exchange(__head.__next_, __head.__next_->__next_);
+  // This is the last access to the run loop.
+  __state.fetch_sub(__producer, ::cuda::std::memory_order_release);
 }
 } // namespace cuda::experimental::__async
 
@@ -0,0 +1,805 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_ASYNC_DETAIL_STATIC_THREAD_POOL
+#define __CUDAX_ASYNC_DETAIL_STATIC_THREAD_POOL
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/experimental/__detail/config.cuh>
+
+// libcu++ does not have <cuda/std/mutex> or <cuda/std/condition_variable>
+#if !defined(__CUDA_ARCH__)
+
+#  include <cuda/experimental/__async/bulk.cuh>
+#  include <cuda/experimental/__async/completion_signatures.cuh>
+#  include <cuda/experimental/__async/cpos.cuh>
+#  include <cuda/experimental/__async/env.cuh>
+#  include <cuda/experimental/__async/exception.cuh>
+#  include <cuda/experimental/__async/queries.cuh>
+#  include <cuda/experimental/__async/run_loop.cuh>
+#  include <cuda/experimental/__async/tuple.cuh>
+#  include <cuda/experimental/__async/utility.cuh>
+#  include <cuda/experimental/__async/variant.cuh>
+
+#  include <algorithm>
+#  include <atomic>
+#  include <condition_variable>
+#  include <cstddef>
+#  include <memory>
+#  include <mutex>
+#  include <thread>
+#  include <vector>
+
+#  include <cuda/experimental/__async/prologue.cuh>
+
+namespace cuda::experimental::__async
+{
+class static_thread_pool;
+
+namespace __pool
+{
+// A fixed-capacity work-stealing deque of intrusive tasks. Only the worker that
+// owns the deque pushes and pops at the bottom; the other workers steal from the
+// top. This is the Chase-Lev deque; the sequentially consistent accesses to the
+// ends order the owner's pop of the last task against concurrent steals.
+class __deque
+{
+public:
+  _CUDAX_API explicit __deque(size_t __capacity)
+      : __mask_{__capacity - 1}
+      , __buffer_{new ::std::atomic<__task*>[__capacity]}
+  {}
+
+  // Returns false if the deque is full.
+  _CUDAX_API bool __push(__task* __tsk) noexcept
+  {
+    const ptrdiff_t __b = __bottom_.load(::std::memory_order_relaxed);
+    const ptrdiff_t __t = __top_.load(::std::memory_order_acquire);
+    if (__b - __t > static_cast<ptrdiff_t>(__mask_))
+    {
+      return false;
+    }
+    __slot(__b).store(__tsk, ::std::memory_order_relaxed);
+    __bottom_.store(__b + 1, ::std::memory_order_release);
+    return true;
+  }
+
+  // Takes the most recently pushed task, or returns nullptr if the deque is empty.
+  _CUDAX_API auto __pop() noexcept -> __task*
+  {
+    const ptrdiff_t __b = __bottom_.load(::std::memory_order_relaxed) - 1;
+    __bottom_.store(__b, ::std::memory_order_seq_cst);
+    ptrdiff_t __t = __top_.load(::std::memory_order_seq_cst);
+    if (__t > __b)
+    {
+      __bottom_.store(__b + 1, ::std::memory_order_relaxed);
+      return nullptr;
+    }
+    __task* __tsk = __slot(__b).load(::std::memory_order_relaxed);
+    if (__t == __b)
+    {
+      // This is the last task. Race the thieves for it.
+      if (!__top_.compare_exchange_strong(__t, __t + 1, ::std::memory_order_seq_cst, ::std::memory_order_relaxed))
+      {
+        __tsk = nullptr;
+      }
+      __bottom_.store(__b + 1, ::std::memory_order_relaxed);
+    }
+    return __tsk;
+  }
+
+  // Takes the oldest task, or returns nullptr if the deque is empty or another
+  // thread won the race for the task.
+  _CUDAX_API auto __steal() noexcept -> __task*
+  {
+    ptrdiff_t __t       = __top_.load(::std::memory_order_seq_cst);
+    const ptrdiff_t __b = __bottom_.load(::std::memory_order_seq_cst);
+    if (__t >= __b)
+    {
+      return nullptr;
+    }
+    __task* __tsk = __slot(__t).load(::std::memory_order_relaxed);
+    if (!__top_.compare_exchange_strong(__t, __t + 1, ::std::memory_order_seq_cst, ::std::memory_order_relaxed))
+    {
+      return nullptr;
+    }
+    return __tsk;
+  }
+
+private:
+  _CUDAX_API auto __slot(ptrdiff_t __i) const noexcept -> ::std::atomic<__task*>&
+  {
+    return __buffer_[static_cast<size_t>(__i) & __mask_];
+  }
+
+  // Keep the ends of the deque on separate cache lines so that the owner and
+  // the thieves do not contend more than they have to.
+  alignas(64)::std::atomic<ptrdiff_t> __top_{0};
+  alignas(64)::std::atomic<ptrdiff_t> __bottom_{0};
+  size_t __mask_;
+  ::std::unique_ptr<::std::atomic<__task*>[]> __buffer_;
+};
+
+// An intrusive FIFO of tasks submitted from threads that do not belong to the
+// pool, linked through __task::__next_.
+class __inbox
+{
+public:
+  _CUDAX_API void __push(__task* __tsk)
+  {
+    ::std::lock_guard __lock{__mutex_};
+    __tsk->__next_.store(nullptr, ::std::memory_order_relaxed);
+    if (__tail_ != nullptr)
+    {
+      __tail_->__next_.store(__tsk, ::std::memory_order_relaxed);
+    }
+    else
+    {
+      __head_ = __tsk;
+    }
+    __tail_ = __tsk;
+    __size_.fetch_add(1, ::std::memory_order_release);
+  }
+
+  _CUDAX_API auto __pop() -> __task*
+  {
+    if (__size_.load(::std::memory_order_acquire) == 0)
+    {
+      return nullptr;
+    }
+    ::std::lock_guard __lock{__mutex_};
+    __task* __tsk = __head_;
+    if (__tsk != nullptr)
+    {
+      __head_ = __tsk->__next_.load(::std::memory_order_relaxed);
+      if (__head_ == nullptr)
+      {
+        __tail_ = nullptr;
+      }
+      __size_.fetch_sub(1, ::std::memory_order_relaxed);
+    }
+    return __tsk;
+  }
+
+private:
+  ::std::mutex __mutex_{};
+  __task* __head_ = nullptr;
+  __task* __tail_ = nullptr;
+  ::std::atomic<size_t> __size_{0};
+};
+
+struct __worker
+{
+  _CUDAX_API explicit __worker(size_t __capacity)
+      : __deque_{__capacity}
+  {}
+
+  __deque __deque_;
+  __inbox __inbox_;
+  ::std::thread __thread_{};
+};
+
+// Identifies the pool worker running on the current thread, if any.
+struct __this_worker_t
+{
+  static_thread_pool* __pool_ = nullptr;
+  size_t __index_             = 0;
+};
+
+_CUDAX_API inline auto __this_worker() noexcept -> __this_worker_t&
+{
+  static thread_local __this_worker_t __self{};
+  return __self;
+}
+
+template <class _Rcvr>
+struct __opstate_t;
+
+template <class _Rcvr, class _CvSndr, class _Shape, class _Fn>
+struct __bulk_opstate_t;
+
+template <class _Sndr, class _Shape, class _Fn>
+struct __bulk_sndr_t;
+} // namespace __pool
+
+//! A pool of a fixed number of worker threads that run the operations scheduled
+//! onto it. Each worker owns a work-stealing deque and prefers the tasks that it
+//! scheduled itself; idle workers steal the oldest tasks of the other workers.
+//! Scheduling does not allocate: the operation states are the tasks.
+class static_thread_pool
+{
+  template <class>
+  friend struct __pool::__opstate_t;
+
+  template <class, class, class, class>
+  friend struct __pool::__bulk_opstate_t;
+
+public:
+  static_thread_pool()
+      : static_thread_pool((::std::max)(::std::thread::hardware_concurrency(), 1u))
+  {}
+
+  //! @param __thread_count The number of worker threads.
+  //! @param __deque_capacity The number of tasks a worker's deque holds before the
+  //! worker's further tasks spill into its shared inbox. Must be a power of two.
+  explicit static_thread_pool(size_t __thread_count, size_t __deque_capacity = 1024)
+  {
+    _CCCL_ASSERT(__thread_count > 0, "static_thread_pool requires at least one thread");
+    _CCCL_ASSERT((__deque_capacity & (__deque_capacity - 1)) == 0, "the deque capacity must be a power of two");
+    __workers_.reserve(__thread_count);
+    for (size_t __i = 0; __i < __thread_count; ++__i)
+    {
+      __workers_.push_back(::std::make_unique<__pool::__worker>(__deque_capacity));
+    }
+    for (size_t __i = 0; __i < __thread_count; ++__i)
+    {
+      __workers_[__i]->__thread_ = ::std::thread{[this, __i] {
+        __run(__i);
+      }};
+    }
+  }
+
+  ~static_thread_pool() noexcept
+  {
+    join();
+  }
+
+  //! Runs the operations that were already scheduled and joins the workers.
+  void join() noexcept
+  {
+    {
+      ::std::lock_guard __lock{__mutex_};
+      __stop_ = true;
+    }
+    __cv_.notify_all();
+    for (auto& __worker : __workers_)
+    {
+      if (__worker->__thread_.joinable())
+      {
+        __worker->__thread_.join();
+      }
+    }
+  }
+
+  [[nodiscard]] _CUDAX_API auto available_parallelism() const noexcept -> size_t
+  {
+    return __workers_.size();
+  }
+
+  class __scheduler;
+
+  _CUDAX_API auto get_scheduler() noexcept -> __scheduler;
+
+private:
+  _CUDAX_API void __run(size_t __self) noexcept
+  {
+    __pool::__this_worker() = {this, __self};
+    while (true)
+    {
+      if (__task* __tsk = __find_work(__self))
+      {
+        __tsk->__execute();
+      }
+      else if (!__park(__self))
+      {
+        break;
+      }
+    }
+  }
+
+  // Looks for a task in the worker's own deque and inbox, then tries to steal one
+  // from each of the other workers in turn.
+  _CUDAX_API auto __find_work(size_t __self) noexcept -> __task*
+  {
+    __pool::__worker& __worker = *__workers_[__self];
+    if (__task* __tsk = __worker.__deque_.__pop())
+    {
+      return __tsk;
+    }
+    if (__task* __tsk = __worker.__inbox_.__pop())
+    {
+      return __tsk;
+    }
+    const size_t __count = __workers_.size();
+    for (size_t __i = 1; __i < __count; ++__i)
+    {
+      __pool::__worker& __victim = *__workers_[(__self + __i) % __count];
+      if (__task* __tsk = __victim.__deque_.__steal())
+      {
+        return __tsk;
+      }
+      if (__task* __tsk = __victim.__inbox_.__pop())
+      {
+        return __tsk;
+      }
+    }
+    return nullptr;
+  }
+
+  // Blocks the worker until more work is enqueued. Returns false if the pool is
+  // stopping and there is no work left.
+  _CUDAX_API bool __park(size_t __self) noexcept
+  {
+    ::std::unique_lock __lock{__mutex_};
+    const size_t __epoch = __epoch_;
+    __lock.unlock();
+
+    // Announce that this worker is about to sleep, then look for work once more.
+    // Together with __notify, this ensures that either this worker sees the new
+    // work or the thread that enqueued it sees this worker sleeping.
+    __sleeping_.fetch_add(1, ::std::memory_order_seq_cst);
+    if (__task* __tsk = __find_work(__self))
+    {
+      __sleeping_.fetch_sub(1, ::std::memory_order_relaxed);
+      __tsk->__execute();
+      return true;
+    }
+
+    __lock.lock();
+    const bool __stop = __stop_;
+    __cv_.wait(__lock, [&] {
+      return __stop_ || __epoch_ != __epoch;
+    });
+    __lock.unlock();
+    __sleeping_.fetch_sub(1, ::std::memory_order_relaxed);
+    return !__stop;
+  }
+
+  // Submits a task. A pool worker pushes it onto its own deque, where the other
+  // workers can steal it; any other thread posts it to a worker's inbox.
+  _CUDAX_API void __push(__task* __tsk)
+  {
+    __pool::__this_worker_t& __this_worker = __pool::__this_worker();
+    if (__this_worker.__pool_ == this)
+    {
+      __pool::__worker& __worker = *__workers_[__this_worker.__index_];
+      if (!__worker.__deque_.__push(__tsk))
+      {
+        __worker.__inbox_.__push(__tsk);
+      }
+    }
+    else
+    {
+      const size_t __index = __next_.fetch_add(1, ::std::memory_order_relaxed) % __workers_.size();
+      __workers_[__index]->__inbox_.__push(__tsk);
+    }
+  }
+
+  _CUDAX_API void __enqueue(__task* __tsk)
+  {
+    __push(__tsk);
+    __notify(1);
+  }
+
+  template <class _Task>
+  _CUDAX_API void __enqueue_range(_Task* __tsks, size_t __count)
+  {
+    for (size_t __i = 0; __i < __count; ++__i)
+    {
+      __push(&__tsks[__i]);
+    }
+    __notify(__count);
+  }
+
+  // Wakes up to __count sleeping workers.
+  _CUDAX_API void __notify(size_t __count)
+  {
+    // A read-modify-write rather than a load, so that it is ordered with the
+    // increment in __park.
+    if (__sleeping_.fetch_add(0, ::std::memory_order_seq_cst) == 0)
+    {
+      return;
+    }
+    {
+      ::std::lock_guard __lock{__mutex_};
+      ++__epoch_;
+    }
+    if (__count == 1)
+    {
+      __cv_.notify_one();
+    }
+    else
+    {
+      __cv_.notify_all();
+    }
+  }
+
+  ::std::vector<::std::unique_ptr<__pool::__worker>> __workers_{};
+  ::std::atomic<size_t> __next_{0};
+  ::std::atomic<size_t> __sleeping_{0};
+  ::std::mutex __mutex_{};
+  ::std::condition_variable __cv_{};
+  size_t __epoch_ = 0;
+  bool __stop_    = false;
+};
+
+namespace __pool
+{
+template <class _Rcvr>
+struct __opstate_t : __task
+{
+  using operation_state_concept = operation_state_t;
+  using completion_signatures   = //
+    __async::completion_signatures<set_value_t(), set_error_t(::std::exception_ptr), set_stopped_t()>;
+
+  static_thread_pool* __pool_;
+  _CCCL_NO_UNIQUE_ADDRESS _Rcvr __rcvr_;
+
+  _CUDAX_API static void __execute_impl(__task* __p) noexcept
+  {
+    auto& __rcvr = static_cast<__opstate_t*>(__p)->__rcvr_;
+    _CUDAX_TRY( //
+      ({ //
+        if (get_stop_token(get_env(__rcvr)).stop_requested())
+        {
+          set_stopped(static_cast<_Rcvr&&>(__rcvr));
+        }
+        else
+        {
+          set_value(static_cast<_Rcvr&&>(__rcvr));
+        }
+      }),
+      _CUDAX_CATCH(...)( //
+        { //
+          set_error(static_cast<_Rcvr&&>(__rcvr), ::std::current_exception());
+        }))
+  }
+
+  _CUDAX_API __opstate_t(static_thread_pool* __pool, _Rcvr __rcvr)
+      : __task{nullptr, &__execute_impl}
+      , __pool_{__pool}
+      , __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
+  {}
+
+  _CUDAX_API void start() & noexcept
+  {
+    _CUDAX_TRY( //
+      ({ //
+        __pool_->__enqueue(this); //
+      }), //
+      _CUDAX_CATCH(...)( //
+        { //
+          set_error(static_cast<_Rcvr&&>(__rcvr_), ::std::current_exception()); //
+        })) //
+  }
+};
+
+// One contiguous range of a bulk operation's index space.
+struct __bulk_chunk_t : __task
+{
+  void* __opstate_ = nullptr;
+  size_t __index_  = 0;
+};
+
+// A bulk operation waits for its predecessor, splits the index space into chunks
+// and completes when the last chunk is done. Each chunk calls the chunk function
+// once with its range of indices and the predecessor's values, and decrements the
+// count of remaining chunks once.
+//
+// There are up to __chunks_per_worker chunks per worker, so that the workers that
+// finish early can steal the chunks of the others. When the chunks are large
+// enough, their bounds are multiples of __granule indices, so that neighbouring
+// chunks do not write to the same cache line of arrays indexed by the shape.
+inline constexpr size_t __chunks_per_worker = 4;
+inline constexpr size_t __granule           = 64;
+
+template <class _Rcvr, class _CvSndr, class _Shape, class _Fn>
+struct __bulk_opstate_t
+{
+  _CUDAX_API friend auto get_env(const __bulk_opstate_t* __self) noexcept -> env_of_t<_Rcvr>
+  {
+    return __async::get_env(__self->__rcvr_);
+  }
+
+  template <class... _As>
+  using __set_value_completion = __async::completion_signatures<set_value_t(__decay_t<_As>...)>;
+
+  using operation_state_concept = operation_state_t;
+  using __values_t = __value_types<completion_signatures_of_t<_CvSndr, __bulk_opstate_t*>, __decayed_tuple, __variant>;
+  using completion_signatures = //
+    transform_completion_signatures<completion_signatures_of_t<_CvSndr, __bulk_opstate_t*>,
+                                    __eptr_completion,
+                                    __set_value_completion>;
+
+  _Rcvr __rcvr_;
+  static_thread_pool* __pool_;
+  _Shape __shape_;
+  _Fn __fn_;
+  __values_t __values_{};
+  void (*__run_chunk_)(__bulk_opstate_t*, _Shape, _Shape) = nullptr;
+  void (*__complete_)(__bulk_opstate_t*) noexcept         = nullptr;
+  ::std::unique_ptr<__bulk_chunk_t[]> __chunks_;
+  size_t __granule_;
+  size_t __chunk_count_;
+  ::std::atomic<size_t> __remaining_{0};
+  ::std::atomic<bool> __failed_{false};
+  ::std::exception_ptr __error_{};
+  connect_result_t<_CvSndr, __bulk_opstate_t*> __opstate_;
+
+  _CUDAX_API __bulk_opstate_t(_CvSndr&& __sndr, _Rcvr __rcvr, static_thread_pool* __pool, _Shape __shape, _Fn __fn)
+      : __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
+      , __pool_{__pool}
+      , __shape_{__shape}
+      , __fn_{static_cast<_Fn&&>(__fn)}
+      , __chunks_{}
+      , __granule_{static_cast<size_t>(__shape) >= __max_chunks(__pool) * __granule ? __granule : 1}
+      , __chunk_count_{(::std::min)((static_cast<size_t>(__shape) + __granule_ - 1) / __granule_, __max_chunks(__pool))}
+      , __opstate_{__async::connect(static_cast<_CvSndr&&>(__sndr), this)}
+  {
+    // Allocate the chunks up front so that starting the chunks cannot fail.
+    __chunks_.reset(new __bulk_chunk_t[__chunk_count_]);
+    for (size_t __i = 0; __i < __chunk_count_; ++__i)
+    {
+      __chunks_[__i].__execute_fn_ = &__execute_chunk;
+      __chunks_[__i].__opstate_    = this;
+      __chunks_[__i].__index_      = __i;
+    }
+  }
+
+  _CUDAX_IMMOVABLE(__bulk_opstate_t);
+
+  _CUDAX_API static auto __max_chunks(static_thread_pool* __pool) noexcept -> size_t
+  {
+    return __pool->available_parallelism() * __chunks_per_worker;
+  }
+
+  _CUDAX_API void start() & noexcept
+  {
+    __async::start(__opstate_);
+  }
+
+  template <class _Tupl>
+  _CUDAX_API static void __run_chunk(__bulk_opstate_t* __self, _Shape __begin, _Shape __end)
+  {
+    auto& __tupl = *static_cast<_Tupl*>(__self->__values_.__ptr());
+    __tupl.__apply(__self->__fn_, __tupl, __begin, __end);
+  }
+
+  template <class _Tupl>
+  _CUDAX_API static void __complete(__bulk_opstate_t* __self) noexcept
+  {
+    auto& __tupl = *static_cast<_Tupl*>(__self->__values_.__ptr());
+    __tupl.__apply(__async::set_value, static_cast<_Tupl&&>(__tupl), static_cast<_Rcvr&&>(__self->__rcvr_));
+  }
+
+  _CUDAX_API static void __execute_chunk(__task* __p) noexcept
+  {
+    auto& __chunk = *static_cast<__bulk_chunk_t*>(__p);
+    auto* __self  = static_cast<__bulk_opstate_t*>(__chunk.__opstate_);
+
+    // Split the granules evenly; the first chunks get one granule more than the
+    // others if they do not divide evenly.
+    const size_t __size     = static_cast<size_t>(__self->__shape_);
+    const size_t __granules = (__size + __self->__granule_ - 1) / __self->__granule_;
+    const size_t __base     = __granules / __self->__chunk_count_;
+    const size_t __extra    = __granules % __self->__chunk_count_;
+    const size_t __first    = __chunk.__index_ * __base + (::std::min)(__chunk.__index_, __extra);
+    const size_t __last     = __first + __base + (__chunk.__index_ < __extra ? 1 : 0);
+    const size_t __begin    = __first * __self->__granule_;
+    const size_t __end      = (::std::min)(__last * __self->__granule_, __size);
+
+    if (!__self->__failed_.load(::std::memory_order_relaxed))
+    {
+      _CUDAX_TRY( //
+        ({ //
+          __self->__run_chunk_(__self, static_cast<_Shape>(__begin), static_cast<_Shape>(__end));
+        }),
+        _CUDAX_CATCH(...)( //
+          { //
+            if (!__self->__failed_.exchange(true, ::std::memory_order_relaxed))
+            {
+              __self->__error_ = ::std::current_exception();
+            }
+          }))
+    }
+
+    if (__self->__remaining_.fetch_sub(1, ::std::memory_order_acq_rel) == 1)
+    {
+      __self->__finish();
+    }
+  }
+
+  _CUDAX_API void __finish() noexcept
+  {
+    if (__failed_.load(::std::memory_order_relaxed))
+    {
+      __async::set_error(static_cast<_Rcvr&&>(__rcvr_), static_cast<::std::exception_ptr&&>(__error_));
+    }
+    else
+    {
+      __complete_(this);
+    }
+  }
+
+  template <class... _As>
+  _CUDAX_API void set_value(_As&&... __as) noexcept
+  {
+    using __tupl_t = __decayed_tuple<_As...>;
+    _CUDAX_TRY( //
+      ({ //
+        __values_.template __emplace<__tupl_t>(static_cast<_As&&>(__as)...);
+      }),
+      _CUDAX_CATCH(...)( //
+        { //
+          __async::set_error(static_cast<_Rcvr&&>(__rcvr_), ::std::current_exception());
+          return;
+        }))
+    __run_chunk_ = &__run_chunk<__tupl_t>;
+    __complete_  = &__complete<__tupl_t>;
+
+    if (__chunk_count_ == 0)
+    {
+      __complete_(this);
+      return;
+    }
+
+    __remaining_.store(__chunk_count_, ::std::memory_order_relaxed);
+    if (__chunk_count_ == 1 && __pool::__this_worker().__pool_ == __pool_)
+    {
+      // Nothing to run in parallel, and we are on one of the pool's workers already.
+      __execute_chunk(&__chunks_[0]);
+      return;
+    }
+    // Enqueueing only fails if a mutex cannot be locked. Some chunks may have
+    // started by then, so there is no way to report the failure.
+    __pool_->__enqueue_range(__chunks_.get(), __chunk_count_);
+  }
+
+  template <class _Error>
+  _CUDAX_API void set_error(_Error&& __error) noexcept
+  {
+    __async::set_error(static_cast<_Rcvr&&>(__rcvr_), static_cast<_Error&&>(__error));
+  }
+
+  _CUDAX_API void set_stopped() noexcept
+  {
+    __async::set_stopped(static_cast<_Rcvr&&>(__rcvr_));
+  }
+};
+
+template <class _Sndr, class _Shape, class _Fn>
+struct __bulk_sndr_t
+{
+  using sender_concept = sender_t;
+  static_thread_pool* __pool_;
+  _Shape __shape_;
+  _Fn __fn_;
+  _Sndr __sndr_;
+
+  template <class _Rcvr>
+  _CUDAX_API auto connect(_Rcvr __rcvr) && -> __bulk_opstate_t<_Rcvr, _Sndr, _Shape, _Fn>
+  {
+    return {static_cast<_Sndr&&>(__sndr_), static_cast<_Rcvr&&>(__rcvr), __pool_, __shape_, static_cast<_Fn&&>(__fn_)};
+  }
+
+  template <class _Rcvr>
+  _CUDAX_API auto connect(_Rcvr __rcvr) const& -> __bulk_opstate_t<_Rcvr, const _Sndr&, _Shape, _Fn>
+  {
+    return {__sndr_, static_cast<_Rcvr&&>(__rcvr), __pool_, __shape_, __fn_};
+  }
+
+  _CUDAX_API env_of_t<_Sndr> get_env() const noexcept
+  {
+    return __async::get_env(__sndr_);
+  }
+};
+} // namespace __pool
+
+class static_thread_pool::__scheduler
+{
+  struct __schedule_task
+  {
+    using __t            = __schedule_task;
+    using __id           = __schedule_task;
+    using sender_concept = sender_t;
+
+    template <class _Rcvr>
+    _CUDAX_API auto connect(_Rcvr __rcvr) const noexcept -> __pool::__opstate_t<_Rcvr>
+    {
+      return {__pool_, static_cast<_Rcvr&&>(__rcvr)};
+    }
+
+    struct __env
+    {
+      static_thread_pool* __pool_;
+
+      template <class _Tag>
+      _CUDAX_API auto query(get_completion_scheduler_t<_Tag>) const noexcept -> __scheduler
+      {
+        return __pool_->get_scheduler();
+      }
+    };
+
+    _CUDAX_API auto get_env() const noexcept -> __env
+    {
+      return __env{__pool_};
+    }
+
+  private:
+    friend __scheduler;
+
+    _CUDAX_API explicit __schedule_task(static_thread_pool* __pool) noexcept
+        : __pool_(__pool)
+    {}
+
+    static_thread_pool* const __pool_;
+  };
+
+  friend static_thread_pool;
+
+  _CUDAX_API explicit __scheduler(static_thread_pool* __pool) noexcept
+      : __pool_(__pool)
+  {}
+
+  static_thread_pool* __pool_;
+
+public:
+  using scheduler_concept = scheduler_t;
+
+  [[nodiscard]] _CUDAX_API auto schedule() const noexcept -> __schedule_task
+  {
+    return __schedule_task{__pool_};
+  }
+
+  _CUDAX_API auto query(get_forward_progress_guarantee_t) const noexcept -> forward_progress_guarantee
+  {
+    return forward_progress_guarantee::parallel;
+  }
+
+  //! The pool's bulk customization: once __sndr completes with values __as...,
+  //! calls __fn(__i, __as...) for each __i in [0, __shape) on the pool's workers,
+  //! and then completes with the values.
+  template <class _Sndr, class _Shape, class _Fn>
+  [[nodiscard]] _CUDAX_API auto bulk(_Sndr __sndr, _Shape __shape, _Fn __fn) const
+    -> __pool::__bulk_sndr_t<_Sndr, _Shape, __bulk::__loop_fn<_Fn>>
+  {
+    return {__pool_, __shape, {static_cast<_Fn&&>(__fn)}, static_cast<_Sndr&&>(__sndr)};
+  }
+
+  //! The pool's bulk_chunked customization: like bulk, but calls
+  //! __fn(__begin, __end, __as...) once per chunk of indices.
+  template <class _Sndr, class _Shape, class _Fn>
+  [[nodiscard]] _CUDAX_API auto bulk_chunked(_Sndr __sndr, _Shape __shape, _Fn __fn) const
+    -> __pool::__bulk_sndr_t<_Sndr, _Shape, _Fn>
+  {
+    return {__pool_, __shape, static_cast<_Fn&&>(__fn), static_cast<_Sndr&&>(__sndr)};
+  }
+
+  _CUDAX_API friend bool operator==(const __scheduler& __a, const __scheduler& __b) noexcept
+  {
+    return __a.__pool_ == __b.__pool_;
+  }
+
+  _CUDAX_API friend bool operator!=(const __scheduler& __a, const __scheduler& __b) noexcept
+  {
+    return __a.__pool_ != __b.__pool_;
+  }
+};
+
+_CUDAX_API inline auto static_thread_pool::get_scheduler() noexcept -> __scheduler
+{
+  return __scheduler{this};
+}
+} // namespace cuda::experimental::__async
+
+#  include <cuda/experimental/__async/epilogue.cuh>
+
+#endif // !defined(__CUDA_ARCH__)
+
+#endif
@@ -0,0 +1,293 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDAX__MEMORY_RESOURCE_HOST_MEMORY_POOL
+#define _CUDAX__MEMORY_RESOURCE_HOST_MEMORY_POOL
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if !defined(_CCCL_COMPILER_MSVC_2017)
+
+#  include <cuda/std/__algorithm/max.h>
+#  include <cuda/std/__bit/countr.h>
+#  include <cuda/std/__bit/has_single_bit.h>
+#  include <cuda/std/__bit/integral.h>
+#  include <cuda/std/cstddef>
+#  include <cuda/std/detail/libcxx/include/stdexcept>
+
+#  include <atomic>
+#  include <memory>
+#  include <mutex>
+#  include <new>
+#  include <vector>
+
+#  if defined(__linux__)
+#    include <sys/mman.h>
+#  endif // __linux__
+
+#  if _CCCL_STD_VER >= 2014
+
+//! @file
+//! The \c host_memory_pool class provides a pool of host memory that is divided into size classes.
+namespace cuda::experimental::mr
+{
+
+//! @brief \c host_memory_pool_properties is a wrapper around properties passed to \c host_memory_pool.
+struct host_memory_pool_properties
+{
+  //! @brief Allocations larger than this are not pooled, but passed on to the system allocator. Rounded up to a power
+  //! of two.
+  size_t max_pooled_size = size_t{1} << 20;
+  //! @brief The size of the slabs of memory that the pool divides into blocks of one size class.
+  size_t slab_size = size_t{1} << 18;
+  //! @brief Whether to advise the operating system to back large allocations and the slabs of large size classes with
+  //! huge pages. Small size classes keep slabs of \c slab_size, so that they do not each pin a huge page. This is only
+  //! supported on Linux, and ignored elsewhere.
+  bool use_huge_pages = false;
+};
+
+//! @brief \c host_memory_pool owns slabs of host memory, and keeps the blocks that are not in use on one free list
+//! per size class.
+//!
+//! Size classes are powers of two. An allocation is served from the smallest class that holds both its size and its
+//! alignment, and blocks of a class are aligned to the size of the class. When the free list of a class runs empty,
+//! the pool allocates a new slab for it. Slabs are only released when the pool is destroyed.
+//!
+//! All member functions are thread safe. Every size class has its own lock, so threads that allocate blocks of
+//! different sizes do not contend.
+class host_memory_pool
+{
+private:
+  friend class host_memory_resource;
+
+  //! @brief The size of the smallest size class, which must hold a \c __free_block.
+  static constexpr size_t __min_block_size = 16;
+
+  //! @brief The size of the huge pages that slabs are aligned to when \c use_huge_pages is set.
+  static constexpr size_t __huge_page_size = size_t{2} << 20;
+
+  //! @brief The smallest size class whose slabs span a huge page when \c use_huge_pages is set. A huge page holds
+  //! 64 blocks of this class, so a class that is used at all fills a good part of it.
+  static constexpr size_t __min_huge_page_class_size = __huge_page_size / 64;
+
+  struct __free_block
+  {
+    __free_block* __next_;
+  };
+
+  struct __size_class
+  {
+    ::std::mutex __mutex_{};
+    __free_block* __free_ = nullptr;
+  };
+
+  struct __slab
+  {
+    void* __ptr_;
+    size_t __bytes_;
+    size_t __alignment_;
+  };
+
+  host_memory_pool_properties __properties_;
+  size_t __class_count_;
+  ::std::unique_ptr<__size_class[]> __classes_;
+  ::std::mutex __slabs_mutex_{};
+  ::std::vector<__slab> __slabs_{};
+  ::std::atomic<size_t> __reserved_size_{0};
+
+  //! @brief Returns the size of the class that serves allocations of \p __bytes with \p __alignment.
+  _CCCL_NODISCARD static size_t __class_size(const size_t __bytes, const size_t __alignment) noexcept
+  {
+    return _CUDA_VSTD::bit_ceil((_CUDA_VSTD::max)({__bytes, __alignment, __min_block_size}));
+  }
+
+  _CCCL_NODISCARD static size_t __class_index(const size_t __size) noexcept
+  {
+    return static_cast<size_t>(_CUDA_VSTD::countr_zero(__size) - _CUDA_VSTD::countr_zero(__min_block_size));
+  }
+
+  //! @brief Huge pages are only worth it for allocations that span at least one of them.
+  _CCCL_NODISCARD bool __use_huge_pages(const size_t __bytes) const noexcept
+  {
+    return __properties_.use_huge_pages && __bytes >= __huge_page_size;
+  }
+
+  _CCCL_NODISCARD size_t __upstream_size(const size_t __bytes) const noexcept
+  {
+    return __use_huge_pages(__bytes) ? (__bytes + __huge_page_size - 1) & ~(__huge_page_size - 1) : __bytes;
+  }
+
+  _CCCL_NODISCARD size_t __upstream_alignment(const size_t __bytes, const size_t __alignment) const noexcept
+  {
+    return __use_huge_pages(__bytes) ? (_CUDA_VSTD::max)(__alignment, __huge_page_size) : __alignment;
+  }
+
+  //! @brief Allocates memory that is not pooled from the system allocator.
+  //! @throws std::bad_alloc if the system allocator fails.
+  _CCCL_NODISCARD void* __allocate_upstream(const size_t __bytes, const size_t __alignment) const
+  {
+    const size_t __size = __upstream_size(__bytes);
+    void* __ptr         = ::operator new(__size, ::std::align_val_t{__upstream_alignment(__bytes, __alignment)});
+#    if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (__use_huge_pages(__bytes))
+    {
+      // This is only advice, so there is nothing to do if the kernel does not take it.
+      (void) ::madvise(__ptr, __size, MADV_HUGEPAGE);
+    }
+#    endif // __linux__ && MADV_HUGEPAGE
+    return __ptr;
+  }
+
+  void __deallocate_upstream(void* __ptr, const size_t __bytes, const size_t __alignment) const noexcept
+  {
+    ::operator delete(__ptr, ::std::align_val_t{__upstream_alignment(__bytes, __alignment)});
+  }
+
+  //! @brief Allocates a slab for the size class of blocks of \p __size bytes and puts its blocks on the free list of
+  //! the class. If \c use_huge_pages is set, the slabs of large size classes span at least one huge page.
+  //! @pre The lock of the size class is held.
+  void __refill(__size_class& __class, const size_t __size)
+  {
+    const bool __huge_slab  = __properties_.use_huge_pages && __size >= __min_huge_page_class_size;
+    const size_t __min_slab = __huge_slab ? __huge_page_size : __size;
+    const size_t __bytes    = __upstream_size((_CUDA_VSTD::max)({__properties_.slab_size, __size, __min_slab}));
+    char* __base            = static_cast<char*>(__allocate_upstream(__bytes, __size));
+    try
+    {
+      ::std::lock_guard<::std::mutex> __lock{__slabs_mutex_};
+      __slabs_.push_back(__slab{__base, __bytes, __size});
+    }
+    catch (...)
+    {
+      __deallocate_upstream(__base, __bytes, __size);
+      throw;
+    }
+    __reserved_size_.fetch_add(__bytes, ::std::memory_order_relaxed);
+
+    // Link the blocks from the back, so that they are handed out in address order.
+    for (size_t __offset = __bytes - __bytes % __size; __offset != 0; __offset -= __size)
+    {
+      __class.__free_ = ::new (__base + __offset - __size) __free_block{__class.__free_};
+    }
+  }
+
+  //! @brief Allocates a block that holds at least \p __bytes aligned to \p __alignment.
+  //! @throws std::invalid_argument if \p __alignment is not a power of two.
+  //! @throws std::bad_alloc if the system allocator fails.
+  _CCCL_NODISCARD void* __allocate(const size_t __bytes, const size_t __alignment)
+  {
+    if (!_CUDA_VSTD::has_single_bit(__alignment))
+    {
+      _CUDA_VSTD_NOVERSION::__throw_invalid_argument("Invalid alignment passed to host_memory_resource::allocate.");
+    }
+
+    const size_t __size = __class_size(__bytes, __alignment);
+    if (__size > __properties_.max_pooled_size)
+    {
+      return __allocate_upstream(__bytes, __alignment);
+    }
+
+    __size_class& __class = __classes_[__class_index(__size)];
+    ::std::lock_guard<::std::mutex> __lock{__class.__mutex_};
+    if (__class.__free_ == nullptr)
+    {
+      __refill(__class, __size);
+    }
+    __free_block* __block = __class.__free_;
+    __class.__free_       = __block->__next_;
+    return __block;
+  }
+
+  //! @brief Returns a block to the free list of its size class.
+  void __deallocate(void* __ptr, const size_t __bytes, const size_t __alignment) noexcept
+  {
+    const size_t __size = __class_size(__bytes, __alignment);
+    if (__size > __properties_.max_pooled_size)
+    {
+      __deallocate_upstream(__ptr, __bytes, __alignment);
+      return;
+    }
+
+    __size_class& __class = __classes_[__class_index(__size)];
+    ::std::lock_guard<::std::mutex> __lock{__class.__mutex_};
+    __class.__free_ = ::new (__ptr) __free_block{__class.__free_};
+  }
+
+public:
+  //! @brief Constructs a \c host_memory_pool with the optionally specified properties.
+  //! @param __properties Optional, the properties of the pool.
+  explicit host_memory_pool(host_memory_pool_properties __properties = {})
+      : __properties_(__properties)
+  {
+    __properties_.max_pooled_size = __class_size(__properties_.max_pooled_size, 1);
+    __class_count_                = __class_index(__properties_.max_pooled_size) + 1;
+    __classes_.reset(new __size_class[__class_count_]);
+  }
+
+  host_memory_pool(host_memory_pool const&)            = delete;
+  host_memory_pool(host_memory_pool&&)                 = delete;
+  host_memory_pool& operator=(host_memory_pool const&) = delete;
+  host_memory_pool& operator=(host_memory_pool&&)      = delete;
+
+  //! @brief Destroys the \c host_memory_pool and releases all its slabs.
+  //! @note Blocks that are still in use become invalid. Allocations larger than \c max_pooled_size are not owned by
+  //! the pool and must be deallocated before.
+  ~host_memory_pool() noexcept
+  {
+    for (const __slab& __s : __slabs_)
+    {
+      __deallocate_upstream(__s.__ptr_, __s.__bytes_, __s.__alignment_);
+    }
+  }
+
+  //! @brief Returns the number of bytes that the pool holds in slabs, whether they are in use or not.
+  _CCCL_NODISCARD size_t reserved_size() const noexcept
+  {
+    return __reserved_size_.load(::std::memory_order_relaxed);
+  }
+
+  //! @brief Returns the properties the pool was constructed with, with \c max_pooled_size rounded up.
+  _CCCL_NODISCARD host_memory_pool_properties properties() const noexcept
+  {
+    return __properties_;
+  }
+
+  //! @brief Equality comparison with another \c host_memory_pool.
+  //! @returns true if both are the same pool.
+  _CCCL_NODISCARD bool operator==(host_memory_pool const& __rhs) const noexcept
+  {
+    return this == &__rhs;
+  }
+
+#    if _CCCL_STD_VER <= 2017
+  //! @brief Inequality comparison with another \c host_memory_pool.
+  //! @returns true if both are different pools.
+  _CCCL_NODISCARD bool operator!=(host_memory_pool const& __rhs) const noexcept
+  {
+    return this != &__rhs;
+  }
+#    endif // _CCCL_STD_VER <= 2017
+};
+
+} // namespace cuda::experimental::mr
+
+#  endif // _CCCL_STD_VER >= 2014
+
+#endif // !_CCCL_COMPILER_MSVC_2017
+
+#endif // _CUDAX__MEMORY_RESOURCE_HOST_MEMORY_POOL
@@ -0,0 +1,327 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDAX__MEMORY_RESOURCE_HOST_MEMORY_RESOURCE
+#define _CUDAX__MEMORY_RESOURCE_HOST_MEMORY_RESOURCE
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if !defined(_CCCL_COMPILER_MSVC_2017) && defined(LIBCUDACXX_ENABLE_EXPERIMENTAL_MEMORY_RESOURCE)
+
+#  include <cuda/__memory_resource/get_property.h>
+#  include <cuda/__memory_resource/properties.h>
+#  include <cuda/__memory_resource/resource.h>
+#  include <cuda/__memory_resource/resource_ref.h>
+#  include <cuda/std/__concepts/__concept_macros.h>
+#  include <cuda/std/__exception/cuda_error.h>
+#  include <cuda/std/cstddef>
+#  include <cuda/stream_ref>
+
+#  include <new>
+
+#  include <cuda/experimental/__memory_resource/host_memory_pool.cuh>
+
+#  if _CCCL_STD_VER >= 2014
+
+//! @file
+//! The \c host_memory_resource class provides a memory resource that allocates host memory from a
+//! \c host_memory_pool.
+namespace cuda::experimental::mr
+{
+
+//! @brief The pool used by default constructed \c host_memory_resource objects.
+inline host_memory_pool& __default_host_memory_pool()
+{
+  static host_memory_pool __pool{};
+  return __pool;
+}
+
+//! @rst
+//! .. _cudax-memory-resource-host-pool:
+//!
+//! Pooled host memory resource
+//! ---------------------------
+//!
+//! ``host_memory_resource`` allocates host memory from the size classes of a \c host_memory_pool. It is a thin
+//! wrapper around a pointer to the pool, and satisfies ``cuda::mr::async_resource_with<host_accessible>``, so that
+//! code written against ``resource_ref`` or ``any_async_resource`` can use it where only host memory is needed.
+//!
+//! The pool and the synchronous ``allocate`` and ``deallocate`` only use the system allocator. The stream ordered
+//! overloads take a ``cuda::stream_ref`` like every other async resource, so they need the CUDA runtime:
+//!
+//! * Host memory is usable as soon as it is allocated, so ``allocate_async`` does not touch the stream.
+//! * Work on the stream passed to ``deallocate_async`` may still use the memory, so ``deallocate_async`` enqueues a
+//!   host function with ``cudaLaunchHostFunc`` that returns the memory to the pool once the preceding work on the
+//!   stream is done. It does not wait for the stream.
+//!
+//! .. warning::
+//!
+//!    ``host_memory_resource`` does not own the pool and it is the responsibility of the user to ensure that the
+//!    lifetime of the pool exceeds the lifetime of the ``host_memory_resource``, and of every stream that a
+//!    deallocation was enqueued on with ``deallocate_async``.
+//!
+//! @endrst
+class host_memory_resource
+{
+private:
+  host_memory_pool* __pool_;
+
+  //! @brief A block that \c deallocate_async returns to the pool from a host function on a stream.
+  struct __stream_ordered_deallocation
+  {
+    host_memory_pool* __pool_;
+    void* __ptr_;
+    size_t __bytes_;
+    size_t __alignment_;
+  };
+
+  //! @brief The host function that \c deallocate_async enqueues. The record itself is a block of the pool, too.
+  static void CUDART_CB __deallocate_on_host(void* __data) noexcept
+  {
+    const __stream_ordered_deallocation __record = *static_cast<__stream_ordered_deallocation*>(__data);
+    __record.__pool_->__deallocate(__record.__ptr_, __record.__bytes_, __record.__alignment_);
+    __record.__pool_->__deallocate(
+      __data, sizeof(__stream_ordered_deallocation), alignof(__stream_ordered_deallocation));
+  }
+
+public:
+  //! @brief Default constructs the host_memory_resource using a process wide \c host_memory_pool.
+  host_memory_resource()
+      : __pool_(&__default_host_memory_pool())
+  {}
+
+  //! @brief Constructs the host_memory_resource from a \c host_memory_pool.
+  //! @param __pool The \c host_memory_pool used to allocate memory.
+  explicit host_memory_resource(host_memory_pool& __pool) noexcept
+      : __pool_(&__pool)
+  {}
+
+  //! @brief Allocate host memory of size at least \p __bytes.
+  //! @param __bytes The size in bytes of the allocation.
+  //! @param __alignment The requested alignment of the allocation.
+  //! @throws std::invalid_argument In case of invalid alignment.
+  //! @throws std::bad_alloc If the pool cannot get more memory from the system.
+  //! @returns Pointer to the newly allocated memory.
+  _CCCL_NODISCARD void* allocate(const size_t __bytes,
+                                 const size_t __alignment = _CUDA_VMR::default_cuda_malloc_host_alignment)
+  {
+    return __pool_->__allocate(__bytes, __alignment);
+  }
+
+  //! @brief Deallocate memory pointed to by \p __ptr.
+  //! @param __ptr Pointer to be deallocated. Must have been allocated through a call to `allocate`.
+  //! @param __bytes The number of bytes that was passed to the `allocate` call that returned \p __ptr.
+  //! @param __alignment The alignment that was passed to the `allocate` call that returned \p __ptr.
+  void deallocate(void* __ptr,
+                  const size_t __bytes,
+                  const size_t __alignment = _CUDA_VMR::default_cuda_malloc_host_alignment) noexcept
+  {
+    __pool_->__deallocate(__ptr, __bytes, __alignment);
+  }
+
+  //! @brief Allocate host memory of size at least \p __bytes.
+  //! @param __bytes The size in bytes of the allocation.
+  //! @param __alignment The requested alignment of the allocation.
+  //! @param __stream Stream on which the memory will be used. The memory is usable immediately.
+  //! @throws std::invalid_argument In case of invalid alignment.
+  //! @throws std::bad_alloc If the pool cannot get more memory from the system.
+  //! @returns Pointer to the newly allocated memory.
+  _CCCL_NODISCARD void* allocate_async(const size_t __bytes, const size_t __alignment, const ::cuda::stream_ref __stream)
+  {
+    (void) __stream;
+    return __pool_->__allocate(__bytes, __alignment);
+  }
+
+  //! @brief Allocate host memory of size at least \p __bytes.
+  //! @param __bytes The size in bytes of the allocation.
+  //! @param __stream Stream on which the memory will be used. The memory is usable immediately.
+  //! @throws std::bad_alloc If the pool cannot get more memory from the system.
+  //! @returns Pointer to the newly allocated memory.
+  _CCCL_NODISCARD void* allocate_async(const size_t __bytes, const ::cuda::stream_ref __stream)
+  {
+    return allocate_async(__bytes, _CUDA_VMR::default_cuda_malloc_host_alignment, __stream);
+  }
+
+  //! @brief Deallocate memory pointed to by \p __ptr once the work on \p __stream is done.
+  //! @param __ptr Pointer to be deallocated. Must have been allocated through a call to `allocate_async`.
+  //! @param __bytes The number of bytes that was passed to the `allocate_async` call that returned \p __ptr.
+  //! @param __alignment The alignment that was passed to the `allocate_async` call that returned \p __ptr.
+  //! @param __stream The last stream that uses \p __ptr.
+  //! @throws cuda::cuda_error If the deallocation cannot be enqueued on \p __stream.
+  //! @note The pointer passed to `deallocate_async` must not be in use in a stream other than \p __stream.
+  void deallocate_async(void* __ptr, const size_t __bytes, const size_t __alignment, const ::cuda::stream_ref __stream)
+  {
+    void* __data = nullptr;
+    try
+    {
+      __data = __pool_->__allocate(sizeof(__stream_ordered_deallocation), alignof(__stream_ordered_deallocation));
+    }
+    catch (const ::std::bad_alloc&)
+    {
+      // Without memory for the record there is no host function to enqueue, so fall back to waiting.
+      __stream.wait();
+      __pool_->__deallocate(__ptr, __bytes, __alignment);
+      return;
+    }
+
+    ::new (__data) __stream_ordered_deallocation{__pool_, __ptr, __bytes, __alignment};
+    const ::cudaError_t __status = ::cudaLaunchHostFunc(__stream.get(), &__deallocate_on_host, __data);
+    if (__status != ::cudaSuccess)
+    {
+      ::cudaGetLastError();
+      __pool_->__deallocate(__data, sizeof(__stream_ordered_deallocation), alignof(__stream_ordered_deallocation));
+      ::cuda::__throw_cuda_error(__status, "host_memory_resource::deallocate_async failed to enqueue the deallocation");
+    }
+  }
+
+  //! @brief Deallocate memory pointed to by \p __ptr once the work on \p __stream is done.
+  //! @param __ptr Pointer to be deallocated. Must have been allocated through a call to `allocate_async`.
+  //! @param __bytes The number of bytes that was passed to the `allocate_async` call that returned \p __ptr.
+  //! @param __stream The last stream that uses \p __ptr.
+  //! @throws cuda::cuda_error If the deallocation cannot be enqueued on \p __stream.
+  void deallocate_async(void* __ptr, const size_t __bytes, const ::cuda::stream_ref __stream)
+  {
+    deallocate_async(__ptr, __bytes, _CUDA_VMR::default_cuda_malloc_host_alignment, __stream);
+  }
+
+  //! @brief Equality comparison with another host_memory_resource.
+  //! @returns true if both allocate from the same \c host_memory_pool.
+  _CCCL_NODISCARD constexpr bool operator==(host_memory_resource const& __rhs) const noexcept
+  {
+    return __pool_ == __rhs.__pool_;
+  }
+#    if _CCCL_STD_VER <= 2017
+
+  //! @brief Inequality comparison with another \c host_memory_resource.
+  //! @returns true if both allocate from different \c host_memory_pool objects.
+  _CCCL_NODISCARD constexpr bool operator!=(host_memory_resource const& __rhs) const noexcept
+  {
+    return __pool_ != __rhs.__pool_;
+  }
+#    endif // _CCCL_STD_VER <= 2017
+
+#    if _CCCL_STD_VER >= 2020
+  //! @brief Equality comparison between a \c host_memory_resource and another resource.
+  //! @param __rhs The resource to compare to.
+  //! @returns If the underlying types are equality comparable, returns the result of equality comparison of both
+  //! resources. Otherwise, returns false.
+  _LIBCUDACXX_TEMPLATE(class _Resource)
+  _LIBCUDACXX_REQUIRES((_CUDA_VMR::__different_resource<host_memory_resource, _Resource>) )
+  _CCCL_NODISCARD bool operator==(_Resource const& __rhs) const noexcept
+  {
+    if constexpr (has_property<_Resource, _CUDA_VMR::host_accessible>)
+    {
+      return _CUDA_VMR::resource_ref<_CUDA_VMR::host_accessible>{const_cast<host_memory_resource*>(this)}
+          == _CUDA_VMR::resource_ref<_CUDA_VMR::host_accessible>{const_cast<_Resource&>(__rhs)};
+    }
+    else
+    {
+      return false;
+    }
+  }
+#    else // ^^^ C++20 ^^^ / vvv C++17
+  template <class _Resource>
+  _CCCL_NODISCARD_FRIEND auto operator==(host_memory_resource const& __lhs, _Resource const& __rhs) noexcept
+    _LIBCUDACXX_TRAILING_REQUIRES(bool)(_CUDA_VMR::__different_resource<host_memory_resource, _Resource>&&
+                                          has_property<_Resource, _CUDA_VMR::host_accessible>)
+  {
+    return _CUDA_VMR::resource_ref<_CUDA_VMR::host_accessible>{const_cast<host_memory_resource&>(__lhs)}
+        == _CUDA_VMR::resource_ref<_CUDA_VMR::host_accessible>{const_cast<_Resource&>(__rhs)};
+  }
+
+  template <class _Resource>
+  _CCCL_NODISCARD_FRIEND auto operator==(host_memory_resource const&, _Resource const&) noexcept
+    _LIBCUDACXX_TRAILING_REQUIRES(bool)(_CUDA_VMR::__different_resource<host_memory_resource, _Resource>
+                                        && !has_property<_Resource, _CUDA_VMR::host_accessible>)
+  {
+    return false;
+  }
+
+  template <class _Resource>
+  _CCCL_NODISCARD_FRIEND auto operator==(_Resource const& __rhs, host_memory_resource const& __lhs) noexcept
+    _LIBCUDACXX_TRAILING_REQUIRES(bool)(_CUDA_VMR::__different_resource<host_memory_resource, _Resource>&&
+                                          has_property<_Resource, _CUDA_VMR::host_accessible>)
+  {
+    return _CUDA_VMR::resource_ref<_CUDA_VMR::host_accessible>{const_cast<host_memory_resource&>(__lhs)}
+        == _CUDA_VMR::resource_ref<_CUDA_VMR::host_accessible>{const_cast<_Resource&>(__rhs)};
+  }
+
+  template <class _Resource>
+  _CCCL_NODISCARD_FRIEND auto operator==(_Resource const&, host_memory_resource const&) noexcept
+    _LIBCUDACXX_TRAILING_REQUIRES(bool)(_CUDA_VMR::__different_resource<host_memory_resource, _Resource>
+                                        && !has_property<_Resource, _CUDA_VMR::host_accessible>)
+  {
+    return false;
+  }
+
+  template <class _Resource>
+  _CCCL_NODISCARD_FRIEND auto operator!=(host_memory_resource const& __lhs, _Resource const& __rhs) noexcept
+    _LIBCUDACXX_TRAILING_REQUIRES(bool)(_CUDA_VMR::__different_resource<host_memory_resource, _Resource>&&
+                                          has_property<_Resource, _CUDA_VMR::host_accessible>)
+  {
+    return _CUDA_VMR::resource_ref<_CUDA_VMR::host_accessible>{const_cast<host_memory_resource&>(__lhs)}
+        != _CUDA_VMR::resource_ref<_CUDA_VMR::host_accessible>{const_cast<_Resource&>(__rhs)};
+  }
+
+  template <class _Resource>
+  _CCCL_NODISCARD_FRIEND auto operator!=(host_memory_resource const&, _Resource const&) noexcept
+    _LIBCUDACXX_TRAILING_REQUIRES(bool)(_CUDA_VMR::__different_resource<host_memory_resource, _Resource>
+                                        && !has_property<_Resource, _CUDA_VMR::host_accessible>)
+  {
+    return true;
+  }
+
+  template <class _Resource>
+  _CCCL_NODISCARD_FRIEND auto operator!=(_Resource const& __rhs, host_memory_resource const& __lhs) noexcept
+    _LIBCUDACXX_TRAILING_REQUIRES(bool)(_CUDA_VMR::__different_resource<host_memory_resource, _Resource>&&
+                                          has_property<_Resource, _CUDA_VMR::host_accessible>)
+  {
+    return _CUDA_VMR::resource_ref<_CUDA_VMR::host_accessible>{const_cast<host_memory_resource&>(__lhs)}
+        != _CUDA_VMR::resource_ref<_CUDA_VMR::host_accessible>{const_cast<_Resource&>(__rhs)};
+  }
+
+  template <class _Resource>
+  _CCCL_NODISCARD_FRIEND auto operator!=(_Resource const&, host_memory_resource const&) noexcept
+    _LIBCUDACXX_TRAILING_REQUIRES(bool)(_CUDA_VMR::__different_resource<host_memory_resource, _Resource>
+                                        && !has_property<_Resource, _CUDA_VMR::host_accessible>)
+  {
+    return true;
+  }
+#    endif // _CCCL_STD_VER <= 2017
+
+  //! @brief Returns the \c host_memory_pool the resource allocates from.
+  _CCCL_NODISCARD constexpr host_memory_pool& get() const noexcept
+  {
+    return *__pool_;
+  }
+
+#    ifndef DOXYGEN_SHOULD_SKIP_THIS // Doxygen cannot handle the friend function
+  //! @brief Enables the \c host_accessible property for \c host_memory_resource.
+  //! @relates host_memory_resource
+  friend constexpr void get_property(host_memory_resource const&, _CUDA_VMR::host_accessible) noexcept {}
+#    endif // DOXYGEN_SHOULD_SKIP_THIS
+};
+static_assert(_CUDA_VMR::async_resource_with<host_memory_resource, _CUDA_VMR::host_accessible>, "");
+
+} // namespace cuda::experimental::mr
+
+#  endif // _CCCL_STD_VER >= 2014
+
+#endif // !_CCCL_COMPILER_MSVC_2017 && LIBCUDACXX_ENABLE_EXPERIMENTAL_MEMORY_RESOURCE
+
+#endif //_CUDAX__MEMORY_RESOURCE_HOST_MEMORY_RESOURCE
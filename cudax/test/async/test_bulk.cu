@@ -0,0 +1,214 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/experimental/__async/async.cuh>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "common/checked_receiver.cuh"
+#include "common/utility.cuh"
+#include "testing.cuh"
+
+namespace
+{
+TEST_CASE("bulk simple example", "[adaptors][bulk]")
+{
+  int sum = 0;
+  auto snd = cudax_async::bulk(cudax_async::just(3), 4, [&](int i, int& value) {
+    sum += i * value;
+  });
+  auto op = cudax_async::connect(std::move(snd), checked_value_receiver{3});
+  cudax_async::start(op);
+  CUDAX_CHECK(sum == 18);
+}
+
+TEST_CASE("bulk can be piped", "[adaptors][bulk]")
+{
+  int visits[5] = {};
+  auto snd      = cudax_async::just(1, 2) | cudax_async::bulk(5, [&](int i, int, int) {
+               ++visits[i];
+             });
+  auto op = cudax_async::connect(std::move(snd), checked_value_receiver{1, 2});
+  cudax_async::start(op);
+  for (int visit : visits)
+  {
+    CUDAX_CHECK(visit == 1);
+  }
+}
+
+TEST_CASE("bulk_chunked calls the function once with the whole range by default", "[adaptors][bulk]")
+{
+  int calls = 0;
+  auto snd  = cudax_async::just(42) | cudax_async::bulk_chunked(10, [&](int begin, int end, int value) {
+               CUDAX_CHECK(begin == 0);
+               CUDAX_CHECK(end == 10);
+               CUDAX_CHECK(value == 42);
+               ++calls;
+             });
+  auto op = cudax_async::connect(std::move(snd), checked_value_receiver{42});
+  cudax_async::start(op);
+  CUDAX_CHECK(calls == 1);
+}
+
+TEST_CASE("bulk forwards errors and stopped signals", "[adaptors][bulk]")
+{
+  bool called{false};
+  auto snd1 = cudax_async::just_error(42) | cudax_async::bulk(10, [&](int) {
+                called = true;
+              });
+  auto op1 = cudax_async::connect(std::move(snd1), checked_error_receiver{42});
+  cudax_async::start(op1);
+
+  auto snd2 = cudax_async::just_stopped() | cudax_async::bulk_chunked(10, [&](int, int) {
+                called = true;
+              });
+  auto op2 = cudax_async::connect(std::move(snd2), checked_stopped_receiver{});
+  cudax_async::start(op2);
+  CUDAX_CHECK_FALSE(called);
+}
+
+TEST_CASE("bulk has the right completion signatures", "[adaptors][bulk]")
+{
+  auto nothrow_fn = [](int, int) noexcept {};
+  auto throw_fn   = [](int, int) {};
+  check_value_types<types<int>>(cudax_async::just(1) | cudax_async::bulk(10, nothrow_fn));
+  check_error_types<>(cudax_async::just(1) | cudax_async::bulk(10, nothrow_fn));
+  check_sends_stopped<false>(cudax_async::just(1) | cudax_async::bulk(10, nothrow_fn));
+  check_error_types<::std::exception_ptr>(cudax_async::just(1) | cudax_async::bulk(10, throw_fn));
+}
+
+#if !defined(__CUDA_ARCH__)
+
+TEST_CASE("bulk reports exceptions", "[adaptors][bulk]")
+{
+  auto snd = cudax_async::just() | cudax_async::bulk(10, [](int i) {
+               if (i == 5)
+               {
+                 throw std::runtime_error("bulk failed");
+               }
+             });
+  CHECK_THROWS_AS(cudax_async::sync_wait(std::move(snd)), std::runtime_error);
+}
+
+TEST_CASE("bulk runs in a loop on a thread_context", "[adaptors][bulk]")
+{
+  cudax_async::thread_context context;
+  std::vector<int> data(1000, 1);
+  std::thread::id id{};
+  auto snd = cudax_async::schedule(context.get_scheduler()) //
+           | cudax_async::bulk(1000, [&](int i) {
+               data[i] += i;
+               id = std::this_thread::get_id();
+             });
+  cudax_async::sync_wait(std::move(snd));
+  CUDAX_CHECK(id != std::thread::id{});
+  CUDAX_CHECK(id != std::this_thread::get_id());
+  for (int i = 0; i < 1000; ++i)
+  {
+    CUDAX_CHECK(data[i] == i + 1);
+  }
+}
+
+TEST_CASE("bulk and bulk_chunked dispatch to the static_thread_pool", "[adaptors][bulk][static_thread_pool]")
+{
+  cudax_async::static_thread_pool pool{2};
+  auto sched = pool.get_scheduler();
+  std::vector<std::atomic<int>> visits(1000);
+
+  auto snd1 = cudax_async::schedule(sched) | cudax_async::bulk(1000, [&](int i) {
+                ++visits[i];
+              });
+  cudax_async::sync_wait(std::move(snd1));
+  for (auto& visit : visits)
+  {
+    CUDAX_CHECK(visit == 1);
+  }
+
+  // Catch's assertions are not thread-safe, so collect the chunks and check
+  // them on this thread.
+  std::mutex mutex;
+  std::vector<std::pair<int, int>> chunks;
+  bool on_worker     = true;
+  const auto main_id = std::this_thread::get_id();
+  auto snd2          = cudax_async::schedule(sched) //
+              | cudax_async::bulk_chunked(1000, [&](int begin, int end) {
+                  std::lock_guard<std::mutex> lock{mutex};
+                  chunks.emplace_back(begin, end);
+                  on_worker = on_worker && std::this_thread::get_id() != main_id;
+                });
+  cudax_async::sync_wait(std::move(snd2));
+
+  // The chunks are disjoint and cover the whole range, and there are no more
+  // than four of them per worker.
+  std::sort(chunks.begin(), chunks.end());
+  CUDAX_CHECK(on_worker);
+  CUDAX_CHECK(chunks.size() > 1);
+  CUDAX_CHECK(chunks.size() <= 4 * pool.available_parallelism());
+  int next = 0;
+  for (auto [begin, end] : chunks)
+  {
+    CUDAX_CHECK(begin == next);
+    CUDAX_CHECK(begin < end);
+    next = end;
+  }
+  CUDAX_CHECK(next == 1000);
+}
+
+TEST_CASE("bulk_chunked splits large ranges on cache line boundaries", "[adaptors][bulk][static_thread_pool]")
+{
+  cudax_async::static_thread_pool pool{2};
+  auto sched = pool.get_scheduler();
+  std::mutex mutex;
+  std::vector<int> begins;
+
+  auto snd = cudax_async::schedule(sched) //
+           | cudax_async::bulk_chunked(100000, [&](int begin, int) {
+               std::lock_guard<std::mutex> lock{mutex};
+               begins.push_back(begin);
+             });
+  cudax_async::sync_wait(std::move(snd));
+  CUDAX_CHECK(begins.size() == 4 * pool.available_parallelism());
+  for (int begin : begins)
+  {
+    CUDAX_CHECK(begin % 64 == 0);
+  }
+}
+
+TEST_CASE("bulk dispatches to the scheduler of continue_on", "[adaptors][bulk][static_thread_pool]")
+{
+  cudax_async::static_thread_pool pool{2};
+  std::atomic<int> sum{0};
+  std::atomic<bool> on_main{false};
+  const auto main_id = std::this_thread::get_id();
+
+  auto snd = cudax_async::just(2) //
+           | cudax_async::continue_on(pool.get_scheduler()) //
+           | cudax_async::bulk(100, [&](int i, int value) {
+               sum += i * value;
+               if (std::this_thread::get_id() == main_id)
+               {
+                 on_main = true;
+               }
+             });
+  auto result = cudax_async::sync_wait(std::move(snd));
+  CUDAX_CHECK(result.has_value());
+  CUDAX_CHECK(::cuda::std::get<0>(*result) == 2);
+  CUDAX_CHECK(sum == 9900);
+  CUDAX_CHECK_FALSE(on_main);
+}
+
+#endif // !defined(__CUDA_ARCH__)
+} // namespace
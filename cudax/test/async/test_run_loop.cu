@@ -0,0 +1,143 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/experimental/__async/async.cuh>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "testing.cuh"
+
+// The run loop is host-only.
+#if !defined(__CUDA_ARCH__)
+
+namespace
+{
+// Counts down when the run loop executes it.
+struct countdown_receiver
+{
+  using receiver_concept = cudax_async::receiver_t;
+  std::atomic<int>* remaining;
+
+  void set_value() && noexcept
+  {
+    remaining->fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  template <class Error>
+  void set_error(Error) && noexcept
+  {}
+
+  void set_stopped() && noexcept {}
+};
+
+using run_loop_sender_t = decltype(cudax_async::schedule(cudax_async::run_loop{}.get_scheduler()));
+
+// Operation states are immovable, so construct them in place.
+struct task
+{
+  task(cudax_async::run_loop& loop, std::atomic<int>& remaining)
+      : op{cudax_async::connect(cudax_async::schedule(loop.get_scheduler()), countdown_receiver{&remaining})}
+  {}
+
+  cudax_async::connect_result_t<run_loop_sender_t, countdown_receiver> op;
+};
+
+TEST_CASE("run_loop runs tasks in the order they were scheduled", "[run_loop]")
+{
+  cudax_async::run_loop loop;
+  auto sched = loop.get_scheduler();
+  std::vector<int> order;
+  for (int i = 0; i < 10; ++i)
+  {
+    cudax_async::start_detached(cudax_async::schedule(sched) | cudax_async::then([&order, i] {
+                                  order.push_back(i);
+                                }));
+  }
+  loop.finish();
+  loop.run();
+  const std::vector<int> expected{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  CUDAX_CHECK(order == expected);
+}
+
+TEST_CASE("run_loop returns from run after finish when it is idle", "[run_loop]")
+{
+  cudax_async::run_loop loop;
+  std::thread consumer{[&] {
+    loop.run();
+  }};
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  loop.finish();
+  consumer.join();
+}
+
+TEST_CASE("run_loop runs the tasks of many producers", "[run_loop]")
+{
+  constexpr int producers    = 8;
+  constexpr int per_producer = 1000;
+  cudax_async::run_loop loop;
+  std::atomic<int> remaining{producers * per_producer};
+  std::vector<std::unique_ptr<task>> tasks;
+  for (int i = 0; i < producers * per_producer; ++i)
+  {
+    tasks.push_back(std::make_unique<task>(loop, remaining));
+  }
+
+  std::thread consumer{[&] {
+    loop.run();
+  }};
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; ++p)
+  {
+    threads.emplace_back([&, p] {
+      for (int i = 0; i < per_producer; ++i)
+      {
+        cudax_async::start(tasks[p * per_producer + i]->op);
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  loop.finish();
+  consumer.join();
+  CUDAX_CHECK(remaining == 0);
+}
+
+TEST_CASE("thread_context runs work continued from other threads", "[run_loop]")
+{
+  cudax_async::thread_context context;
+  std::atomic<int> count{0};
+  std::vector<std::thread> threads;
+  for (int p = 0; p < 4; ++p)
+  {
+    threads.emplace_back([&] {
+      for (int i = 0; i < 100; ++i)
+      {
+        cudax_async::sync_wait(cudax_async::just() | cudax_async::continue_on(context.get_scheduler())
+                               | cudax_async::then([&] {
+                                   ++count;
+                                 }));
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  CUDAX_CHECK(count == 400);
+}
+} // namespace
+
+#endif // !defined(__CUDA_ARCH__)
@@ -0,0 +1,159 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/experimental/__async/async.cuh>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "common/checked_receiver.cuh"
+#include "common/utility.cuh"
+#include "testing.cuh"
+
+// The thread pool is host-only.
+#if !defined(__CUDA_ARCH__)
+
+namespace
+{
+TEST_CASE("static_thread_pool runs work on its threads", "[static_thread_pool]")
+{
+  cudax_async::static_thread_pool pool{2};
+  CUDAX_CHECK(pool.available_parallelism() == 2);
+  auto sched = pool.get_scheduler();
+
+  auto snd = cudax_async::schedule(sched) | cudax_async::then([] {
+               return std::this_thread::get_id();
+             });
+  auto result = cudax_async::sync_wait(std::move(snd));
+  CUDAX_CHECK(result.has_value());
+  CUDAX_CHECK(::cuda::std::get<0>(*result) != std::this_thread::get_id());
+}
+
+TEST_CASE("static_thread_pool schedulers compare equal iff they share a pool", "[static_thread_pool]")
+{
+  cudax_async::static_thread_pool pool1{1};
+  cudax_async::static_thread_pool pool2{1};
+  CUDAX_CHECK(pool1.get_scheduler() == pool1.get_scheduler());
+  CUDAX_CHECK(pool1.get_scheduler() != pool2.get_scheduler());
+  CUDAX_CHECK(cudax_async::get_forward_progress_guarantee(pool1.get_scheduler())
+              == cudax_async::forward_progress_guarantee::parallel);
+}
+
+TEST_CASE("static_thread_pool runs the children of when_all", "[static_thread_pool]")
+{
+  cudax_async::static_thread_pool pool{3};
+  auto sched = pool.get_scheduler();
+  auto work  = [sched](int i) {
+    return cudax_async::schedule(sched) | cudax_async::then([i] {
+             return i * i;
+           });
+  };
+  auto snd = cudax_async::when_all(work(1), work(2), work(3), work(4), work(5), work(6), work(7))
+           | cudax_async::then([](int a, int b, int c, int d, int e, int f, int g) {
+               return a + b + c + d + e + f + g;
+             });
+  check_values(std::move(snd), 140);
+}
+
+TEST_CASE("static_thread_pool runs work scheduled from its own threads", "[static_thread_pool]")
+{
+  cudax_async::static_thread_pool pool{2};
+  auto sched = pool.get_scheduler();
+  std::atomic<int> count{0};
+
+  // Each task schedules more work from a worker thread, which goes through the
+  // worker's deque and can be stolen by the other worker.
+  auto snd = cudax_async::schedule(sched) | cudax_async::then([&] {
+               for (int i = 0; i < 100; ++i)
+               {
+                 cudax_async::start_detached(cudax_async::schedule(sched) | cudax_async::then([&] {
+                                               ++count;
+                                             }));
+               }
+             });
+  cudax_async::sync_wait(std::move(snd));
+  pool.join();
+  CUDAX_CHECK(count == 100);
+}
+
+TEST_CASE("static_thread_pool bulk visits each index once", "[static_thread_pool][bulk]")
+{
+  cudax_async::static_thread_pool pool{4};
+  auto sched = pool.get_scheduler();
+  std::vector<std::atomic<int>> visits(1000);
+  std::atomic<bool> values_ok{true};
+
+  // Catch's assertions are not thread-safe, so only check the results on this thread.
+  auto snd = sched.bulk(cudax_async::just(42), 1000, [&](int i, int& value) {
+    if (value != 42)
+    {
+      values_ok = false;
+    }
+    ++visits[i];
+  });
+  check_values(std::move(snd), 42);
+  CUDAX_CHECK(values_ok);
+  for (auto& visit : visits)
+  {
+    CUDAX_CHECK(visit == 1);
+  }
+}
+
+TEST_CASE("static_thread_pool bulk with fewer indices than threads", "[static_thread_pool][bulk]")
+{
+  cudax_async::static_thread_pool pool{4};
+  auto sched = pool.get_scheduler();
+  std::atomic<int> sum{0};
+
+  auto snd1 = sched.bulk(cudax_async::schedule(sched), 2, [&](int i) {
+    sum += i + 1;
+  });
+  check_values(std::move(snd1));
+  CUDAX_CHECK(sum == 3);
+
+  auto snd2 = sched.bulk(cudax_async::just(1, 2), 0, [&](int, int, int) {
+    ++sum;
+  });
+  check_values(std::move(snd2), 1, 2);
+  CUDAX_CHECK(sum == 3);
+}
+
+TEST_CASE("static_thread_pool bulk reports exceptions", "[static_thread_pool][bulk]")
+{
+  cudax_async::static_thread_pool pool{2};
+  auto sched = pool.get_scheduler();
+
+  auto snd = sched.bulk(cudax_async::just(), 100, [](int i) {
+    if (i == 50)
+    {
+      throw std::runtime_error("bulk failed");
+    }
+  });
+  CHECK_THROWS_AS(cudax_async::sync_wait(std::move(snd)), std::runtime_error);
+}
+
+TEST_CASE("static_thread_pool bulk forwards errors", "[static_thread_pool][bulk]")
+{
+  cudax_async::static_thread_pool pool{2};
+  auto sched = pool.get_scheduler();
+  bool called{false};
+
+  auto snd = sched.bulk(cudax_async::just_error(42), 100, [&](int) {
+    called = true;
+  });
+  auto op = cudax_async::connect(std::move(snd), checked_error_receiver{42});
+  cudax_async::start(op);
+  CUDAX_CHECK_FALSE(called);
+}
+} // namespace
+
+#endif // !defined(__CUDA_ARCH__)
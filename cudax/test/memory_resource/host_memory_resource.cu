@@ -0,0 +1,233 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/cstdint>
+#include <cuda/std/type_traits>
+#include <cuda/stream_ref>
+
+#include <cuda/experimental/memory_resource.cuh>
+
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <testing.cuh>
+
+using host_resource = cudax::mr::host_memory_resource;
+
+static_assert(!cuda::std::is_trivially_default_constructible<host_resource>::value, "");
+static_assert(cuda::std::is_default_constructible<host_resource>::value, "");
+static_assert(cuda::std::is_copy_constructible<host_resource>::value, "");
+static_assert(cuda::std::is_move_constructible<host_resource>::value, "");
+static_assert(cuda::std::is_copy_assignable<host_resource>::value, "");
+static_assert(cuda::std::is_move_assignable<host_resource>::value, "");
+static_assert(cuda::std::is_trivially_destructible<host_resource>::value, "");
+static_assert(cuda::mr::async_resource_with<host_resource, cuda::mr::host_accessible>, "");
+static_assert(!cuda::mr::resource_with<host_resource, cuda::mr::device_accessible>, "");
+
+static bool is_aligned(const void* ptr, const size_t alignment)
+{
+  return reinterpret_cast<cuda::std::uintptr_t>(ptr) % alignment == 0;
+}
+
+TEST_CASE("host_memory_resource allocation", "[memory_resource]")
+{
+  cudax::mr::host_memory_pool pool{};
+  host_resource res{pool};
+
+  SECTION("allocate and deallocate")
+  {
+    for (size_t bytes : {size_t{0}, size_t{1}, size_t{42}, size_t{4096}, size_t{100000}})
+    {
+      void* ptr = res.allocate(bytes);
+      CHECK(ptr != nullptr);
+      CHECK(is_aligned(ptr, cuda::mr::default_cuda_malloc_host_alignment));
+      std::memset(ptr, 0xab, bytes);
+      res.deallocate(ptr, bytes);
+    }
+  }
+
+  SECTION("blocks are reused")
+  {
+    void* ptr1 = res.allocate(42);
+    res.deallocate(ptr1, 42);
+    const size_t reserved = pool.reserved_size();
+    void* ptr2            = res.allocate(48);
+    CHECK(ptr1 == ptr2);
+    CHECK(pool.reserved_size() == reserved);
+    res.deallocate(ptr2, 48);
+  }
+
+  SECTION("blocks of a slab are distinct")
+  {
+    std::vector<char*> ptrs;
+    for (int i = 0; i < 1000; ++i)
+    {
+      ptrs.push_back(static_cast<char*>(res.allocate(64)));
+      std::memset(ptrs.back(), i % 128, 64);
+    }
+    for (int i = 0; i < 1000; ++i)
+    {
+      CHECK(ptrs[i][0] == i % 128);
+      CHECK(ptrs[i][63] == i % 128);
+      res.deallocate(ptrs[i], 64);
+    }
+  }
+
+  SECTION("alignment")
+  {
+    for (size_t alignment : {size_t{1}, size_t{64}, size_t{4096}, size_t{65536}})
+    {
+      void* ptr = res.allocate(8, alignment);
+      CHECK(is_aligned(ptr, alignment));
+      res.deallocate(ptr, 8, alignment);
+    }
+    CHECK_THROWS_AS(res.allocate(8, 3), std::invalid_argument);
+  }
+
+  SECTION("large allocations are not pooled")
+  {
+    const size_t reserved = pool.reserved_size();
+    const size_t bytes    = pool.properties().max_pooled_size + 1;
+    void* ptr             = res.allocate(bytes);
+    std::memset(ptr, 0xab, bytes);
+    CHECK(pool.reserved_size() == reserved);
+    res.deallocate(ptr, bytes);
+  }
+
+  SECTION("stream ordered allocation")
+  {
+    cudaStream_t raw_stream;
+    cudaStreamCreate(&raw_stream);
+    cuda::stream_ref stream{raw_stream};
+
+    void* ptr = res.allocate_async(42, stream);
+    CHECK(ptr != nullptr);
+    res.deallocate_async(ptr, 42, stream);
+
+    ptr = res.allocate_async(42, 256, stream);
+    CHECK(is_aligned(ptr, 256));
+    res.deallocate_async(ptr, 42, 256, stream);
+
+    // The block is back in the pool once the stream reached the deallocation
+    cudaStreamSynchronize(raw_stream);
+    void* reused = res.allocate(42, 256);
+    CHECK(reused == ptr);
+    res.deallocate(reused, 42, 256);
+    cudaStreamDestroy(raw_stream);
+  }
+}
+
+TEST_CASE("host_memory_pool properties", "[memory_resource]")
+{
+  SECTION("max_pooled_size is rounded up")
+  {
+    cudax::mr::host_memory_pool pool{{1000}};
+    CHECK(pool.properties().max_pooled_size == 1024);
+
+    host_resource res{pool};
+    void* ptr = res.allocate(1024);
+    CHECK(pool.reserved_size() > 0);
+    res.deallocate(ptr, 1024);
+  }
+
+  SECTION("huge pages")
+  {
+    cudax::mr::host_memory_pool_properties props{};
+    props.use_huge_pages = true;
+    cudax::mr::host_memory_pool pool{props};
+    host_resource res{pool};
+
+    // Small size classes keep their regular slabs
+    void* ptr = res.allocate(42);
+    CHECK(pool.reserved_size() == props.slab_size);
+    res.deallocate(ptr, 42);
+
+    // while large ones get slabs that span huge pages
+    ptr = res.allocate(65536);
+    CHECK(is_aligned(ptr, 65536));
+    CHECK((pool.reserved_size() - props.slab_size) % (size_t{2} << 20) == 0);
+    CHECK(pool.reserved_size() > props.slab_size);
+    res.deallocate(ptr, 65536);
+
+    const size_t bytes = size_t{4} << 20;
+    ptr                = res.allocate(bytes);
+    CHECK(is_aligned(ptr, size_t{2} << 20));
+    std::memset(ptr, 0xab, bytes);
+    res.deallocate(ptr, bytes);
+  }
+}
+
+TEST_CASE("host_memory_resource comparison", "[memory_resource]")
+{
+  cudax::mr::host_memory_pool pool1{};
+  cudax::mr::host_memory_pool pool2{};
+  host_resource first{pool1};
+  host_resource second{pool2};
+
+  CHECK(first == first);
+  CHECK(first == host_resource{pool1});
+  CHECK(first != second);
+  CHECK(host_resource{} == host_resource{});
+  CHECK(&first.get() == &pool1);
+
+  cuda::mr::resource_ref<cuda::mr::host_accessible> ref{first};
+  CHECK(first == ref);
+  CHECK(second != ref);
+}
+
+TEST_CASE("host_memory_resource in an any_async_resource", "[memory_resource]")
+{
+  cudax::mr::host_memory_pool pool{};
+  cudax::mr::any_async_resource<cuda::mr::host_accessible> mr{host_resource{pool}};
+  void* ptr = mr.allocate(42, 16);
+  CHECK(ptr != nullptr);
+  mr.deallocate(ptr, 42, 16);
+  CHECK(pool.reserved_size() > 0);
+}
+
+TEST_CASE("host_memory_resource from many threads", "[memory_resource]")
+{
+  cudax::mr::host_memory_pool pool{};
+  host_resource res{pool};
+  std::atomic<int> errors{0};
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t)
+  {
+    threads.emplace_back([&, t] {
+      std::vector<unsigned char*> ptrs;
+      for (int i = 0; i < 1000; ++i)
+      {
+        const size_t bytes = 16 << (i % 8);
+        ptrs.push_back(static_cast<unsigned char*>(res.allocate(bytes)));
+        std::memset(ptrs.back(), t, bytes);
+      }
+      for (int i = 0; i < 1000; ++i)
+      {
+        const size_t bytes = 16 << (i % 8);
+        if (ptrs[i][0] != t || ptrs[i][bytes - 1] != t)
+        {
+          ++errors;
+        }
+        res.deallocate(ptrs[i], bytes);
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  CHECK(errors == 0);
+}
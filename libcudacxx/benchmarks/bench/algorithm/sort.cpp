@@ -0,0 +1,148 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Compares cuda::std::sort, stable_sort and nth_element on the host with the standard library of the host compiler.
+// The "Impl" axis selects the implementation, and the "Keys" axis either draws the input from the whole range of T
+// or from 16 distinct keys.
+
+#include <cuda/std/__algorithm_>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <host_nvbench.cuh>
+
+using value_types = nvbench::type_list<nvbench::int32_t, nvbench::float64_t>;
+
+template <typename T>
+static std::vector<T> generate(std::size_t elements, const std::string& keys)
+{
+  std::mt19937_64 rng{};
+  std::vector<T> result(elements);
+
+  if (keys == "16")
+  {
+    std::uniform_int_distribution<int> dist{0, 15};
+    for (auto& value : result)
+    {
+      value = static_cast<T>(dist(rng));
+    }
+  }
+  else if constexpr (std::is_floating_point<T>::value)
+  {
+    std::uniform_real_distribution<T> dist{T{-1}, T{1}};
+    for (auto& value : result)
+    {
+      value = dist(rng);
+    }
+  }
+  else
+  {
+    std::uniform_int_distribution<T> dist{std::numeric_limits<T>::lowest(), std::numeric_limits<T>::max()};
+    for (auto& value : result)
+    {
+      value = dist(rng);
+    }
+  }
+
+  return result;
+}
+
+template <typename T, typename StdAlgorithm, typename CudaStdAlgorithm>
+static void run(nvbench::state& state, StdAlgorithm std_algorithm, CudaStdAlgorithm cuda_std_algorithm)
+{
+  const auto elements        = static_cast<std::size_t>(state.get_int64("Elements"));
+  const bool use_std         = state.get_string("Impl") == "std";
+  const std::vector<T> input = generate<T>(elements, state.get_string("Keys"));
+  std::vector<T> vec(elements);
+
+  state.add_element_count(elements);
+  state.add_global_memory_reads<T>(elements);
+  state.add_global_memory_writes<T>(elements);
+
+  state.exec(nvbench::exec_tag::timer | nvbench::exec_tag::sync, [&](nvbench::launch&, auto& timer) {
+    vec = input;
+    timer.start();
+    if (use_std)
+    {
+      std_algorithm(vec.data(), vec.data() + vec.size());
+    }
+    else
+    {
+      cuda_std_algorithm(vec.data(), vec.data() + vec.size());
+    }
+    timer.stop();
+  });
+}
+
+template <typename T>
+static void sort(nvbench::state& state, nvbench::type_list<T>)
+{
+  run<T>(
+    state,
+    [](T* first, T* last) {
+      std::sort(first, last);
+    },
+    [](T* first, T* last) {
+      cuda::std::sort(first, last);
+    });
+}
+
+template <typename T>
+static void stable_sort(nvbench::state& state, nvbench::type_list<T>)
+{
+  run<T>(
+    state,
+    [](T* first, T* last) {
+      std::stable_sort(first, last);
+    },
+    [](T* first, T* last) {
+      cuda::std::stable_sort(first, last);
+    });
+}
+
+template <typename T>
+static void nth_element(nvbench::state& state, nvbench::type_list<T>)
+{
+  run<T>(
+    state,
+    [](T* first, T* last) {
+      std::nth_element(first, first + (last - first) / 2, last);
+    },
+    [](T* first, T* last) {
+      cuda::std::nth_element(first, first + (last - first) / 2, last);
+    });
+}
+
+NVBENCH_BENCH_TYPES(sort, NVBENCH_TYPE_AXES(value_types))
+  .set_name("sort")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 22, 2))
+  .add_string_axis("Keys", {"all", "16"})
+  .add_string_axis("Impl", {"cuda::std", "std"});
+
+NVBENCH_BENCH_TYPES(stable_sort, NVBENCH_TYPE_AXES(value_types))
+  .set_name("stable_sort")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 22, 2))
+  .add_string_axis("Keys", {"all", "16"})
+  .add_string_axis("Impl", {"cuda::std", "std"});
+
+NVBENCH_BENCH_TYPES(nth_element, NVBENCH_TYPE_AXES(value_types))
+  .set_name("nth_element")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 22, 2))
+  .add_string_axis("Keys", {"all", "16"})
+  .add_string_axis("Impl", {"cuda::std", "std"});
@@ -0,0 +1,109 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Runs a transpose and a five point stencil on square matrices of float through the mappings of the mdspan layouts.
+// layout_stride uses the same padded row pitch as layout_right_padded, so the two differ only in the cost of the
+// mapping, while layout_right shows the effect of the padding and layout_tiled the effect of the tiles.
+
+#include <cuda/std/array>
+#include <cuda/std/mdspan>
+
+#include <cstddef>
+#include <vector>
+
+#include <host_nvbench.cuh>
+
+using extents_t = cuda::std::dextents<std::size_t, 2>;
+
+// 16 floats, one cache line
+constexpr std::size_t padding = 16;
+
+using right_padded_t = cuda::std::layout_right_padded<padding>;
+using tiled_t        = cuda::std::layout_tiled<32, 32>;
+
+using layouts = nvbench::type_list<cuda::std::layout_right, cuda::std::layout_stride, right_padded_t, tiled_t>;
+
+NVBENCH_DECLARE_TYPE_STRINGS(cuda::std::layout_right, "right", "layout_right");
+NVBENCH_DECLARE_TYPE_STRINGS(cuda::std::layout_stride, "stride", "layout_stride");
+NVBENCH_DECLARE_TYPE_STRINGS(right_padded_t, "right_padded", "layout_right_padded<16>");
+NVBENCH_DECLARE_TYPE_STRINGS(tiled_t, "tiled", "layout_tiled<32, 32>");
+
+template <typename Layout>
+static typename Layout::template mapping<extents_t> make_mapping(std::size_t n)
+{
+  return typename Layout::template mapping<extents_t>(extents_t{n, n});
+}
+
+template <>
+typename cuda::std::layout_stride::mapping<extents_t> make_mapping<cuda::std::layout_stride>(std::size_t n)
+{
+  const std::size_t pitch = (n + padding - 1) / padding * padding;
+  return cuda::std::layout_stride::mapping<extents_t>(extents_t{n, n}, cuda::std::array<std::size_t, 2>{pitch, 1});
+}
+
+template <typename Layout>
+static void transpose(nvbench::state& state, nvbench::type_list<Layout>)
+{
+  const auto n   = static_cast<std::size_t>(state.get_int64("Size"));
+  const auto in  = make_mapping<Layout>(n);
+  const auto out = make_mapping<Layout>(n);
+
+  std::vector<float> input(in.required_span_size(), 1.0f);
+  std::vector<float> output(out.required_span_size());
+
+  state.add_element_count(n * n);
+  state.add_global_memory_reads<float>(n * n);
+  state.add_global_memory_writes<float>(n * n);
+
+  state.exec([&](nvbench::launch&) {
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      for (std::size_t j = 0; j < n; ++j)
+      {
+        output[out(j, i)] = input[in(i, j)];
+      }
+    }
+  });
+}
+
+template <typename Layout>
+static void stencil(nvbench::state& state, nvbench::type_list<Layout>)
+{
+  const auto n       = static_cast<std::size_t>(state.get_int64("Size"));
+  const auto mapping = make_mapping<Layout>(n);
+
+  std::vector<float> input(mapping.required_span_size(), 1.0f);
+  std::vector<float> output(mapping.required_span_size());
+
+  state.add_element_count((n - 2) * (n - 2));
+  state.add_global_memory_reads<float>(n * n);
+  state.add_global_memory_writes<float>((n - 2) * (n - 2));
+
+  state.exec([&](nvbench::launch&) {
+    for (std::size_t i = 1; i + 1 < n; ++i)
+    {
+      for (std::size_t j = 1; j + 1 < n; ++j)
+      {
+        output[mapping(i, j)] = input[mapping(i - 1, j)] + input[mapping(i + 1, j)] + input[mapping(i, j - 1)]
+                              + input[mapping(i, j + 1)] - 4.0f * input[mapping(i, j)];
+      }
+    }
+  });
+}
+
+NVBENCH_BENCH_TYPES(transpose, NVBENCH_TYPE_AXES(layouts))
+  .set_name("transpose")
+  .set_type_axes_names({"Layout{ct}"})
+  .add_int64_axis("Size", {1000, 1024, 4000, 4096});
+
+NVBENCH_BENCH_TYPES(stencil, NVBENCH_TYPE_AXES(layouts))
+  .set_name("stencil")
+  .set_type_axes_names({"Layout{ct}"})
+  .add_int64_axis("Size", {1000, 1024, 4000, 4096});
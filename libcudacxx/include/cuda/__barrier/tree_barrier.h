@@ -0,0 +1,281 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA___BARRIER_TREE_BARRIER_H
+#define _CUDA___BARRIER_TREE_BARRIER_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if !_CCCL_COMPILER(NVRTC)
+
+#  include <cuda/std/__barrier/empty_completion.h>
+#  include <cuda/std/atomic>
+#  include <cuda/std/cstddef>
+#  include <cuda/std/cstdint>
+#  include <cuda/std/limits>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA
+
+// Threads are spread over the leaves of the tree in the order in which they
+// first touch any tree barrier.
+_CCCL_HIDE_FROM_ABI _CCCL_HOST _CUDA_VSTD::ptrdiff_t __tree_barrier_thread_index()
+{
+  static _CUDA_VSTD::atomic<_CUDA_VSTD::ptrdiff_t> __next_index(0);
+  thread_local _CUDA_VSTD::ptrdiff_t const __index = __next_index.fetch_add(1, _CUDA_VSTD::memory_order_relaxed);
+  return __index;
+}
+
+//! A host barrier for many threads. Arrivals are combined pairwise in a tree of
+//! tickets which each live on their own cache line, so that no cache line is
+//! written by more than two arriving threads per phase, unlike with
+//! `cuda::std::barrier`. Waiting threads are spread over the nodes of a second
+//! tree, which releases them from the root: the arrival that completes the
+//! phase releases the root, and the waiters of every released node release its
+//! children in turn. Nodes without waiters are released by their releaser.
+template <class _CompletionF = _CUDA_VSTD::__empty_completion>
+class tree_barrier
+{
+  // Holds the phase in which the node of the combining tree last completed.
+  // One arrival moves it half a step and the second one a full step.
+  struct alignas(64) __ticket
+  {
+    _CUDA_VSTD::atomic<_CUDA_VSTD::uint32_t> __phase;
+  };
+
+  // Node __i of the release tree releases nodes 2 * __i + 1 and 2 * __i + 2.
+  struct alignas(64) __release_node
+  {
+    _CUDA_VSTD::atomic<_CUDA_VSTD::uint32_t> __wake;
+    _CUDA_VSTD::atomic<_CUDA_VSTD::int32_t> __waiters;
+  };
+
+  // The tickets of all rounds of the combining tree, round after round. Every
+  // round has room for the nodes it needs for the initial arrival count, which
+  // arrive_and_drop only ever lowers.
+  __ticket* __tickets;
+  __release_node* __nodes;
+  _CUDA_VSTD::ptrdiff_t __node_count;
+  _CUDA_VSTD::ptrdiff_t __capacity;
+  _CUDA_VSTD::atomic<_CUDA_VSTD::ptrdiff_t> __expected;
+  _CUDA_VSTD::atomic<_CUDA_VSTD::ptrdiff_t> __expected_adjustment;
+  _CompletionF __completion;
+  alignas(64) _CUDA_VSTD::atomic<_CUDA_VSTD::uint32_t> __phase;
+
+public:
+  using arrival_token = _CUDA_VSTD::uint32_t;
+
+private:
+  _CCCL_HIDE_FROM_ABI _CCCL_HOST static _CUDA_VSTD::ptrdiff_t __ticket_count(_CUDA_VSTD::ptrdiff_t __expected)
+  {
+    _CUDA_VSTD::ptrdiff_t __count = 0;
+    for (; __expected > 1; __expected = (__expected + 1) >> 1)
+    {
+      __count += (__expected + 1) >> 1;
+    }
+    return __count;
+  }
+
+  // Returns true for the arrival which completes the phase.
+  _CCCL_HIDE_FROM_ABI _CCCL_HOST bool __arrive_tree(_CUDA_VSTD::uint32_t __old_phase)
+  {
+    _CUDA_VSTD::uint32_t const __half_step = __old_phase + 1;
+    _CUDA_VSTD::uint32_t const __full_step = __old_phase + 2;
+
+    _CUDA_VSTD::ptrdiff_t __current_expected = __expected.load(_CUDA_VSTD::memory_order_relaxed);
+    if (__current_expected <= 1)
+    {
+      return true;
+    }
+    _CUDA_VSTD::ptrdiff_t __current = __tree_barrier_thread_index() % ((__current_expected + 1) >> 1);
+
+    _CUDA_VSTD::ptrdiff_t __round_capacity = __capacity;
+    __ticket* __round_tickets              = __tickets;
+    while (__current_expected > 1)
+    {
+      _CUDA_VSTD::ptrdiff_t const __end_node  = (__current_expected + 1) >> 1;
+      _CUDA_VSTD::ptrdiff_t const __last_node = __end_node - 1;
+
+      for (;; ++__current)
+      {
+        if (__current == __end_node)
+        {
+          __current = 0;
+        }
+        auto& __ticket                      = __round_tickets[__current].__phase;
+        _CUDA_VSTD::uint32_t __ticket_phase = __old_phase;
+        if (__current == __last_node && (__current_expected & 1))
+        {
+          // the odd node out has a single arrival which moves on alone
+          if (__ticket.compare_exchange_strong(__ticket_phase, __full_step, _CUDA_VSTD::memory_order_acq_rel))
+          {
+            break;
+          }
+        }
+        else if (__ticket.compare_exchange_strong(__ticket_phase, __half_step, _CUDA_VSTD::memory_order_acq_rel))
+        {
+          // the first arrival at a node is done, the second one moves on
+          return false;
+        }
+        else if (__ticket_phase == __half_step)
+        {
+          if (__ticket.compare_exchange_strong(__ticket_phase, __full_step, _CUDA_VSTD::memory_order_acq_rel))
+          {
+            break;
+          }
+        }
+      }
+
+      __round_tickets += (__round_capacity + 1) >> 1;
+      __round_capacity   = (__round_capacity + 1) >> 1;
+      __current_expected = __end_node;
+      __current >>= 1;
+    }
+
+    return true;
+  }
+
+  // Moves node __i of the release tree to __new_phase and releases it, unless
+  // somebody else already did.
+  _CCCL_HIDE_FROM_ABI _CCCL_HOST void __release(_CUDA_VSTD::ptrdiff_t __i, _CUDA_VSTD::uint32_t __new_phase) const
+  {
+    if (__i >= __node_count)
+    {
+      return;
+    }
+    auto& __node                   = __nodes[__i];
+    _CUDA_VSTD::uint32_t __current = __node.__wake.load(_CUDA_VSTD::memory_order_relaxed);
+    do
+    {
+      if (static_cast<_CUDA_VSTD::int32_t>(__new_phase - __current) <= 0)
+      {
+        return;
+      }
+    } while (!__node.__wake.compare_exchange_weak(__current, __new_phase, _CUDA_VSTD::memory_order_seq_cst));
+
+    // Pairs with the registration in wait: either a waiter counted here sees
+    // the new phase and releases the children, or this thread does.
+    if (__node.__waiters.load(_CUDA_VSTD::memory_order_seq_cst) > 0)
+    {
+      __node.__wake.notify_all();
+      return;
+    }
+    __release_children(__i, __new_phase);
+  }
+
+  _CCCL_HIDE_FROM_ABI _CCCL_HOST void
+  __release_children(_CUDA_VSTD::ptrdiff_t __i, _CUDA_VSTD::uint32_t __new_phase) const
+  {
+    __release(2 * __i + 1, __new_phase);
+    __release(2 * __i + 2, __new_phase);
+  }
+
+public:
+  _CCCL_HIDE_FROM_ABI _CCCL_HOST explicit tree_barrier(_CUDA_VSTD::ptrdiff_t __expected,
+                                                       _CompletionF __completion = _CompletionF())
+      : __tickets(nullptr)
+      , __nodes(nullptr)
+      , __node_count(__expected > 1 ? (__expected + 1) >> 1 : 1)
+      , __capacity(__expected)
+      , __expected(__expected)
+      , __expected_adjustment(0)
+      , __completion(__completion)
+      , __phase(0)
+  {
+    _CCCL_ASSERT(__expected >= 0, "Cannot initialize barrier with negative arrival count");
+    _CCCL_ASSERT(__expected <= max(), "Cannot initialize barrier with an arrival count above max()");
+    _CUDA_VSTD::ptrdiff_t const __tickets_size = __ticket_count(__expected);
+    __tickets                                  = new __ticket[__tickets_size];
+    for (_CUDA_VSTD::ptrdiff_t __i = 0; __i < __tickets_size; ++__i)
+    {
+      __tickets[__i].__phase.store(0, _CUDA_VSTD::memory_order_relaxed);
+    }
+    __nodes = new __release_node[__node_count];
+    for (_CUDA_VSTD::ptrdiff_t __i = 0; __i < __node_count; ++__i)
+    {
+      __nodes[__i].__wake.store(0, _CUDA_VSTD::memory_order_relaxed);
+      __nodes[__i].__waiters.store(0, _CUDA_VSTD::memory_order_relaxed);
+    }
+  }
+
+  _CCCL_HIDE_FROM_ABI _CCCL_HOST ~tree_barrier()
+  {
+    delete[] __tickets;
+    delete[] __nodes;
+  }
+
+  tree_barrier(tree_barrier const&)            = delete;
+  tree_barrier& operator=(tree_barrier const&) = delete;
+
+  _CCCL_NODISCARD _CCCL_HIDE_FROM_ABI _CCCL_HOST arrival_token arrive(_CUDA_VSTD::ptrdiff_t __update = 1)
+  {
+    _CCCL_ASSERT(__update > 0, "Arrival count update must be positive");
+    // acquire, so that the arrival count of the previous phase is visible
+    auto const __old_phase = __phase.load(_CUDA_VSTD::memory_order_acquire);
+    for (; __update > 0; --__update)
+    {
+      if (__arrive_tree(__old_phase))
+      {
+        __completion();
+        __expected.fetch_add(__expected_adjustment.exchange(0, _CUDA_VSTD::memory_order_relaxed),
+                             _CUDA_VSTD::memory_order_relaxed);
+        __phase.store(__old_phase + 2, _CUDA_VSTD::memory_order_release);
+        __release(0, __old_phase + 2);
+      }
+    }
+    return __old_phase;
+  }
+  _CCCL_HIDE_FROM_ABI _CCCL_HOST void wait(arrival_token&& __old_phase) const
+  {
+    // The node may still hold an older phase than the token, or may already be
+    // released for a later phase than the next one by the time this runs, so
+    // wait until the node has moved a full step past the token. Every phase the
+    // node moves to while this thread is registered is passed on to its children.
+    _CUDA_VSTD::ptrdiff_t const __i = __tree_barrier_thread_index() % __node_count;
+    auto& __node                    = __nodes[__i];
+    __node.__waiters.fetch_add(1, _CUDA_VSTD::memory_order_seq_cst);
+    _CUDA_VSTD::uint32_t __current = __node.__wake.load(_CUDA_VSTD::memory_order_seq_cst);
+    while (static_cast<_CUDA_VSTD::int32_t>(__current - __old_phase) < 2)
+    {
+      __release_children(__i, __current);
+      __node.__wake.wait(__current, _CUDA_VSTD::memory_order_acquire);
+      __current = __node.__wake.load(_CUDA_VSTD::memory_order_seq_cst);
+    }
+    __node.__waiters.fetch_sub(1, _CUDA_VSTD::memory_order_seq_cst);
+    __release_children(__i, __node.__wake.load(_CUDA_VSTD::memory_order_seq_cst));
+  }
+  _CCCL_HIDE_FROM_ABI _CCCL_HOST void arrive_and_wait()
+  {
+    wait(arrive());
+  }
+  _CCCL_HIDE_FROM_ABI _CCCL_HOST void arrive_and_drop()
+  {
+    __expected_adjustment.fetch_sub(1, _CUDA_VSTD::memory_order_relaxed);
+    (void) arrive();
+  }
+
+  _CCCL_NODISCARD _LIBCUDACXX_HIDE_FROM_ABI static constexpr _CUDA_VSTD::ptrdiff_t max() noexcept
+  {
+    return _CUDA_VSTD::numeric_limits<_CUDA_VSTD::int32_t>::max();
+  }
+};
+
+_LIBCUDACXX_END_NAMESPACE_CUDA
+
+#endif // !_CCCL_COMPILER(NVRTC)
+
+#endif // _CUDA___BARRIER_TREE_BARRIER_H
@@ -0,0 +1,127 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___ALGORITHM_NTH_ELEMENT_H
+#define _LIBCUDACXX___ALGORITHM_NTH_ELEMENT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/comp.h>
+#include <cuda/std/__algorithm/comp_ref_type.h>
+#include <cuda/std/__algorithm/iterator_operations.h>
+#include <cuda/std/__algorithm/partial_sort.h>
+#include <cuda/std/__algorithm/sort.h>
+#include <cuda/std/__bit/integral.h>
+#include <cuda/std/__iterator/iterator_traits.h>
+#include <cuda/std/__type_traits/is_copy_assignable.h>
+#include <cuda/std/__type_traits/is_copy_constructible.h>
+#include <cuda/std/__type_traits/make_unsigned.h>
+#include <cuda/std/__utility/move.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+// Selects with quickselect, which falls back to heap selection when it does not converge, so that it runs in linear
+// time on average and in O(n log n) time in the worst case.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void __nth_element(
+  _RandomAccessIterator __first, _RandomAccessIterator __nth, _RandomAccessIterator __last, _Compare __comp)
+{
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+  using _Unsigned       = make_unsigned_t<difference_type>;
+
+  if (__nth == __last)
+  {
+    return;
+  }
+
+  const difference_type __insertion_sort_limit = 16;
+
+  const difference_type __len = __last - __first;
+  difference_type __depth     = 2 * static_cast<difference_type>(_CUDA_VSTD::__bit_log2(static_cast<_Unsigned>(__len)));
+
+  // unless __leftmost, *(__first - 1) is the pivot of an earlier partition
+  bool __leftmost = true;
+  while (true)
+  {
+    if (__last - __first < __insertion_sort_limit)
+    {
+      if (!_CUDA_VSTD::__sort_small<_AlgPolicy, _Compare>(__first, __last, __comp))
+      {
+        _CUDA_VSTD::__insertion_sort<_AlgPolicy, _Compare>(__first, __last, __comp);
+      }
+      return;
+    }
+
+    if (__depth == 0)
+    {
+      (void) _CUDA_VSTD::__partial_sort<_AlgPolicy>(__first, __nth + 1, __last, __comp);
+      return;
+    }
+    --__depth;
+
+    _CUDA_VSTD::__choose_pivot<_AlgPolicy, _Compare>(__first, __last, __comp);
+
+    // all the elements equal to the smallest element of the range are moved to its left
+    if (!__leftmost && !__comp(*(__first - 1), *__first))
+    {
+      __first = _CUDA_VSTD::__partition_with_equals_on_left<_AlgPolicy, _Compare>(__first, __last, __comp);
+      if (__nth < __first)
+      {
+        return;
+      }
+      continue;
+    }
+
+    const _RandomAccessIterator __pivot =
+      _CUDA_VSTD::__partition_with_equals_on_right<_AlgPolicy, _Compare>(__first, __last, __comp).first;
+    if (__pivot == __nth)
+    {
+      return;
+    }
+    if (__nth < __pivot)
+    {
+      __last = __pivot;
+    }
+    else
+    {
+      __first    = __pivot + 1;
+      __leftmost = false;
+    }
+  }
+}
+
+template <class _RandomAccessIterator, class _Compare>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void nth_element(
+  _RandomAccessIterator __first, _RandomAccessIterator __nth, _RandomAccessIterator __last, _Compare __comp)
+{
+  static_assert(_CCCL_TRAIT(is_copy_constructible, _RandomAccessIterator), "Iterators must be copy constructible.");
+  static_assert(_CCCL_TRAIT(is_copy_assignable, _RandomAccessIterator), "Iterators must be copy assignable.");
+
+  _CUDA_VSTD::__nth_element<_ClassicAlgPolicy, __comp_ref_type<_Compare>>(
+    _CUDA_VSTD::move(__first), _CUDA_VSTD::move(__nth), _CUDA_VSTD::move(__last), __comp);
+}
+
+template <class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void
+nth_element(_RandomAccessIterator __first, _RandomAccessIterator __nth, _RandomAccessIterator __last)
+{
+  _CUDA_VSTD::nth_element(__first, __nth, __last, __less{});
+}
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _LIBCUDACXX___ALGORITHM_NTH_ELEMENT_H
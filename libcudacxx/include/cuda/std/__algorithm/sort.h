@@ -0,0 +1,613 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___ALGORITHM_SORT_H
+#define _LIBCUDACXX___ALGORITHM_SORT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/comp.h>
+#include <cuda/std/__algorithm/comp_ref_type.h>
+#include <cuda/std/__algorithm/iterator_operations.h>
+#include <cuda/std/__algorithm/partial_sort.h>
+#include <cuda/std/__bit/integral.h>
+#include <cuda/std/__iterator/iterator_traits.h>
+#include <cuda/std/__type_traits/integral_constant.h>
+#include <cuda/std/__type_traits/is_arithmetic.h>
+#include <cuda/std/__type_traits/is_copy_assignable.h>
+#include <cuda/std/__type_traits/is_copy_constructible.h>
+#include <cuda/std/__type_traits/is_pointer.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/__type_traits/make_unsigned.h>
+#include <cuda/std/__type_traits/remove_cvref.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/__utility/pair.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+// Arithmetic values in contiguous memory, which are compared with the default comparator, are ordered with
+// conditional moves instead of branches, so that the sorting networks do not suffer from mispredictions.
+template <class _Compare, class _RandomAccessIterator>
+using __use_branchless_sort = integral_constant<
+  bool,
+  _CCCL_TRAIT(is_pointer, _RandomAccessIterator)
+    && _CCCL_TRAIT(is_arithmetic, typename iterator_traits<_RandomAccessIterator>::value_type)
+    && _CCCL_TRAIT(is_same, remove_cvref_t<_Compare>, __less)>;
+
+// Ensures that *__x <= *__y.
+template <class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void
+__cond_swap(_RandomAccessIterator __x, _RandomAccessIterator __y, _Compare __comp)
+{
+  using value_type = typename iterator_traits<_RandomAccessIterator>::value_type;
+  const bool __r   = __comp(*__x, *__y);
+  value_type __tmp = __r ? *__x : *__y;
+  *__y             = __r ? *__y : *__x;
+  *__x             = __tmp;
+}
+
+// Ensures that *__x, *__y and *__z are ordered, given that *__y <= *__z.
+template <class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void __partially_sorted_swap(
+  _RandomAccessIterator __x, _RandomAccessIterator __y, _RandomAccessIterator __z, _Compare __comp)
+{
+  using value_type = typename iterator_traits<_RandomAccessIterator>::value_type;
+  bool __r         = __comp(*__z, *__x);
+  value_type __tmp = __r ? *__z : *__x;
+  *__z             = __r ? *__x : *__z;
+  __r              = __comp(__tmp, *__y);
+  *__x             = __r ? *__x : *__y;
+  *__y             = __r ? *__y : __tmp;
+}
+
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void
+__sort3(_RandomAccessIterator __x, _RandomAccessIterator __y, _RandomAccessIterator __z, _Compare __comp)
+{
+  using _Ops = _IterOps<_AlgPolicy>;
+
+  if (!__comp(*__y, *__x))
+  {
+    if (!__comp(*__z, *__y))
+    {
+      return;
+    }
+    _Ops::iter_swap(__y, __z);
+    if (__comp(*__y, *__x))
+    {
+      _Ops::iter_swap(__x, __y);
+    }
+    return;
+  }
+  if (__comp(*__z, *__y))
+  {
+    _Ops::iter_swap(__x, __z);
+    return;
+  }
+  _Ops::iter_swap(__x, __y);
+  if (__comp(*__z, *__y))
+  {
+    _Ops::iter_swap(__y, __z);
+  }
+}
+
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void __sort3_maybe_branchless(
+  _RandomAccessIterator __x1, _RandomAccessIterator __x2, _RandomAccessIterator __x3, _Compare __comp, false_type)
+{
+  _CUDA_VSTD::__sort3<_AlgPolicy, _Compare>(__x1, __x2, __x3, __comp);
+}
+
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void __sort3_maybe_branchless(
+  _RandomAccessIterator __x1, _RandomAccessIterator __x2, _RandomAccessIterator __x3, _Compare __comp, true_type)
+{
+  _CUDA_VSTD::__cond_swap<_Compare>(__x2, __x3, __comp);
+  _CUDA_VSTD::__partially_sorted_swap<_Compare>(__x1, __x2, __x3, __comp);
+}
+
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void __sort4_maybe_branchless(
+  _RandomAccessIterator __x1,
+  _RandomAccessIterator __x2,
+  _RandomAccessIterator __x3,
+  _RandomAccessIterator __x4,
+  _Compare __comp,
+  false_type)
+{
+  using _Ops = _IterOps<_AlgPolicy>;
+
+  _CUDA_VSTD::__sort3<_AlgPolicy, _Compare>(__x1, __x2, __x3, __comp);
+  if (__comp(*__x4, *__x3))
+  {
+    _Ops::iter_swap(__x3, __x4);
+    if (__comp(*__x3, *__x2))
+    {
+      _Ops::iter_swap(__x2, __x3);
+      if (__comp(*__x2, *__x1))
+      {
+        _Ops::iter_swap(__x1, __x2);
+      }
+    }
+  }
+}
+
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void __sort4_maybe_branchless(
+  _RandomAccessIterator __x1,
+  _RandomAccessIterator __x2,
+  _RandomAccessIterator __x3,
+  _RandomAccessIterator __x4,
+  _Compare __comp,
+  true_type)
+{
+  _CUDA_VSTD::__cond_swap<_Compare>(__x1, __x3, __comp);
+  _CUDA_VSTD::__cond_swap<_Compare>(__x2, __x4, __comp);
+  _CUDA_VSTD::__cond_swap<_Compare>(__x1, __x2, __comp);
+  _CUDA_VSTD::__cond_swap<_Compare>(__x3, __x4, __comp);
+  _CUDA_VSTD::__cond_swap<_Compare>(__x2, __x3, __comp);
+}
+
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void __sort5_maybe_branchless(
+  _RandomAccessIterator __x1,
+  _RandomAccessIterator __x2,
+  _RandomAccessIterator __x3,
+  _RandomAccessIterator __x4,
+  _RandomAccessIterator __x5,
+  _Compare __comp,
+  false_type)
+{
+  using _Ops = _IterOps<_AlgPolicy>;
+
+  _CUDA_VSTD::__sort4_maybe_branchless<_AlgPolicy, _Compare>(__x1, __x2, __x3, __x4, __comp, false_type());
+  if (__comp(*__x5, *__x4))
+  {
+    _Ops::iter_swap(__x4, __x5);
+    if (__comp(*__x4, *__x3))
+    {
+      _Ops::iter_swap(__x3, __x4);
+      if (__comp(*__x3, *__x2))
+      {
+        _Ops::iter_swap(__x2, __x3);
+        if (__comp(*__x2, *__x1))
+        {
+          _Ops::iter_swap(__x1, __x2);
+        }
+      }
+    }
+  }
+}
+
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void __sort5_maybe_branchless(
+  _RandomAccessIterator __x1,
+  _RandomAccessIterator __x2,
+  _RandomAccessIterator __x3,
+  _RandomAccessIterator __x4,
+  _RandomAccessIterator __x5,
+  _Compare __comp,
+  true_type)
+{
+  _CUDA_VSTD::__cond_swap<_Compare>(__x1, __x2, __comp);
+  _CUDA_VSTD::__cond_swap<_Compare>(__x4, __x5, __comp);
+  _CUDA_VSTD::__partially_sorted_swap<_Compare>(__x3, __x4, __x5, __comp);
+  _CUDA_VSTD::__cond_swap<_Compare>(__x2, __x5, __comp);
+  _CUDA_VSTD::__partially_sorted_swap<_Compare>(__x1, __x3, __x4, __comp);
+  _CUDA_VSTD::__partially_sorted_swap<_Compare>(__x2, __x3, __x4, __comp);
+}
+
+// Sorts ranges of at most five elements with a sorting network, and returns false for longer ranges.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 bool
+__sort_small(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  using _Branchless = __use_branchless_sort<_Compare, _RandomAccessIterator>;
+
+  switch (__last - __first)
+  {
+    case 0:
+    case 1:
+      return true;
+    case 2:
+      if (__comp(*--__last, *__first))
+      {
+        _IterOps<_AlgPolicy>::iter_swap(__first, __last);
+      }
+      return true;
+    case 3:
+      _CUDA_VSTD::__sort3_maybe_branchless<_AlgPolicy, _Compare>(
+        __first, __first + 1, __first + 2, __comp, _Branchless());
+      return true;
+    case 4:
+      _CUDA_VSTD::__sort4_maybe_branchless<_AlgPolicy, _Compare>(
+        __first, __first + 1, __first + 2, __first + 3, __comp, _Branchless());
+      return true;
+    case 5:
+      _CUDA_VSTD::__sort5_maybe_branchless<_AlgPolicy, _Compare>(
+        __first, __first + 1, __first + 2, __first + 3, __first + 4, __comp, _Branchless());
+      return true;
+    default:
+      return false;
+  }
+}
+
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void
+__insertion_sort(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  using _Ops       = _IterOps<_AlgPolicy>;
+  using value_type = typename iterator_traits<_RandomAccessIterator>::value_type;
+
+  if (__first == __last)
+  {
+    return;
+  }
+  for (_RandomAccessIterator __i = __first + 1; __i != __last; ++__i)
+  {
+    _RandomAccessIterator __j = __i - 1;
+    if (__comp(*__i, *__j))
+    {
+      value_type __t(_Ops::__iter_move(__i));
+      _RandomAccessIterator __k = __j;
+      __j                       = __i;
+      do
+      {
+        *__j = _Ops::__iter_move(__k);
+        __j  = __k;
+      } while (__j != __first && __comp(__t, *--__k));
+      *__j = _CUDA_VSTD::move(__t);
+    }
+  }
+}
+
+// Like __insertion_sort, but assumes that *(__first - 1) is not greater than any element of the range, so that the
+// inner loop needs no bounds check.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void
+__insertion_sort_unguarded(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  using _Ops       = _IterOps<_AlgPolicy>;
+  using value_type = typename iterator_traits<_RandomAccessIterator>::value_type;
+
+  if (__first == __last)
+  {
+    return;
+  }
+  for (_RandomAccessIterator __i = __first + 1; __i != __last; ++__i)
+  {
+    _RandomAccessIterator __j = __i - 1;
+    if (__comp(*__i, *__j))
+    {
+      value_type __t(_Ops::__iter_move(__i));
+      _RandomAccessIterator __k = __j;
+      __j                       = __i;
+      do
+      {
+        *__j = _Ops::__iter_move(__k);
+        __j  = __k;
+      } while (__comp(__t, *--__k));
+      *__j = _CUDA_VSTD::move(__t);
+    }
+  }
+}
+
+// Tries to sort a nearly sorted range with a limited number of insertions, and returns whether it succeeded.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 bool
+__insertion_sort_incomplete(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  using _Ops       = _IterOps<_AlgPolicy>;
+  using value_type = typename iterator_traits<_RandomAccessIterator>::value_type;
+
+  if (_CUDA_VSTD::__sort_small<_AlgPolicy, _Compare>(__first, __last, __comp))
+  {
+    return true;
+  }
+
+  const unsigned __limit = 8;
+  unsigned __count       = 0;
+  for (_RandomAccessIterator __i = __first + 1; __i != __last; ++__i)
+  {
+    _RandomAccessIterator __j = __i - 1;
+    if (__comp(*__i, *__j))
+    {
+      value_type __t(_Ops::__iter_move(__i));
+      _RandomAccessIterator __k = __j;
+      __j                       = __i;
+      do
+      {
+        *__j = _Ops::__iter_move(__k);
+        __j  = __k;
+      } while (__j != __first && __comp(__t, *--__k));
+      *__j = _CUDA_VSTD::move(__t);
+      if (++__count == __limit)
+      {
+        return ++__i == __last;
+      }
+    }
+  }
+  return true;
+}
+
+// Partitions [__first, __last) around the pivot *__first, placing the elements equal to the pivot on its right.
+// Requires an element not less than the pivot at __last - 1. Returns the final position of the pivot, and whether
+// the range was already partitioned.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 pair<_RandomAccessIterator, bool>
+__partition_with_equals_on_right(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  using _Ops       = _IterOps<_AlgPolicy>;
+  using value_type = typename iterator_traits<_RandomAccessIterator>::value_type;
+
+  const _RandomAccessIterator __begin = __first;
+  value_type __pivot(_Ops::__iter_move(__first));
+
+  // find the first element not less than the pivot, which exists by the precondition
+  do
+  {
+    ++__first;
+  } while (__comp(*__first, __pivot));
+
+  // find the last element less than the pivot, which is guarded by the element found above unless it is the first
+  if (__begin == __first - 1)
+  {
+    while (__first < __last && !__comp(*--__last, __pivot))
+    {
+    }
+  }
+  else
+  {
+    while (!__comp(*--__last, __pivot))
+    {
+    }
+  }
+
+  const bool __already_partitioned = __first >= __last;
+  while (__first < __last)
+  {
+    _Ops::iter_swap(__first, __last);
+    do
+    {
+      ++__first;
+    } while (__comp(*__first, __pivot));
+    do
+    {
+      --__last;
+    } while (!__comp(*__last, __pivot));
+  }
+
+  _RandomAccessIterator __pivot_pos = __first - 1;
+  if (__begin != __pivot_pos)
+  {
+    *__begin = _Ops::__iter_move(__pivot_pos);
+  }
+  *__pivot_pos = _CUDA_VSTD::move(__pivot);
+  return pair<_RandomAccessIterator, bool>(__pivot_pos, __already_partitioned);
+}
+
+// Partitions [__first, __last) around the pivot *__first, placing the elements equal to the pivot on its left, and
+// returns the beginning of the elements greater than the pivot. This handles many equal keys in linear time.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 _RandomAccessIterator
+__partition_with_equals_on_left(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  using _Ops       = _IterOps<_AlgPolicy>;
+  using value_type = typename iterator_traits<_RandomAccessIterator>::value_type;
+
+  const _RandomAccessIterator __begin = __first;
+  value_type __pivot(_Ops::__iter_move(__first));
+
+  if (__comp(__pivot, *(__last - 1)))
+  {
+    while (!__comp(__pivot, *++__first))
+    {
+    }
+  }
+  else
+  {
+    while (++__first < __last && !__comp(__pivot, *__first))
+    {
+    }
+  }
+
+  // guarded by the pivot itself
+  if (__first < __last)
+  {
+    while (__comp(__pivot, *--__last))
+    {
+    }
+  }
+
+  while (__first < __last)
+  {
+    _Ops::iter_swap(__first, __last);
+    while (!__comp(__pivot, *++__first))
+    {
+    }
+    while (__comp(__pivot, *--__last))
+    {
+    }
+  }
+
+  _RandomAccessIterator __pivot_pos = __first - 1;
+  if (__begin != __pivot_pos)
+  {
+    *__begin = _Ops::__iter_move(__pivot_pos);
+  }
+  *__pivot_pos = _CUDA_VSTD::move(__pivot);
+  return __first;
+}
+
+// Moves the median of three, or of three medians of three for long ranges, to __first, and an element not less
+// than it to __last - 1.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void
+__choose_pivot(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+
+  const difference_type __ninther_threshold = 128;
+
+  const difference_type __len      = __last - __first;
+  const difference_type __half_len = __len / 2;
+  if (__len > __ninther_threshold)
+  {
+    _CUDA_VSTD::__sort3<_AlgPolicy, _Compare>(__first, __first + __half_len, __last - 1, __comp);
+    _CUDA_VSTD::__sort3<_AlgPolicy, _Compare>(__first + 1, __first + (__half_len - 1), __last - 2, __comp);
+    _CUDA_VSTD::__sort3<_AlgPolicy, _Compare>(__first + 2, __first + (__half_len + 1), __last - 3, __comp);
+    _CUDA_VSTD::__sort3<_AlgPolicy, _Compare>(
+      __first + (__half_len - 1), __first + __half_len, __first + (__half_len + 1), __comp);
+    _IterOps<_AlgPolicy>::iter_swap(__first, __first + __half_len);
+  }
+  else
+  {
+    _CUDA_VSTD::__sort3<_AlgPolicy, _Compare>(__first + __half_len, __first, __last - 1, __comp);
+  }
+}
+
+// Sorts with quicksort, but falls back to heap sort when the recursion becomes too deep, and to insertion sort for
+// short ranges. Unless __leftmost, *(__first - 1) is the pivot of an earlier partition.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void __introsort(
+  _RandomAccessIterator __first,
+  _RandomAccessIterator __last,
+  _Compare __comp,
+  typename iterator_traits<_RandomAccessIterator>::difference_type __depth,
+  bool __leftmost)
+{
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+
+  const difference_type __insertion_sort_limit = 24;
+
+  while (true)
+  {
+    if (_CUDA_VSTD::__sort_small<_AlgPolicy, _Compare>(__first, __last, __comp))
+    {
+      return;
+    }
+
+    const difference_type __len = __last - __first;
+    if (__len < __insertion_sort_limit)
+    {
+      if (__leftmost)
+      {
+        _CUDA_VSTD::__insertion_sort<_AlgPolicy, _Compare>(__first, __last, __comp);
+      }
+      else
+      {
+        _CUDA_VSTD::__insertion_sort_unguarded<_AlgPolicy, _Compare>(__first, __last, __comp);
+      }
+      return;
+    }
+
+    if (__depth == 0)
+    {
+      (void) _CUDA_VSTD::__partial_sort<_AlgPolicy>(__first, __last, __last, __comp);
+      return;
+    }
+    --__depth;
+
+    _CUDA_VSTD::__choose_pivot<_AlgPolicy, _Compare>(__first, __last, __comp);
+
+    // A pivot equal to the pivot of the preceding partition is the smallest element of the range, so all the
+    // elements equal to it are moved to the left and need no further sorting.
+    if (!__leftmost && !__comp(*(__first - 1), *__first))
+    {
+      __first = _CUDA_VSTD::__partition_with_equals_on_left<_AlgPolicy, _Compare>(__first, __last, __comp);
+      continue;
+    }
+
+    const pair<_RandomAccessIterator, bool> __ret =
+      _CUDA_VSTD::__partition_with_equals_on_right<_AlgPolicy, _Compare>(__first, __last, __comp);
+    const _RandomAccessIterator __pivot = __ret.first;
+
+    // If the range was already partitioned, it may well be sorted already.
+    if (__ret.second)
+    {
+      const bool __left_sorted =
+        _CUDA_VSTD::__insertion_sort_incomplete<_AlgPolicy, _Compare>(__first, __pivot, __comp);
+      if (_CUDA_VSTD::__insertion_sort_incomplete<_AlgPolicy, _Compare>(__pivot + 1, __last, __comp))
+      {
+        if (__left_sorted)
+        {
+          return;
+        }
+        __last = __pivot;
+        continue;
+      }
+      if (__left_sorted)
+      {
+        __first    = __pivot + 1;
+        __leftmost = false;
+        continue;
+      }
+    }
+
+    // recurse into the shorter side, so that the stack depth is logarithmic, and loop on the longer one
+    if (__pivot - __first < __last - __pivot)
+    {
+      _CUDA_VSTD::__introsort<_AlgPolicy, _Compare>(__first, __pivot, __comp, __depth, __leftmost);
+      __first    = __pivot + 1;
+      __leftmost = false;
+    }
+    else
+    {
+      _CUDA_VSTD::__introsort<_AlgPolicy, _Compare>(__pivot + 1, __last, __comp, __depth, false);
+      __last = __pivot;
+    }
+  }
+}
+
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void
+__sort(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+  using _Unsigned       = make_unsigned_t<difference_type>;
+
+  const difference_type __len = __last - __first;
+  if (__len <= 1)
+  {
+    return;
+  }
+
+  const difference_type __depth_limit =
+    2 * static_cast<difference_type>(_CUDA_VSTD::__bit_log2(static_cast<_Unsigned>(__len)));
+  _CUDA_VSTD::__introsort<_AlgPolicy, _Compare>(__first, __last, __comp, __depth_limit, true);
+}
+
+template <class _RandomAccessIterator, class _Compare>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void
+sort(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  static_assert(_CCCL_TRAIT(is_copy_constructible, _RandomAccessIterator), "Iterators must be copy constructible.");
+  static_assert(_CCCL_TRAIT(is_copy_assignable, _RandomAccessIterator), "Iterators must be copy assignable.");
+
+  _CUDA_VSTD::__sort<_ClassicAlgPolicy, __comp_ref_type<_Compare>>(
+    _CUDA_VSTD::move(__first), _CUDA_VSTD::move(__last), __comp);
+}
+
+template <class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void sort(_RandomAccessIterator __first, _RandomAccessIterator __last)
+{
+  _CUDA_VSTD::sort(__first, __last, __less{});
+}
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _LIBCUDACXX___ALGORITHM_SORT_H
@@ -0,0 +1,309 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___ALGORITHM_STABLE_SORT_H
+#define _LIBCUDACXX___ALGORITHM_STABLE_SORT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/comp.h>
+#include <cuda/std/__algorithm/comp_ref_type.h>
+#include <cuda/std/__algorithm/iterator_operations.h>
+#include <cuda/std/__algorithm/lower_bound.h>
+#include <cuda/std/__algorithm/rotate.h>
+#include <cuda/std/__algorithm/sort.h>
+#include <cuda/std/__algorithm/upper_bound.h>
+#include <cuda/std/__iterator/iterator_traits.h>
+#include <cuda/std/__memory/destruct_n.h>
+#include <cuda/std/__memory/temporary_buffer.h>
+#include <cuda/std/__memory/unique_ptr.h>
+#include <cuda/std/__type_traits/integral_constant.h>
+#include <cuda/std/__type_traits/is_copy_assignable.h>
+#include <cuda/std/__type_traits/is_copy_constructible.h>
+#include <cuda/std/__type_traits/is_trivially_copy_assignable.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/__utility/pair.h>
+#include <cuda/std/cstddef>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+// Ranges up to this length are sorted by insertion sort, which moves cheap values faster than merging does.
+template <class _Tp>
+struct __stable_sort_switch : integral_constant<ptrdiff_t, _CCCL_TRAIT(is_trivially_copy_assignable, _Tp) ? 128 : 32>
+{};
+
+// Merges the sorted runs [__first, __middle) and [__middle, __last), moving the shorter one into __buff, which holds
+// at least min(__len1, __len2) elements.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI void __buffered_inplace_merge(
+  _RandomAccessIterator __first,
+  _RandomAccessIterator __middle,
+  _RandomAccessIterator __last,
+  _Compare __comp,
+  typename iterator_traits<_RandomAccessIterator>::difference_type __len1,
+  typename iterator_traits<_RandomAccessIterator>::difference_type __len2,
+  typename iterator_traits<_RandomAccessIterator>::value_type* __buff)
+{
+  using _Ops       = _IterOps<_AlgPolicy>;
+  using value_type = typename iterator_traits<_RandomAccessIterator>::value_type;
+
+  __destruct_n __d(0);
+  unique_ptr<value_type, __destruct_n&> __h(__buff, __d);
+
+  if (__len1 <= __len2)
+  {
+    value_type* __p = __buff;
+    for (_RandomAccessIterator __i = __first; __i != __middle; __d.template __incr<value_type>(), (void) ++__i, ++__p)
+    {
+      ::new ((void*) __p) value_type(_Ops::__iter_move(__i));
+    }
+
+    // merge forwards, taking the left element of equal ones first
+    value_type* __b = __buff;
+    for (; __b != __p; ++__first)
+    {
+      if (__middle == __last)
+      {
+        for (; __b != __p; ++__b, (void) ++__first)
+        {
+          *__first = _CUDA_VSTD::move(*__b);
+        }
+        return;
+      }
+      if (__comp(*__middle, *__b))
+      {
+        *__first = _Ops::__iter_move(__middle);
+        ++__middle;
+      }
+      else
+      {
+        *__first = _CUDA_VSTD::move(*__b);
+        ++__b;
+      }
+    }
+  }
+  else
+  {
+    value_type* __p = __buff;
+    for (_RandomAccessIterator __i = __middle; __i != __last; __d.template __incr<value_type>(), (void) ++__i, ++__p)
+    {
+      ::new ((void*) __p) value_type(_Ops::__iter_move(__i));
+    }
+
+    // merge backwards, taking the right element of equal ones first
+    for (; __p != __buff;)
+    {
+      if (__middle == __first)
+      {
+        for (; __p != __buff;)
+        {
+          *--__last = _CUDA_VSTD::move(*--__p);
+        }
+        return;
+      }
+      if (__comp(*(__p - 1), *(__middle - 1)))
+      {
+        *--__last = _Ops::__iter_move(--__middle);
+      }
+      else
+      {
+        *--__last = _CUDA_VSTD::move(*--__p);
+      }
+    }
+  }
+}
+
+// Merges the sorted runs [__first, __middle) and [__middle, __last) in place. The runs are split and rotated until
+// the shorter one fits into __buff, so that a small buffer costs a logarithmic factor instead of failing.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI void __inplace_merge(
+  _RandomAccessIterator __first,
+  _RandomAccessIterator __middle,
+  _RandomAccessIterator __last,
+  _Compare __comp,
+  typename iterator_traits<_RandomAccessIterator>::difference_type __len1,
+  typename iterator_traits<_RandomAccessIterator>::difference_type __len2,
+  typename iterator_traits<_RandomAccessIterator>::value_type* __buff,
+  ptrdiff_t __buff_size)
+{
+  using _Ops            = _IterOps<_AlgPolicy>;
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+
+  while (true)
+  {
+    if (__len2 == 0)
+    {
+      return;
+    }
+    if (__len1 <= __buff_size || __len2 <= __buff_size)
+    {
+      _CUDA_VSTD::__buffered_inplace_merge<_AlgPolicy, _Compare>(
+        __first, __middle, __last, __comp, __len1, __len2, __buff);
+      return;
+    }
+
+    // skip the leading elements of the left run which are already in place
+    for (; true; ++__first, (void) --__len1)
+    {
+      if (__len1 == 0)
+      {
+        return;
+      }
+      if (__comp(*__middle, *__first))
+      {
+        break;
+      }
+    }
+
+    // split the longer run in half, and the other one at the corresponding position
+    _RandomAccessIterator __m1;
+    _RandomAccessIterator __m2;
+    difference_type __len11;
+    difference_type __len21;
+    if (__len1 < __len2)
+    {
+      __len21 = __len2 / 2;
+      __m2    = __middle + __len21;
+      __m1    = _CUDA_VSTD::upper_bound(__first, __middle, *__m2, __comp);
+      __len11 = __m1 - __first;
+    }
+    else
+    {
+      if (__len1 == 1)
+      {
+        // __len1 >= __len2 && __len2 > 0, so both runs hold a single element, and *__middle < *__first
+        _Ops::iter_swap(__first, __middle);
+        return;
+      }
+      __len11 = __len1 / 2;
+      __m1    = __first + __len11;
+      __m2    = _CUDA_VSTD::lower_bound(__middle, __last, *__m1, __comp);
+      __len21 = __m2 - __middle;
+    }
+    const difference_type __len12 = __len1 - __len11;
+    const difference_type __len22 = __len2 - __len21;
+
+    // [__first, __m1) [__m1, __middle) [__middle, __m2) [__m2, __last) becomes
+    // [__first, __m1) [__middle, __m2) [__m1, __middle) [__m2, __last)
+    __middle = _CUDA_VSTD::__rotate<_AlgPolicy>(__m1, __middle, __m2).first;
+
+    // recurse into the shorter half, and loop on the longer one
+    if (__len11 + __len21 < __len12 + __len22)
+    {
+      _CUDA_VSTD::__inplace_merge<_AlgPolicy, _Compare>(
+        __first, __m1, __middle, __comp, __len11, __len21, __buff, __buff_size);
+      __first  = __middle;
+      __middle = __m2;
+      __len1   = __len12;
+      __len2   = __len22;
+    }
+    else
+    {
+      _CUDA_VSTD::__inplace_merge<_AlgPolicy, _Compare>(
+        __middle, __m2, __last, __comp, __len12, __len22, __buff, __buff_size);
+      __last   = __middle;
+      __middle = __m1;
+      __len1   = __len11;
+      __len2   = __len21;
+    }
+  }
+}
+
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI void __stable_sort(
+  _RandomAccessIterator __first,
+  _RandomAccessIterator __last,
+  _Compare __comp,
+  typename iterator_traits<_RandomAccessIterator>::difference_type __len,
+  typename iterator_traits<_RandomAccessIterator>::value_type* __buff,
+  ptrdiff_t __buff_size)
+{
+  using value_type      = typename iterator_traits<_RandomAccessIterator>::value_type;
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+
+  switch (__len)
+  {
+    case 0:
+    case 1:
+      return;
+    case 2:
+      if (__comp(*--__last, *__first))
+      {
+        _IterOps<_AlgPolicy>::iter_swap(__first, __last);
+      }
+      return;
+  }
+  if (__len <= static_cast<difference_type>(__stable_sort_switch<value_type>::value))
+  {
+    _CUDA_VSTD::__insertion_sort<_AlgPolicy, _Compare>(__first, __last, __comp);
+    return;
+  }
+
+  const difference_type __l2          = __len / 2;
+  const _RandomAccessIterator __middle = __first + __l2;
+  _CUDA_VSTD::__stable_sort<_AlgPolicy, _Compare>(__first, __middle, __comp, __l2, __buff, __buff_size);
+  _CUDA_VSTD::__stable_sort<_AlgPolicy, _Compare>(__middle, __last, __comp, __len - __l2, __buff, __buff_size);
+
+  // the runs need no merging if they are already in order
+  if (!__comp(*__middle, *(__middle - 1)))
+  {
+    return;
+  }
+  _CUDA_VSTD::__inplace_merge<_AlgPolicy, _Compare>(
+    __first, __middle, __last, __comp, __l2, __len - __l2, __buff, __buff_size);
+}
+
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI void
+__stable_sort_impl(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  using value_type      = typename iterator_traits<_RandomAccessIterator>::value_type;
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+
+  const difference_type __len = __last - __first;
+
+  // every merge moves its shorter run, so half of the range is enough to merge without rotations
+  pair<value_type*, ptrdiff_t> __buf(nullptr, 0);
+  unique_ptr<value_type, __return_temporary_buffer> __h;
+  if (__len > static_cast<difference_type>(__stable_sort_switch<value_type>::value))
+  {
+    __buf = _CUDA_VSTD::get_temporary_buffer<value_type>(static_cast<ptrdiff_t>(__len / 2));
+    __h.reset(__buf.first);
+  }
+
+  _CUDA_VSTD::__stable_sort<_AlgPolicy, _Compare>(__first, __last, __comp, __len, __buf.first, __buf.second);
+}
+
+template <class _RandomAccessIterator, class _Compare>
+_LIBCUDACXX_HIDE_FROM_ABI void stable_sort(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  static_assert(_CCCL_TRAIT(is_copy_constructible, _RandomAccessIterator), "Iterators must be copy constructible.");
+  static_assert(_CCCL_TRAIT(is_copy_assignable, _RandomAccessIterator), "Iterators must be copy assignable.");
+
+  _CUDA_VSTD::__stable_sort_impl<_ClassicAlgPolicy, __comp_ref_type<_Compare>>(
+    _CUDA_VSTD::move(__first), _CUDA_VSTD::move(__last), __comp);
+}
+
+template <class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI void stable_sort(_RandomAccessIterator __first, _RandomAccessIterator __last)
+{
+  _CUDA_VSTD::stable_sort(__first, __last, __less{});
+}
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _LIBCUDACXX___ALGORITHM_STABLE_SORT_H
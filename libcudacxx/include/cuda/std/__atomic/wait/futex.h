@@ -0,0 +1,190 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___ATOMIC_WAIT_FUTEX_H
+#define _LIBCUDACXX___ATOMIC_WAIT_FUTEX_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__atomic/order.h>
+#include <cuda/std/__atomic/scopes.h>
+#include <cuda/std/__atomic/types.h>
+#include <cuda/std/__atomic/wait/polling.h>
+#include <cuda/std/__thread/threading_support.h>
+#include <cuda/std/__type_traits/is_same.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+#if defined(_LIBCUDACXX_HAS_FUTEX)
+
+// Host waiters register in a slot of a process wide table hashed by the waited
+// on address, so that notify only enters the kernel when somebody may sleep.
+// Atomics holding a 4 byte value are waited on with a futex on the value
+// itself. Waiters on other atomics sleep on the version of their slot instead,
+// which every notify of the slot bumps.
+struct __atomic_contention_slot
+{
+  alignas(64) int __waiters;
+  int __version;
+};
+
+#  define _LIBCUDACXX_CONTENTION_TABLE_SIZE 256
+
+// Default visibility so that all shared objects of a process share the table.
+_CCCL_VISIBILITY_DEFAULT inline __atomic_contention_slot* __atomic_contention_table() noexcept
+{
+  static __atomic_contention_slot __table[_LIBCUDACXX_CONTENTION_TABLE_SIZE];
+  return __table;
+}
+
+inline __atomic_contention_slot& __atomic_contention_slot_for(void const volatile* __addr) noexcept
+{
+  // Fibonacci hashing spreads neighbouring addresses over the table.
+  const auto __key = static_cast<unsigned long long>(reinterpret_cast<__UINTPTR_TYPE__>(__addr));
+  return __atomic_contention_table()[(__key * 0x9E3779B97F4A7C15ull) >> 56];
+}
+
+template <typename _Sto, __atomic_storage_is_base<_Sto> = 0>
+inline void const volatile* __atomic_wait_address(_Sto const volatile* __a) noexcept
+{
+  return __a->get();
+}
+
+template <typename _Sto, __atomic_storage_is_small<_Sto> = 0>
+inline void const volatile* __atomic_wait_address(_Sto const volatile* __a) noexcept
+{
+  return __a->__a_value.get();
+}
+
+template <typename _Sto, __atomic_storage_is_locked<_Sto> = 0>
+inline void const volatile* __atomic_wait_address(_Sto const volatile* __a) noexcept
+{
+  return &__a->__a_value;
+}
+
+// Only plain storage of 4 byte values can be handed to the futex directly. The
+// proxy word of small storage may change without the value changing.
+template <typename _Sto>
+struct __atomic_waits_on_value
+    : integral_constant<bool,
+                        remove_cvref_t<_Sto>::__tag == __atomic_tag::__atomic_base_tag
+                          && sizeof(__atomic_underlying_remove_cv_t<_Sto>) == sizeof(int)>
+{};
+
+// System scope atomics may be updated by the device or by another process,
+// which never notify the host waiters. Those sleep for a bounded time and
+// recheck the value. The first sleep is short, and every further one doubles
+// up to the longest step of the polling fallback, so that short waits end soon
+// after the update and long ones do not keep the thread busy.
+template <typename _Sco>
+chrono::nanoseconds __atomic_futex_initial_timeout() noexcept
+{
+  return is_same<_Sco, __thread_scope_system_tag>::value ? chrono::nanoseconds(chrono::microseconds(8))
+                                                         : chrono::nanoseconds::zero();
+}
+
+inline chrono::nanoseconds __atomic_futex_next_timeout(chrono::nanoseconds __timeout) noexcept
+{
+  const chrono::nanoseconds __max_timeout = chrono::milliseconds(1);
+  return __timeout < __max_timeout / 2 ? __timeout * 2 : __max_timeout;
+}
+
+template <typename _Tp, typename _Sco>
+void __atomic_try_wait_slow_host(
+  _Tp const volatile* __a, __atomic_underlying_remove_cv_t<_Tp> __val, memory_order __order, _Sco)
+{
+  void const volatile* __addr      = _CUDA_VSTD::__atomic_wait_address(__a);
+  __atomic_contention_slot& __slot = _CUDA_VSTD::__atomic_contention_slot_for(__addr);
+  chrono::nanoseconds __timeout    = _CUDA_VSTD::__atomic_futex_initial_timeout<_Sco>();
+
+  __atomic_fetch_add(&__slot.__waiters, 1, __ATOMIC_SEQ_CST);
+  // Pairs with the fence in __atomic_notify_host: either the notifier sees the
+  // registration or the recheck below sees the new value.
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+  for (;;)
+  {
+    if (__atomic_waits_on_value<_Tp>::value)
+    {
+      int __expected;
+      __builtin_memcpy(&__expected, &__val, sizeof(int));
+      _CUDA_VSTD::__libcpp_futex_wait(static_cast<int const volatile*>(__addr), __expected, __timeout);
+    }
+    else
+    {
+      const int __version = __atomic_load_n(&__slot.__version, __ATOMIC_SEQ_CST);
+      if (__nonatomic_compare_equal(__atomic_load_dispatch(__a, __order, _Sco{}), __val))
+      {
+        _CUDA_VSTD::__libcpp_futex_wait(&__slot.__version, __version, __timeout);
+      }
+    }
+
+    // Waiters that are notified leave after one sleep, the caller rechecks the value.
+    if (__timeout == chrono::nanoseconds::zero()
+        || !__nonatomic_compare_equal(__atomic_load_dispatch(__a, __order, _Sco{}), __val))
+    {
+      break;
+    }
+    __timeout = _CUDA_VSTD::__atomic_futex_next_timeout(__timeout);
+  }
+
+  __atomic_fetch_sub(&__slot.__waiters, 1, __ATOMIC_RELAXED);
+}
+
+template <typename _Tp>
+void __atomic_notify_host(_Tp const volatile* __a, bool __all)
+{
+  void const volatile* __addr       = _CUDA_VSTD::__atomic_wait_address(__a);
+  __atomic_contention_slot& __slot = _CUDA_VSTD::__atomic_contention_slot_for(__addr);
+
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  if (__atomic_load_n(&__slot.__waiters, __ATOMIC_RELAXED) == 0)
+  {
+    return;
+  }
+
+  if (__atomic_waits_on_value<_Tp>::value)
+  {
+    _CUDA_VSTD::__libcpp_futex_wake(static_cast<int const volatile*>(__addr), __all ? INT_MAX : 1);
+  }
+  else
+  {
+    // Unrelated waiters may share the slot, so all of them are woken to recheck.
+    __atomic_fetch_add(&__slot.__version, 1, __ATOMIC_RELEASE);
+    _CUDA_VSTD::__libcpp_futex_wake(&__slot.__version, INT_MAX);
+  }
+}
+
+#else // ^^^ _LIBCUDACXX_HAS_FUTEX ^^^ / vvv !_LIBCUDACXX_HAS_FUTEX vvv
+
+template <typename _Tp, typename _Sco>
+_CCCL_HOST_DEVICE void __atomic_try_wait_slow_host(
+  _Tp const volatile* __a, __atomic_underlying_remove_cv_t<_Tp> __val, memory_order __order, _Sco)
+{
+  __atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
+}
+
+template <typename _Tp>
+_CCCL_HOST_DEVICE void __atomic_notify_host(_Tp const volatile*, bool)
+{}
+
+#endif // !_LIBCUDACXX_HAS_FUTEX
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _LIBCUDACXX___ATOMIC_WAIT_FUTEX_H
@@ -28,6 +28,16 @@
 
 _LIBCUDACXX_BEGIN_NAMESPACE_STD
 
+template <typename _Tp>
+_LIBCUDACXX_HIDE_FROM_ABI bool __nonatomic_compare_equal(_Tp const& __lhs, _Tp const& __rhs)
+{
+#if defined(_CCCL_CUDA_COMPILER)
+  return __lhs == __rhs;
+#else
+  return memcmp(&__lhs, &__rhs, sizeof(_Tp)) == 0;
+#endif
+}
+
 template <typename _Tp, typename _Sco>
 struct __atomic_poll_tester
 {
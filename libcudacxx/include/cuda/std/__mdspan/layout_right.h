@@ -172,6 +172,27 @@ public:
                  }))
   }
 
+  _LIBCUDACXX_TEMPLATE(class _OtherMapping)
+  _LIBCUDACXX_REQUIRES(__detail::__is_layout_right_padded_mapping<_OtherMapping>::value _LIBCUDACXX_AND _CCCL_TRAIT(
+    _CUDA_VSTD::is_constructible, extents_type, typename _OtherMapping::extents_type))
+  __MDSPAN_CONDITIONAL_EXPLICIT(
+    (!_CUDA_VSTD::is_convertible<typename _OtherMapping::extents_type, extents_type>::value)) // needs two () due
+                                                                                              // to comma
+  _LIBCUDACXX_HIDE_FROM_ABI constexpr mapping(
+    _OtherMapping const& __other) noexcept // NOLINT(google-explicit-constructor)
+      : __extents(__other.extents())
+  {
+    using _OtherExtents = typename _OtherMapping::extents_type;
+    static_assert(extents_type::rank() <= 1 || _OtherMapping::padding_value == dynamic_extent
+                    || _OtherExtents::static_extent(_OtherExtents::rank() - 1) == dynamic_extent
+                    || _OtherExtents::static_extent(_OtherExtents::rank() - 1) % _OtherMapping::padding_value == 0,
+                  "the rightmost extent of the layout_right_padded mapping must be a multiple of its padding value.");
+    /*
+     * TODO: check precondition
+     * __other.is_exhaustive() is true
+     */
+  }
+
   _CCCL_HIDE_FROM_ABI __MDSPAN_CONSTEXPR_14_DEFAULTED mapping& operator=(mapping const&) noexcept = default;
 
   _LIBCUDACXX_HIDE_FROM_ABI constexpr const extents_type& extents() const noexcept
@@ -0,0 +1,316 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___MDSPAN_LAYOUT_RIGHT_PADDED_HPP
+#define _LIBCUDACXX___MDSPAN_LAYOUT_RIGHT_PADDED_HPP
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__mdspan/dynamic_extent.h>
+#include <cuda/std/__mdspan/extents.h>
+#include <cuda/std/__mdspan/layout_right.h>
+#include <cuda/std/__mdspan/layout_stride.h>
+#include <cuda/std/__mdspan/macros.h>
+#include <cuda/std/__type_traits/integral_constant.h>
+#include <cuda/std/__type_traits/is_constructible.h>
+#include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/__type_traits/is_nothrow_constructible.h>
+#include <cuda/std/cstddef>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+#if _CCCL_STD_VER > 2011
+
+//==============================================================================
+
+// The element (i0, ..., in-1, in) is at offset ((i0 * E(1) + i1) * ... + in-1) * S + in, where the padded stride S is
+// the smallest multiple of the padding value that is not less than E(n).
+template <size_t _PaddingValue>
+template <class _Extents>
+class layout_right_padded<_PaddingValue>::mapping
+{
+public:
+  static constexpr size_t padding_value = _PaddingValue;
+
+  using extents_type = _Extents;
+  using index_type   = typename extents_type::index_type;
+  using size_type    = typename extents_type::size_type;
+  using rank_type    = typename extents_type::rank_type;
+  using layout_type  = layout_right_padded<_PaddingValue>;
+
+private:
+  static_assert(__detail::__is_extents_v<extents_type>,
+                "layout_right_padded::mapping must be instantiated with a specialization of _CUDA_VSTD::extents.");
+  static_assert(padding_value == dynamic_extent || padding_value > 0,
+                "layout_right_padded requires a positive padding value.");
+
+  static constexpr rank_type __rank = extents_type::rank();
+
+  static constexpr size_t __static_padded_stride =
+    __detail::__static_padded_stride(padding_value, extents_type::static_extent(extents_type::rank() - 1));
+
+  using __padded_stride_type = _CUDA_VSTD::extents<index_type, __static_padded_stride>;
+
+  // ((i0 * E(1) + i1) * E(2) + i2) * S + i3
+  template <size_t _r, size_t _Rank>
+  struct __rank_count
+  {};
+
+  template <size_t _r>
+  _CCCL_HOST_DEVICE constexpr index_type __stride_factor() const noexcept
+  {
+    return _r == __rank - 1 ? __padded_stride.template __extent<0>() : __extents.template __extent<_r>();
+  }
+
+  template <size_t _r, size_t _Rank, class _Ip, class... _Indices>
+  _CCCL_HOST_DEVICE constexpr index_type
+  __compute_offset(index_type __offset, __rank_count<_r, _Rank>, const _Ip& __i, _Indices... __idx) const
+  {
+    return __compute_offset(__offset * __stride_factor<_r>() + __i, __rank_count<_r + 1, _Rank>(), __idx...);
+  }
+
+  template <class _Ip, class... _Indices>
+  _CCCL_HOST_DEVICE constexpr index_type
+  __compute_offset(__rank_count<0, extents_type::rank()>, const _Ip& __i, _Indices... __idx) const
+  {
+    return __compute_offset(__i, __rank_count<1, extents_type::rank()>(), __idx...);
+  }
+
+  _CCCL_HOST_DEVICE constexpr index_type
+  __compute_offset(index_type __offset, __rank_count<extents_type::rank(), extents_type::rank()>) const
+  {
+    return __offset;
+  }
+
+  _CCCL_HOST_DEVICE constexpr index_type __compute_offset(__rank_count<0, 0>) const
+  {
+    return 0;
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI static constexpr index_type __padded_extent(const extents_type& __exts) noexcept
+  {
+    return __rank == 0 ? 0 : __exts.extent(__rank - 1);
+  }
+
+  template <class _OtherIndexType>
+  _LIBCUDACXX_HIDE_FROM_ABI static constexpr index_type
+  __make_padded_stride(const extents_type& __exts, _OtherIndexType __pad) noexcept
+  {
+    return static_cast<index_type>(
+      __detail::__least_multiple_at_least(static_cast<size_t>(__pad), static_cast<size_t>(__padded_extent(__exts))));
+  }
+
+  // The padded stride is the stride of the second to last dimension, which only exists from rank 2 on
+  template <class _OtherMapping>
+  _LIBCUDACXX_HIDE_FROM_ABI static constexpr index_type
+  __padded_stride_of(true_type, const _OtherMapping& __other, const extents_type&) noexcept
+  {
+    return static_cast<index_type>(__other.stride(__rank - 2));
+  }
+
+  template <class _OtherMapping>
+  _LIBCUDACXX_HIDE_FROM_ABI static constexpr index_type
+  __padded_stride_of(false_type, const _OtherMapping&, const extents_type& __exts) noexcept
+  {
+    return __padded_extent(__exts);
+  }
+
+  _CCCL_HOST_DEVICE constexpr index_type __stride(rank_type __i) const noexcept
+  {
+    if (__i == __rank - 1)
+    {
+      return 1;
+    }
+    index_type __value = __padded_stride.template __extent<0>();
+    for (rank_type __r = __i + 1; __r < __rank - 1; ++__r)
+    {
+      __value *= __extents.extent(__r);
+    }
+    return __value;
+  }
+
+public:
+  //--------------------------------------------------------------------------------
+
+  _LIBCUDACXX_HIDE_FROM_ABI constexpr mapping() noexcept
+      : mapping(extents_type{})
+  {}
+  _CCCL_HIDE_FROM_ABI constexpr mapping(mapping const&) noexcept = default;
+
+  // Without a padding value the rightmost extent is not padded
+  _LIBCUDACXX_HIDE_FROM_ABI constexpr mapping(extents_type const& __exts) noexcept
+      : __extents(__exts)
+      , __padded_stride(__make_padded_stride(__exts, padding_value == dynamic_extent ? 0 : padding_value))
+  {}
+
+  _LIBCUDACXX_TEMPLATE(class _OtherIndexType)
+  _LIBCUDACXX_REQUIRES(_CCCL_TRAIT(_CUDA_VSTD::is_convertible, _OtherIndexType, index_type)
+                         _LIBCUDACXX_AND _CCCL_TRAIT(_CUDA_VSTD::is_nothrow_constructible, index_type, _OtherIndexType))
+  _LIBCUDACXX_HIDE_FROM_ABI constexpr mapping(extents_type const& __exts, _OtherIndexType __pad) noexcept
+      : __extents(__exts)
+      , __padded_stride(__make_padded_stride(__exts, static_cast<index_type>(__pad)))
+  {
+    /*
+     * TODO: check preconditions
+     * - __pad is positive and equal to padding_value unless padding_value is dynamic_extent
+     */
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _OtherExtents)
+  _LIBCUDACXX_REQUIRES(_CCCL_TRAIT(_CUDA_VSTD::is_constructible, extents_type, _OtherExtents))
+  __MDSPAN_CONDITIONAL_EXPLICIT((!_CUDA_VSTD::is_convertible<_OtherExtents, extents_type>::value)) // needs two () due
+                                                                                                   // to comma
+  _LIBCUDACXX_HIDE_FROM_ABI constexpr mapping(
+    layout_right::mapping<_OtherExtents> const& __other) noexcept // NOLINT(google-explicit-constructor)
+      : __extents(__other.extents())
+      , __padded_stride(__padded_extent(__extents))
+  {
+    static_assert(__rank <= 1 || _OtherExtents::static_extent(__rank - 1) == dynamic_extent
+                    || padding_value == dynamic_extent || _OtherExtents::static_extent(__rank - 1) % padding_value == 0,
+                  "the rightmost extent of the layout_right mapping must be a multiple of the padding value.");
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _OtherExtents)
+  _LIBCUDACXX_REQUIRES(_CCCL_TRAIT(_CUDA_VSTD::is_constructible, extents_type, _OtherExtents))
+  __MDSPAN_CONDITIONAL_EXPLICIT((extents_type::rank() > 0))
+  _LIBCUDACXX_HIDE_FROM_ABI constexpr mapping(
+    layout_stride::mapping<_OtherExtents> const& __other) // NOLINT(google-explicit-constructor)
+      : __extents(__other.extents())
+      , __padded_stride(__padded_stride_of(integral_constant<bool, (__rank > 1)>(), __other, __extents))
+  {
+    /*
+     * TODO: check preconditions
+     * - __other.stride(n) == 1 and __other.stride(r) == __other.stride(n - 1) * E(r + 1) * ... * E(n - 1)
+     * - __other.stride(n - 1) is a multiple of padding_value unless padding_value is dynamic_extent
+     */
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _OtherMapping)
+  _LIBCUDACXX_REQUIRES(__detail::__is_layout_right_padded_mapping<_OtherMapping>::value _LIBCUDACXX_AND _CCCL_TRAIT(
+    _CUDA_VSTD::is_constructible, extents_type, typename _OtherMapping::extents_type))
+  __MDSPAN_CONDITIONAL_EXPLICIT(
+    ((extents_type::rank() > 1
+      && (padding_value != dynamic_extent && _OtherMapping::padding_value == dynamic_extent))
+     || !_CUDA_VSTD::is_convertible<typename _OtherMapping::extents_type, extents_type>::value))
+  _LIBCUDACXX_HIDE_FROM_ABI constexpr mapping(_OtherMapping const& __other) noexcept
+      : __extents(__other.extents())
+      , __padded_stride(__padded_stride_of(integral_constant<bool, (__rank > 1)>(), __other, __extents))
+  {
+    static_assert(__rank <= 1 || padding_value == dynamic_extent || _OtherMapping::padding_value == dynamic_extent
+                    || padding_value == _OtherMapping::padding_value,
+                  "the padding values of both layout_right_padded mappings must match.");
+  }
+
+  _CCCL_HIDE_FROM_ABI __MDSPAN_CONSTEXPR_14_DEFAULTED mapping& operator=(mapping const&) noexcept = default;
+
+  _LIBCUDACXX_HIDE_FROM_ABI constexpr const extents_type& extents() const noexcept
+  {
+    return __extents;
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI constexpr index_type required_span_size() const noexcept
+  {
+    index_type __value = 1;
+    for (rank_type __r = 0; __r != extents_type::rank(); ++__r)
+    {
+      if (__extents.extent(__r) == 0)
+      {
+        return 0;
+      }
+      __value += (__extents.extent(__r) - 1) * __stride(__r);
+    }
+    return __value;
+  }
+
+  //--------------------------------------------------------------------------------
+
+  _LIBCUDACXX_TEMPLATE(class... _Indices)
+  _LIBCUDACXX_REQUIRES((sizeof...(_Indices) == extents_type::rank()) _LIBCUDACXX_AND __MDSPAN_FOLD_AND(
+    (_CCCL_TRAIT(_CUDA_VSTD::is_convertible, _Indices, index_type)
+     && _CCCL_TRAIT(_CUDA_VSTD::is_nothrow_constructible, index_type, _Indices))))
+  _CCCL_HOST_DEVICE constexpr index_type operator()(_Indices... __idxs) const noexcept
+  {
+    return __compute_offset(__rank_count<0, extents_type::rank()>(), static_cast<index_type>(__idxs)...);
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI static constexpr bool is_always_unique() noexcept
+  {
+    return true;
+  }
+  _LIBCUDACXX_HIDE_FROM_ABI static constexpr bool is_always_exhaustive() noexcept
+  {
+    return __rank <= 1
+        || (extents_type::static_extent(__rank - 1) != dynamic_extent && __static_padded_stride != dynamic_extent
+            && extents_type::static_extent(__rank - 1) == __static_padded_stride);
+  }
+  _LIBCUDACXX_HIDE_FROM_ABI static constexpr bool is_always_strided() noexcept
+  {
+    return true;
+  }
+  _LIBCUDACXX_HIDE_FROM_ABI static constexpr bool is_unique() noexcept
+  {
+    return true;
+  }
+  _LIBCUDACXX_HIDE_FROM_ABI constexpr bool is_exhaustive() const noexcept
+  {
+    return __rank <= 1 || __padded_stride.template __extent<0>() == __padded_extent(__extents);
+  }
+  _LIBCUDACXX_HIDE_FROM_ABI static constexpr bool is_strided() noexcept
+  {
+    return true;
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _Ext = _Extents)
+  _LIBCUDACXX_REQUIRES((_Ext::rank() > 0))
+  _LIBCUDACXX_HIDE_FROM_ABI constexpr index_type stride(rank_type __i) const noexcept
+  {
+    return __stride(__i);
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _OtherMapping)
+  _LIBCUDACXX_REQUIRES(__detail::__is_layout_right_padded_mapping<_OtherMapping>::value _LIBCUDACXX_AND(
+    _OtherMapping::extents_type::rank() == extents_type::rank()))
+  _LIBCUDACXX_HIDE_FROM_ABI friend constexpr bool operator==(mapping const& __lhs, _OtherMapping const& __rhs) noexcept
+  {
+    return __lhs.extents() == __rhs.extents()
+        && (__rank <= 1
+            || __lhs.__padded_stride.template __extent<0>()
+                 == __padded_stride_of(integral_constant<bool, (__rank > 1)>(), __rhs, __lhs.extents()));
+  }
+
+  // In C++ 20 the not equal exists if equal is found
+#  if !(__MDSPAN_HAS_CXX_20)
+  _LIBCUDACXX_TEMPLATE(class _OtherMapping)
+  _LIBCUDACXX_REQUIRES(__detail::__is_layout_right_padded_mapping<_OtherMapping>::value _LIBCUDACXX_AND(
+    _OtherMapping::extents_type::rank() == extents_type::rank()))
+  _LIBCUDACXX_HIDE_FROM_ABI friend constexpr bool operator!=(mapping const& __lhs, _OtherMapping const& __rhs) noexcept
+  {
+    return !(__lhs == __rhs);
+  }
+#  endif
+
+private:
+  _CCCL_NO_UNIQUE_ADDRESS extents_type __extents{};
+  _CCCL_NO_UNIQUE_ADDRESS __padded_stride_type __padded_stride{};
+};
+
+#endif // _CCCL_STD_VER > 2011
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _LIBCUDACXX___MDSPAN_LAYOUT_RIGHT_PADDED_HPP
@@ -55,12 +55,15 @@
 #endif // no system header
 
 #include <cuda/std/__mdspan/compressed_pair.h>
+#include <cuda/std/__mdspan/dynamic_extent.h>
 #include <cuda/std/__mdspan/extents.h>
 #include <cuda/std/__mdspan/macros.h>
 #ifdef _CCCL_HAS_NO_ATTRIBUTE_NO_UNIQUE_ADDRESS
 #  include <cuda/std/__mdspan/no_unique_address.h>
 #endif // _CCCL_HAS_NO_ATTRIBUTE_NO_UNIQUE_ADDRESS
 #include <cuda/std/__mdspan/static_array.h>
+#include <cuda/std/__type_traits/enable_if.h>
+#include <cuda/std/__type_traits/integral_constant.h>
 #include <cuda/std/__type_traits/is_constructible.h>
 #include <cuda/std/__type_traits/is_convertible.h>
 #include <cuda/std/__type_traits/is_nothrow_constructible.h>
@@ -90,12 +93,73 @@ struct layout_right
   class mapping;
 };
 
+// Like layout_left, but the stride of every dimension after the first one is a multiple of _PaddingValue
+template <size_t _PaddingValue = dynamic_extent>
+struct layout_left_padded
+{
+  template <class _Extents>
+  class mapping;
+};
+
+// Like layout_right, but the stride of every dimension before the last one is a multiple of _PaddingValue
+template <size_t _PaddingValue = dynamic_extent>
+struct layout_right_padded
+{
+  template <class _Extents>
+  class mapping;
+};
+
 namespace __detail
 {
 template <class _Layout, class _Mapping>
 _CCCL_INLINE_VAR constexpr bool __is_mapping_of =
   is_same<typename _Layout::template mapping<typename _Mapping::extents_type>, _Mapping>::value;
 
+template <class _Layout>
+struct __is_layout_left_padded : false_type
+{};
+template <size_t _PaddingValue>
+struct __is_layout_left_padded<layout_left_padded<_PaddingValue>> : true_type
+{};
+
+template <class _Layout>
+struct __is_layout_right_padded : false_type
+{};
+template <size_t _PaddingValue>
+struct __is_layout_right_padded<layout_right_padded<_PaddingValue>> : true_type
+{};
+
+template <class _Mapping, class = void>
+struct __is_layout_left_padded_mapping : false_type
+{};
+template <class _Mapping>
+struct __is_layout_left_padded_mapping<_Mapping,
+                                       enable_if_t<__is_layout_left_padded<typename _Mapping::layout_type>::value>>
+    : integral_constant<bool, __is_mapping_of<typename _Mapping::layout_type, _Mapping>>
+{};
+
+template <class _Mapping, class = void>
+struct __is_layout_right_padded_mapping : false_type
+{};
+template <class _Mapping>
+struct __is_layout_right_padded_mapping<_Mapping,
+                                        enable_if_t<__is_layout_right_padded<typename _Mapping::layout_type>::value>>
+    : integral_constant<bool, __is_mapping_of<typename _Mapping::layout_type, _Mapping>>
+{};
+
+// The smallest multiple of __pad that is not less than __ext
+_LIBCUDACXX_HIDE_FROM_ABI constexpr size_t __least_multiple_at_least(size_t __pad, size_t __ext) noexcept
+{
+  return __pad == 0 ? __ext : ((__ext + __pad - 1) / __pad) * __pad;
+}
+
+// The padded stride of a padded layout, if it can be computed at compile time
+_LIBCUDACXX_HIDE_FROM_ABI constexpr size_t __static_padded_stride(size_t __pad, size_t __ext) noexcept
+{
+  return (__pad == dynamic_extent || __ext == dynamic_extent) ? dynamic_extent
+                                                               : __least_multiple_at_least(__pad, __ext);
+}
+
 #  if __MDSPAN_USE_CONCEPTS && __MDSPAN_HAS_CXX_20
 template <class _Mp>
 concept __layout_mapping_alike = requires {
@@ -369,6 +433,8 @@ struct layout_stride
       (!is_convertible<typename _StridedLayoutMapping::extents_type, extents_type>::value)
       && (__detail::__is_mapping_of<layout_left, _StridedLayoutMapping>
           || __detail::__is_mapping_of<layout_right, _StridedLayoutMapping>
+          || __detail::__is_layout_left_padded_mapping<_StridedLayoutMapping>::value
+          || __detail::__is_layout_right_padded_mapping<_StridedLayoutMapping>::value
           || __detail::__is_mapping_of<layout_stride, _StridedLayoutMapping>) ) // needs two () due to comma
     _LIBCUDACXX_HIDE_FROM_ABI constexpr mapping(
       _StridedLayoutMapping const& __other) noexcept // NOLINT(google-explicit-constructor)
@@ -0,0 +1,274 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___MDSPAN_LAYOUT_TILED_HPP
+#define _LIBCUDACXX___MDSPAN_LAYOUT_TILED_HPP
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__mdspan/dynamic_extent.h>
+#include <cuda/std/__mdspan/extents.h>
+#include <cuda/std/__mdspan/macros.h>
+#include <cuda/std/__type_traits/is_constructible.h>
+#include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/__type_traits/is_nothrow_constructible.h>
+#include <cuda/std/cstddef>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+#if _CCCL_STD_VER > 2011
+
+// Extension: splits the index space into tiles of extents _TileExtents..., so that the elements of a tile are
+// contiguous in memory. Both the tiles and the elements within a tile are laid out in row major order. The tiles at
+// the upper end of a dimension are padded when the extent is not a multiple of the tile extent.
+template <size_t... _TileExtents>
+struct layout_tiled
+{
+  template <class _Extents>
+  class mapping;
+};
+
+//==============================================================================
+
+template <size_t... _TileExtents>
+template <class _Extents>
+class layout_tiled<_TileExtents...>::mapping
+{
+public:
+  using extents_type      = _Extents;
+  using index_type        = typename extents_type::index_type;
+  using size_type         = typename extents_type::size_type;
+  using rank_type         = typename extents_type::rank_type;
+  using layout_type       = layout_tiled<_TileExtents...>;
+  using tile_extents_type = _CUDA_VSTD::extents<index_type, _TileExtents...>;
+
+private:
+  static_assert(__detail::__is_extents_v<extents_type>,
+                "layout_tiled::mapping must be instantiated with a specialization of _CUDA_VSTD::extents.");
+  static_assert(sizeof...(_TileExtents) == extents_type::rank(),
+                "layout_tiled::mapping requires one tile extent per dimension.");
+  static_assert(tile_extents_type::rank_dynamic() == 0, "the tile extents of layout_tiled must be static.");
+
+  static constexpr rank_type __rank = extents_type::rank();
+
+  // the number of elements in a tile
+  static constexpr index_type __tile_size =
+    __MDSPAN_FOLD_TIMES_RIGHT((static_cast<index_type>(_TileExtents)), /* * ... * */ 1);
+
+  static_assert(__tile_size > 0, "the tile extents of layout_tiled must be positive.");
+
+  _LIBCUDACXX_HIDE_FROM_ABI static constexpr index_type __tile_extent(rank_type __r) noexcept
+  {
+    return static_cast<index_type>(tile_extents_type::static_extent(__r));
+  }
+
+  // the number of tiles along dimension __r
+  _LIBCUDACXX_HIDE_FROM_ABI constexpr index_type __tile_count(rank_type __r) const noexcept
+  {
+    return (__extents.extent(__r) + __tile_extent(__r) - 1) / __tile_extent(__r);
+  }
+
+  // ((q0 * C(1) + q1) * C(2) + q2) * T + ((r0 * T(1) + r1) * T(2) + r2), where q and r are the quotient and remainder
+  // of the index and the tile extent, C is the number of tiles and T the size of a tile
+  template <size_t _r, size_t _Rank>
+  struct __rank_count
+  {};
+
+  template <size_t _r, size_t _Rank, class _Ip, class... _Indices>
+  _CCCL_HOST_DEVICE constexpr index_type __compute_offset(
+    index_type __tile, index_type __offset, __rank_count<_r, _Rank>, const _Ip& __i, _Indices... __idx) const
+  {
+    return __compute_offset(
+      __tile * ((__extents.template __extent<_r>() + __tile_extent(_r) - 1) / __tile_extent(_r))
+        + __i / __tile_extent(_r),
+      __offset * __tile_extent(_r) + __i % __tile_extent(_r),
+      __rank_count<_r + 1, _Rank>(),
+      __idx...);
+  }
+
+  _CCCL_HOST_DEVICE constexpr index_type
+  __compute_offset(index_type __tile, index_type __offset, __rank_count<_Extents::rank(), _Extents::rank()>) const
+  {
+    return __tile * __tile_size + __offset;
+  }
+
+public:
+  //--------------------------------------------------------------------------------
+
+  _CCCL_HIDE_FROM_ABI constexpr mapping() noexcept               = default;
+  _CCCL_HIDE_FROM_ABI constexpr mapping(mapping const&) noexcept = default;
+
+  _CCCL_HOST_DEVICE constexpr mapping(extents_type const& __exts) noexcept
+      : __extents(__exts)
+  {}
+
+  _LIBCUDACXX_TEMPLATE(class _OtherExtents)
+  _LIBCUDACXX_REQUIRES(_CCCL_TRAIT(_CUDA_VSTD::is_constructible, extents_type, _OtherExtents))
+  __MDSPAN_CONDITIONAL_EXPLICIT((!_CUDA_VSTD::is_convertible<_OtherExtents, extents_type>::value)) // needs two () due
+                                                                                                   // to comma
+  _LIBCUDACXX_HIDE_FROM_ABI constexpr mapping(
+    mapping<_OtherExtents> const& __other) noexcept // NOLINT(google-explicit-constructor)
+      : __extents(__other.extents())
+  {
+    /*
+     * TODO: check precondition
+     * __other.required_span_size() is a representable value of type index_type
+     */
+  }
+
+  _CCCL_HIDE_FROM_ABI __MDSPAN_CONSTEXPR_14_DEFAULTED mapping& operator=(mapping const&) noexcept = default;
+
+  _LIBCUDACXX_HIDE_FROM_ABI constexpr const extents_type& extents() const noexcept
+  {
+    return __extents;
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI static constexpr tile_extents_type tile_extents() noexcept
+  {
+    return tile_extents_type{};
+  }
+
+  // The offset of the last element plus one, which is less than the size of all tiles when the last one is partial
+  _LIBCUDACXX_HIDE_FROM_ABI constexpr index_type required_span_size() const noexcept
+  {
+    index_type __tile   = 0;
+    index_type __offset = 0;
+    for (rank_type __r = 0; __r != extents_type::rank(); ++__r)
+    {
+      if (__extents.extent(__r) == 0)
+      {
+        return 0;
+      }
+      __tile   = __tile * __tile_count(__r) + (__extents.extent(__r) - 1) / __tile_extent(__r);
+      __offset = __offset * __tile_extent(__r) + (__extents.extent(__r) - 1) % __tile_extent(__r);
+    }
+    return __tile * __tile_size + __offset + 1;
+  }
+
+  //--------------------------------------------------------------------------------
+
+  _LIBCUDACXX_TEMPLATE(class... _Indices)
+  _LIBCUDACXX_REQUIRES((sizeof...(_Indices) == extents_type::rank()) _LIBCUDACXX_AND __MDSPAN_FOLD_AND(
+    (_CCCL_TRAIT(_CUDA_VSTD::is_convertible, _Indices, index_type)
+     && _CCCL_TRAIT(_CUDA_VSTD::is_nothrow_constructible, index_type, _Indices))))
+  _CCCL_HOST_DEVICE constexpr index_type operator()(_Indices... __idxs) const noexcept
+  {
+    return __compute_offset(0, 0, __rank_count<0, extents_type::rank()>(), static_cast<index_type>(__idxs)...);
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI static constexpr bool is_always_unique() noexcept
+  {
+    return true;
+  }
+  _LIBCUDACXX_HIDE_FROM_ABI static constexpr bool is_always_exhaustive() noexcept
+  {
+    if (__rank <= 1 || __tile_size == 1)
+    {
+      return true;
+    }
+    for (rank_type __r = 0; __r != extents_type::rank(); ++__r)
+    {
+      if (extents_type::static_extent(__r) == dynamic_extent
+          || extents_type::static_extent(__r) % tile_extents_type::static_extent(__r) != 0)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+  _LIBCUDACXX_HIDE_FROM_ABI static constexpr bool is_always_strided() noexcept
+  {
+    return __rank <= 1 || __tile_size == 1;
+  }
+  _LIBCUDACXX_HIDE_FROM_ABI static constexpr bool is_unique() noexcept
+  {
+    return true;
+  }
+  _LIBCUDACXX_HIDE_FROM_ABI constexpr bool is_exhaustive() const noexcept
+  {
+    index_type __size = 1;
+    for (rank_type __r = 0; __r != extents_type::rank(); ++__r)
+    {
+      __size *= __extents.extent(__r);
+    }
+    return required_span_size() == __size;
+  }
+  // A dimension is strided if it spans at most one tile, if its tiles have extent one, or if a step to the next tile
+  // is the same as a step within a tile
+  _LIBCUDACXX_HIDE_FROM_ABI constexpr bool is_strided() const noexcept
+  {
+    if (required_span_size() == 0)
+    {
+      return true;
+    }
+    index_type __tile_size_before = 1;
+    for (rank_type __r = 0; __r != extents_type::rank(); ++__r)
+    {
+      index_type __tile_count_after = 1;
+      for (rank_type __s = __r + 1; __s != extents_type::rank(); ++__s)
+      {
+        __tile_count_after *= __tile_count(__s);
+      }
+      if (__tile_extent(__r) != 1 && __tile_count(__r) > 1 && (__tile_size_before != 1 || __tile_count_after != 1))
+      {
+        return false;
+      }
+      __tile_size_before *= __tile_extent(__r);
+    }
+    return true;
+  }
+
+  // Precondition: is_strided() is true
+  _LIBCUDACXX_TEMPLATE(class _Ext = _Extents)
+  _LIBCUDACXX_REQUIRES((_Ext::rank() > 0))
+  _LIBCUDACXX_HIDE_FROM_ABI constexpr index_type stride(rank_type __i) const noexcept
+  {
+    index_type __value = __tile_extent(__i) == 1 ? __tile_size : 1;
+    for (rank_type __r = __i + 1; __r != extents_type::rank(); ++__r)
+    {
+      __value *= __tile_extent(__i) == 1 ? __tile_count(__r) : __tile_extent(__r);
+    }
+    return __value;
+  }
+
+  template <class _OtherExtents>
+  _LIBCUDACXX_HIDE_FROM_ABI friend constexpr bool
+  operator==(mapping const& __lhs, mapping<_OtherExtents> const& __rhs) noexcept
+  {
+    return __lhs.extents() == __rhs.extents();
+  }
+
+  // In C++ 20 the not equal exists if equal is found
+#  if !(__MDSPAN_HAS_CXX_20)
+  template <class _OtherExtents>
+  _LIBCUDACXX_HIDE_FROM_ABI friend constexpr bool
+  operator!=(mapping const& __lhs, mapping<_OtherExtents> const& __rhs) noexcept
+  {
+    return __lhs.extents() != __rhs.extents();
+  }
+#  endif
+
+private:
+  _CCCL_NO_UNIQUE_ADDRESS extents_type __extents{};
+};
+
+#endif // _CCCL_STD_VER > 2011
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _LIBCUDACXX___MDSPAN_LAYOUT_TILED_HPP
@@ -57,7 +57,9 @@
 #include <cuda/std/__mdspan/dynamic_extent.h>
 #include <cuda/std/__mdspan/full_extent_t.h>
 #include <cuda/std/__mdspan/layout_left.h>
+#include <cuda/std/__mdspan/layout_left_padded.h>
 #include <cuda/std/__mdspan/layout_right.h>
+#include <cuda/std/__mdspan/layout_right_padded.h>
 #include <cuda/std/__mdspan/layout_stride.h>
 #include <cuda/std/__mdspan/macros.h>
 #include <cuda/std/__mdspan/mdspan.h>
@@ -208,14 +210,108 @@ struct ignore_layout_preservation : integral_constant<bool, false>
   using encounter_scalar         = ignore_layout_preservation;
 };
 
-template <class _Layout>
+// a layout left padded remains a layout left padded if it is indexed by a pair or all, then 0 or more all,
+// then optionally a pair and finally 0 or more scalars; the padded stride is that of the source
+enum class __padded_analysis_state
+{
+  __start,
+  __scalars,
+  __ranges,
+  __closed,
+  __failed
+};
+
+template <size_t _PaddedStride, __padded_analysis_state _State = __padded_analysis_state::__start>
+struct preserve_layout_left_padded_analysis
+    : integral_constant<bool, _State != __padded_analysis_state::__failed>
+{
+  using layout_type_if_preserved = layout_left_padded<_PaddedStride>;
+  using encounter_pair           = preserve_layout_left_padded_analysis<
+              _PaddedStride,
+              _State == __padded_analysis_state::__start  ? __padded_analysis_state::__ranges
+              : _State == __padded_analysis_state::__ranges ? __padded_analysis_state::__closed
+                                                            : __padded_analysis_state::__failed>;
+  using encounter_all = preserve_layout_left_padded_analysis<
+    _PaddedStride,
+    (_State == __padded_analysis_state::__start || _State == __padded_analysis_state::__ranges)
+      ? __padded_analysis_state::__ranges
+      : __padded_analysis_state::__failed>;
+  // scalars end the ranges, and only scalars may follow them
+  using encounter_scalar = preserve_layout_left_padded_analysis<
+    _PaddedStride,
+    _State == __padded_analysis_state::__failed ? __padded_analysis_state::__failed
+    : _State == __padded_analysis_state::__start || _State == __padded_analysis_state::__scalars
+      ? __padded_analysis_state::__scalars
+      : __padded_analysis_state::__closed>;
+};
+
+// a layout right padded remains a layout right padded if it is indexed by 0 or more scalars, then a pair or all,
+// then 0 or more all and finally optionally a pair; the padded stride is that of the source
+template <size_t _PaddedStride, __padded_analysis_state _State = __padded_analysis_state::__start>
+struct preserve_layout_right_padded_analysis
+    : integral_constant<bool, _State != __padded_analysis_state::__failed>
+{
+  using layout_type_if_preserved = layout_right_padded<_PaddedStride>;
+  using encounter_pair           = preserve_layout_right_padded_analysis<
+              _PaddedStride,
+              _State == __padded_analysis_state::__start  ? __padded_analysis_state::__ranges
+              : _State == __padded_analysis_state::__ranges ? __padded_analysis_state::__closed
+                                                            : __padded_analysis_state::__failed>;
+  using encounter_all = preserve_layout_right_padded_analysis<
+    _PaddedStride,
+    (_State == __padded_analysis_state::__start || _State == __padded_analysis_state::__ranges)
+      ? __padded_analysis_state::__ranges
+      : __padded_analysis_state::__failed>;
+  using encounter_scalar = preserve_layout_right_padded_analysis<
+    _PaddedStride,
+    _State == __padded_analysis_state::__start ? __padded_analysis_state::__start : __padded_analysis_state::__failed>;
+};
+
+template <class _Layout, class _Extents>
 struct preserve_layout_analysis : ignore_layout_preservation
 {};
-template <>
-struct preserve_layout_analysis<layout_right> : preserve_layout_right_analysis<>
+template <class _Extents>
+struct preserve_layout_analysis<layout_right, _Extents> : preserve_layout_right_analysis<>
 {};
-template <>
-struct preserve_layout_analysis<layout_left> : preserve_layout_left_analysis<>
+template <class _Extents>
+struct preserve_layout_analysis<layout_left, _Extents> : preserve_layout_left_analysis<>
+{};
+template <size_t _PaddingValue, class _Extents>
+struct preserve_layout_analysis<layout_left_padded<_PaddingValue>, _Extents>
+    : preserve_layout_left_padded_analysis<
+        __static_padded_stride(_PaddingValue, _Extents::rank() > 1 ? _Extents::static_extent(0) : dynamic_extent)>
+{};
+template <size_t _PaddingValue, class _Extents>
+struct preserve_layout_analysis<layout_right_padded<_PaddingValue>, _Extents>
+    : preserve_layout_right_padded_analysis<__static_padded_stride(
+        _PaddingValue, _Extents::rank() > 1 ? _Extents::static_extent(_Extents::rank() - 1) : dynamic_extent)>
+{};
+
+// a padded layout of rank 0 or 1 is the corresponding unpadded layout
+template <class _Layout, size_t _Rank>
+struct __sub_layout
+{
+  using type = _Layout;
+};
+template <size_t _PaddingValue, size_t _Rank>
+struct __sub_layout<layout_left_padded<_PaddingValue>, _Rank>
+{
+  using type = conditional_t<(_Rank <= 1), layout_left, layout_left_padded<_PaddingValue>>;
+};
+template <size_t _PaddingValue, size_t _Rank>
+struct __sub_layout<layout_right_padded<_PaddingValue>, _Rank>
+{
+  using type = conditional_t<(_Rank <= 1), layout_right, layout_right_padded<_PaddingValue>>;
+};
+
+// the dimension of the sub mapping whose stride is the padded stride
+template <class _Layout, size_t _Rank>
+struct __padded_stride_index;
+template <size_t _PaddingValue, size_t _Rank>
+struct __padded_stride_index<layout_left_padded<_PaddingValue>, _Rank> : integral_constant<size_t, 1>
+{};
+template <size_t _PaddingValue, size_t _Rank>
+struct __padded_stride_index<layout_right_padded<_PaddingValue>, _Rank> : integral_constant<size_t, _Rank - 2>
 {};
 
 //--------------------------------------------------------------------------------
@@ -415,10 +511,9 @@ struct __assign_op_slice_handler<
   }
 
   // TODO defer instantiation of this?
-  using layout_type =
-    conditional_t<_PreserveLayoutAnalysis::value,
-                  typename _PreserveLayoutAnalysis::layout_type_if_preserved,
-                  layout_stride>;
+  using __layout_type_if_preserved =
+    typename __sub_layout<typename _PreserveLayoutAnalysis::layout_type_if_preserved, sizeof...(_Exts)>::type;
+  using layout_type = conditional_t<_PreserveLayoutAnalysis::value, __layout_type_if_preserved, layout_stride>;
 
   // TODO noexcept specification
   template <class NewLayout>
@@ -431,6 +526,31 @@ struct __assign_op_slice_handler<
         extents<_IndexT, _Exts...>::__make_extents_impl(_CUDA_VSTD::move(__exts))) /* ; */
       ))
 
+    // the sub mapping of a padded layout keeps the padded stride of the source
+    template <size_t _PaddingValue>
+    _LIBCUDACXX_HIDE_FROM_ABI __MDSPAN_DEDUCE_RETURN_TYPE_SINGLE_LINE(
+      (constexpr /* auto */
+       _make_layout_mapping_impl(layout_left_padded<_PaddingValue>) noexcept),
+      (
+        /* return */ typename layout_left_padded<_PaddingValue>::template mapping<
+          _CUDA_VSTD::extents<_IndexT, _Exts...>>(
+          extents<_IndexT, _Exts...>::__make_extents_impl(_CUDA_VSTD::move(__exts)),
+          __strides.template __get_n<
+            __padded_stride_index<layout_left_padded<_PaddingValue>, sizeof...(_Exts)>::value>()) /* ; */
+        ))
+
+    template <size_t _PaddingValue>
+    _LIBCUDACXX_HIDE_FROM_ABI __MDSPAN_DEDUCE_RETURN_TYPE_SINGLE_LINE(
+      (constexpr /* auto */
+       _make_layout_mapping_impl(layout_right_padded<_PaddingValue>) noexcept),
+      (
+        /* return */ typename layout_right_padded<_PaddingValue>::template mapping<
+          _CUDA_VSTD::extents<_IndexT, _Exts...>>(
+          extents<_IndexT, _Exts...>::__make_extents_impl(_CUDA_VSTD::move(__exts)),
+          __strides.template __get_n<
+            __padded_stride_index<layout_right_padded<_PaddingValue>, sizeof...(_Exts)>::value>()) /* ; */
+        ))
+
     _LIBCUDACXX_HIDE_FROM_ABI __MDSPAN_DEDUCE_RETURN_TYPE_SINGLE_LINE(
       (constexpr /* auto */
        _make_layout_mapping_impl(layout_stride) noexcept),
@@ -460,7 +580,8 @@ _LIBCUDACXX_HIDE_FROM_ABI constexpr auto _submdspan_impl(
 {
   using __index_t = _ST;
   auto __handled  = __MDSPAN_FOLD_ASSIGN_LEFT(
-    (__detail::__assign_op_slice_handler<__index_t, __detail::preserve_layout_analysis<_LP>>{
+    (__detail::__assign_op_slice_handler<__index_t,
+                                         __detail::preserve_layout_analysis<_LP, _CUDA_VSTD::extents<_ST, _Exts...>>>{
       __partially_static_sizes<__index_t, size_t>{},
       __partially_static_sizes<__index_t, size_t>{},
       __partially_static_sizes<__index_t, size_t>{}}),
@@ -498,7 +619,9 @@ _LIBCUDACXX_HIDE_FROM_ABI __MDSPAN_DEDUCE_RETURN_TYPE_SINGLE_LINE(
     /* return */ _submdspan_impl_helper<_ET, _AP>(
       __src,
       __MDSPAN_FOLD_ASSIGN_LEFT(
-        (__detail::__assign_op_slice_handler<size_t, __detail::preserve_layout_analysis<_LP>>{
+        (__detail::__assign_op_slice_handler<
+          size_t,
+          __detail::preserve_layout_analysis<_LP, _CUDA_VSTD::extents<_ST, _Exts...>>>{
           __partially_static_sizes<_ST, size_t>{},
           __partially_static_sizes<_ST, size_t>{},
           __partially_static_sizes<_ST, size_t>{}}),
@@ -524,6 +647,7 @@ struct _is_layout_stride<layout_stride> : true_type
 _LIBCUDACXX_TEMPLATE(class _ET, class _EXT, class _LP, class _AP, class... _SliceSpecs)
 _LIBCUDACXX_REQUIRES(
   (_CCCL_TRAIT(_CUDA_VSTD::is_same, _LP, layout_left) || _CCCL_TRAIT(_CUDA_VSTD::is_same, _LP, layout_right)
+   || __detail::__is_layout_left_padded<_LP>::value || __detail::__is_layout_right_padded<_LP>::value
    || __detail::_is_layout_stride<_LP>::value)
     _LIBCUDACXX_AND __MDSPAN_FOLD_AND(
       (_CCCL_TRAIT(_CUDA_VSTD::is_convertible, _SliceSpecs, size_t)
@@ -175,6 +175,35 @@ _LIBCUDACXX_HIDE_FROM_ABI void __libcpp_thread_sleep_for(_CUDA_VSTD::chrono::nan
     ;
 }
 
+// Futex
+#  if defined(__linux__)
+
+#    define _LIBCUDACXX_HAS_FUTEX
+
+// Sleeps until woken if *__addr still holds __expected, or until __timeout
+// passed unless it is zero. May return spuriously.
+_LIBCUDACXX_HIDE_FROM_ABI void __libcpp_futex_wait(
+  int const volatile* __addr,
+  int __expected,
+  _CUDA_VSTD::chrono::nanoseconds __timeout = _CUDA_VSTD::chrono::nanoseconds::zero())
+{
+  if (__timeout == _CUDA_VSTD::chrono::nanoseconds::zero())
+  {
+    ::syscall(SYS_futex, __addr, FUTEX_WAIT_PRIVATE, __expected, nullptr, nullptr, 0);
+    return;
+  }
+  __libcpp_timespec_t __ts = __libcpp_to_timespec(__timeout);
+  ::syscall(SYS_futex, __addr, FUTEX_WAIT_PRIVATE, __expected, &__ts, nullptr, 0);
+}
+
+// Wakes up to __count threads sleeping on __addr.
+_LIBCUDACXX_HIDE_FROM_ABI void __libcpp_futex_wake(int const volatile* __addr, int __count)
+{
+  ::syscall(SYS_futex, __addr, FUTEX_WAKE_PRIVATE, __count, nullptr, nullptr, 0);
+}
+
+#  endif // __linux__
+
 _LIBCUDACXX_END_NAMESPACE_STD
 
 _CCCL_POP_MACROS
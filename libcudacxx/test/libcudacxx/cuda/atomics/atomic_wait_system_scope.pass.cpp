@@ -0,0 +1,49 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: nvrtc
+
+// <cuda/atomic>
+
+#include <cuda/atomic>
+#include <cuda/std/cassert>
+
+#include <chrono>
+#include <thread>
+
+#include "test_macros.h"
+
+// The device and other processes update system scope atomics without notifying
+// the host waiters, so those have to notice the new value on their own.
+template <class T>
+void test_wait_without_notify()
+{
+  cuda::atomic<T, cuda::thread_scope_system> a(T(1));
+
+  std::thread waiter([&] {
+    a.wait(T(1));
+    assert(a.load() == T(2));
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  a.store(T(2));
+  waiter.join();
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST,
+               (test_wait_without_notify<int>(); //
+                test_wait_without_notify<char>();
+                test_wait_without_notify<long long>();))
+
+  return 0;
+}
@@ -0,0 +1,142 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: nvrtc
+
+#include <cuda/barrier>
+#include <cuda/std/cassert>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "test_macros.h"
+
+template <class F>
+void run_threads(int count, F f)
+{
+  std::vector<std::thread> threads;
+  for (int i = 0; i < count; ++i)
+  {
+    threads.emplace_back(f, i);
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+}
+
+void test_arrive_and_wait(int thread_count)
+{
+  constexpr int phases = 50;
+
+  std::atomic<int> completions(0);
+  std::atomic<int> arrivals(0);
+  auto completion = [&]() noexcept {
+    // every thread has arrived in every phase so far
+    assert(arrivals.load() == (completions.load() + 1) * thread_count);
+    completions.fetch_add(1);
+  };
+  cuda::tree_barrier<decltype(completion)> b(thread_count, completion);
+
+  run_threads(thread_count, [&](int) {
+    for (int phase = 0; phase < phases; ++phase)
+    {
+      arrivals.fetch_add(1);
+      b.arrive_and_wait();
+      assert(completions.load() >= phase + 1);
+    }
+  });
+
+  assert(completions.load() == phases);
+}
+
+void test_arrive_and_drop(int thread_count)
+{
+  cuda::tree_barrier<> b(thread_count);
+
+  // odd threads leave after the first phase, the others keep going
+  run_threads(thread_count, [&](int i) {
+    b.arrive_and_wait();
+    if (i % 2 == 1)
+    {
+      b.arrive_and_drop();
+      return;
+    }
+    for (int phase = 0; phase < 20; ++phase)
+    {
+      b.arrive_and_wait();
+    }
+  });
+}
+
+void test_arrive_then_arrive_and_wait(int thread_count)
+{
+  constexpr int phases = 50;
+
+  std::atomic<int> completions(0);
+  std::atomic<int> released(0);
+  auto completion = [&]() noexcept {
+    completions.fetch_add(1);
+  };
+  cuda::tree_barrier<decltype(completion)> b(thread_count, completion);
+
+  // The first thread only arrives in even phases and learns that they are
+  // over from whichever other thread wakes up first, so it may arrive again
+  // before its own node has seen the phase change.
+  run_threads(thread_count, [&](int i) {
+    for (int phase = 0; phase < phases; ++phase)
+    {
+      if (i == 0 && phase % 2 == 0)
+      {
+        (void) b.arrive();
+        while (released.load() <= phase)
+        {
+          std::this_thread::yield();
+        }
+        continue;
+      }
+      b.arrive_and_wait();
+      assert(completions.load() >= phase + 1);
+      released.store(phase + 1);
+    }
+  });
+
+  assert(completions.load() == phases);
+}
+
+void test_update()
+{
+  cuda::tree_barrier<> b(4);
+
+  auto token = b.arrive(3);
+  b.arrive_and_wait();
+  b.wait(std::move(token));
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST,
+               (test_update();
+
+                for (int thread_count : {1, 2, 3, 7, 16, 33}) {
+                  test_arrive_and_wait(thread_count);
+                  test_arrive_and_drop(thread_count);
+                }
+
+                for (int thread_count : {2, 3, 7, 16}) {
+                  test_arrive_then_arrive_and_wait(thread_count);
+                }
+
+                static_assert(cuda::tree_barrier<>::max() > 0, "");))
+
+  return 0;
+}
@@ -0,0 +1,103 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// template<RandomAccessIterator Iter>
+//   requires ShuffleIterator<Iter> && LessThanComparable<Iter::value_type>
+//   constexpr void  // constexpr in C++20
+//   nth_element(Iter first, Iter nth, Iter last);
+
+#include <cuda/std/__algorithm_>
+#include <cuda/std/cassert>
+
+#include "MoveOnly.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+__host__ __device__ constexpr int value_of(int x)
+{
+  return x;
+}
+
+__host__ __device__ constexpr int value_of(const MoveOnly& x)
+{
+  return x.get();
+}
+
+template <class T, class Iter, int N>
+__host__ __device__ TEST_CONSTEXPR_CXX14 void test(int distinct_values)
+{
+  const int positions[] = {0, 1, N / 3, N / 2, N - 2, N - 1};
+  for (int nth : positions)
+  {
+    if (nth < 0 || nth >= N)
+    {
+      continue;
+    }
+
+    // a permutation of the values i % distinct_values, whose nth smallest is known
+    T work[N] = {};
+    for (int i = 0; i < N; ++i)
+    {
+      work[i] = T(((i * 37) % N) % distinct_values);
+    }
+    int count[N] = {};
+    for (int i = 0; i < N; ++i)
+    {
+      ++count[(i * 37) % N % distinct_values];
+    }
+    int expected = 0;
+    for (int seen = count[0]; seen <= nth; seen += count[++expected])
+    {
+    }
+
+    cuda::std::nth_element(Iter(work), Iter(work + nth), Iter(work + N));
+
+    assert(value_of(work[nth]) == expected);
+    for (int i = 0; i < nth; ++i)
+    {
+      assert(!(value_of(work[nth]) < value_of(work[i])));
+    }
+    for (int i = nth + 1; i < N; ++i)
+    {
+      assert(!(value_of(work[i]) < value_of(work[nth])));
+    }
+  }
+}
+
+__host__ __device__ TEST_CONSTEXPR_CXX14 bool test()
+{
+  int i = 42;
+  cuda::std::nth_element(&i, &i, &i); // no-op
+  assert(i == 42);
+  cuda::std::nth_element(&i, &i, &i + 1);
+  assert(i == 42);
+
+  test<int, int*, 5>(5);
+  test<int, random_access_iterator<int*>, 100>(100);
+  test<int, int*, 100>(3);
+  test<int, int*, 100>(1);
+
+  test<MoveOnly, MoveOnly*, 100>(100);
+  test<MoveOnly, random_access_iterator<MoveOnly*>, 100>(7);
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+#if TEST_STD_VER >= 2014 && defined(_CCCL_BUILTIN_IS_CONSTANT_EVALUATED)
+  static_assert(test(), "");
+#endif // TEST_STD_VER >= 2014 && _CCCL_BUILTIN_IS_CONSTANT_EVALUATED
+
+  return 0;
+}
@@ -0,0 +1,69 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// template<RandomAccessIterator Iter, StrictWeakOrder<auto, Iter::value_type> Compare>
+//   requires ShuffleIterator<Iter> && CopyConstructible<Compare>
+//   constexpr void  // constexpr in C++20
+//   nth_element(Iter first, Iter nth, Iter last, Compare comp);
+
+#include <cuda/std/__algorithm_>
+#include <cuda/std/cassert>
+#include <cuda/std/functional>
+
+#include "MoveOnly.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+template <class T, class Iter, int N>
+__host__ __device__ TEST_CONSTEXPR_CXX14 void test()
+{
+  for (int nth = 0; nth < N; nth += 7)
+  {
+    T work[N] = {};
+    for (int i = 0; i < N; ++i)
+    {
+      work[i] = T((i * 37) % N);
+    }
+
+    cuda::std::nth_element(Iter(work), Iter(work + nth), Iter(work + N), cuda::std::greater<T>());
+
+    assert(work[nth] == T(N - 1 - nth));
+    for (int i = 0; i < nth; ++i)
+    {
+      assert(work[nth] < work[i]);
+    }
+    for (int i = nth + 1; i < N; ++i)
+    {
+      assert(work[i] < work[nth]);
+    }
+  }
+}
+
+__host__ __device__ TEST_CONSTEXPR_CXX14 bool test()
+{
+  test<int, int*, 5>();
+  test<int, random_access_iterator<int*>, 200>();
+  test<MoveOnly, MoveOnly*, 200>();
+  test<MoveOnly, random_access_iterator<MoveOnly*>, 50>();
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+#if TEST_STD_VER >= 2014 && defined(_CCCL_BUILTIN_IS_CONSTANT_EVALUATED)
+  static_assert(test(), "");
+#endif // TEST_STD_VER >= 2014 && _CCCL_BUILTIN_IS_CONSTANT_EVALUATED
+
+  return 0;
+}
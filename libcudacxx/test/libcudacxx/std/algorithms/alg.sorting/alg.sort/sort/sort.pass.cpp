@@ -0,0 +1,146 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// template<RandomAccessIterator Iter>
+//   requires ShuffleIterator<Iter> && LessThanComparable<Iter::value_type>
+//   constexpr void  // constexpr in C++20
+//   sort(Iter first, Iter last);
+
+#include <cuda/std/__algorithm_>
+#include <cuda/std/cassert>
+
+#include "MoveOnly.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+__host__ __device__ constexpr int value_of(int x)
+{
+  return x;
+}
+
+__host__ __device__ constexpr int value_of(const MoveOnly& x)
+{
+  return x.get();
+}
+
+// the short ranges are sorted by the sorting networks
+template <class T, class Iter>
+__host__ __device__ TEST_CONSTEXPR_CXX14 void test_permutations()
+{
+  for (int n = 0; n <= 6; ++n)
+  {
+    int perm[6] = {0, 1, 2, 3, 4, 5};
+    for (bool more = true; more; more = cuda::std::next_permutation(perm, perm + n))
+    {
+      T work[6] = {};
+      for (int i = 0; i < n; ++i)
+      {
+        work[i] = T(perm[i]);
+      }
+      cuda::std::sort(Iter(work), Iter(work + n));
+      for (int i = 0; i < n; ++i)
+      {
+        assert(value_of(work[i]) == i);
+      }
+    }
+  }
+}
+
+// the long ranges are partitioned, in patterns which are the worst cases of naive quicksorts
+template <class T, class Iter, int N>
+__host__ __device__ TEST_CONSTEXPR_CXX14 void test_patterns()
+{
+  for (int pattern = 0; pattern < 6; ++pattern)
+  {
+    T work[N] = {};
+    unsigned seed = 1;
+    long sum      = 0;
+    for (int i = 0; i < N; ++i)
+    {
+      int v = 0;
+      switch (pattern)
+      {
+        case 0:
+          v = i;
+          break;
+        case 1:
+          v = N - i;
+          break;
+        case 2:
+          v = i < N / 2 ? i : N - i;
+          break;
+        case 3:
+          v = i % 3;
+          break;
+        case 4:
+          v = 7;
+          break;
+        default:
+          seed = seed * 1103515245u + 12345u;
+          v    = static_cast<int>((seed >> 16) % 1000);
+          break;
+      }
+      work[i] = T(v);
+      sum += v;
+    }
+
+    cuda::std::sort(Iter(work), Iter(work + N));
+
+    long sorted_sum = 0;
+    for (int i = 0; i < N; ++i)
+    {
+      assert(i == 0 || !(value_of(work[i]) < value_of(work[i - 1])));
+      sorted_sum += value_of(work[i]);
+    }
+    assert(sorted_sum == sum);
+  }
+}
+
+template <class T, class Iter>
+__host__ __device__ TEST_CONSTEXPR_CXX14 void test()
+{
+  test_permutations<T, Iter>();
+  test_patterns<T, Iter, 30>();
+  test_patterns<T, Iter, 129>();
+}
+
+__host__ __device__ TEST_CONSTEXPR_CXX14 bool test()
+{
+  int i = 42;
+  cuda::std::sort(&i, &i); // no-op
+  assert(i == 42);
+
+  test<int, random_access_iterator<int*>>();
+  test<int, int*>();
+
+  test<MoveOnly, random_access_iterator<MoveOnly*>>();
+  test<MoveOnly, MoveOnly*>();
+
+  return true;
+}
+
+__host__ __device__ void test_long()
+{
+  test_patterns<int, int*, 1000>();
+  test_patterns<MoveOnly, MoveOnly*, 1000>();
+}
+
+int main(int, char**)
+{
+  test();
+  test_long();
+#if TEST_STD_VER >= 2014 && defined(_CCCL_BUILTIN_IS_CONSTANT_EVALUATED)
+  static_assert(test(), "");
+#endif // TEST_STD_VER >= 2014 && _CCCL_BUILTIN_IS_CONSTANT_EVALUATED
+
+  return 0;
+}
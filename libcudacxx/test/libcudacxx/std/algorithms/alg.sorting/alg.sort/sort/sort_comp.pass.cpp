@@ -0,0 +1,107 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// template<RandomAccessIterator Iter, StrictWeakOrder<auto, Iter::value_type> Compare>
+//   requires ShuffleIterator<Iter>
+//         && CopyConstructible<Compare>
+//   constexpr void  // constexpr in C++20
+//   sort(Iter first, Iter last, Compare comp);
+
+#include <cuda/std/__algorithm_>
+#include <cuda/std/cassert>
+#include <cuda/std/functional>
+
+#include "MoveOnly.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+// orders by the key only, so that the values of equal keys may be in any order
+struct key_less
+{
+  __host__ __device__ constexpr bool operator()(int x, int y) const
+  {
+    return x / 10 < y / 10;
+  }
+};
+
+template <class T, class Iter, int N>
+__host__ __device__ TEST_CONSTEXPR_CXX14 void test()
+{
+  T work[N] = {};
+  unsigned seed = 1;
+  for (int i = 0; i < N; ++i)
+  {
+    seed    = seed * 1103515245u + 12345u;
+    work[i] = T(static_cast<int>((seed >> 16) % 100));
+  }
+
+  cuda::std::sort(Iter(work), Iter(work + N), cuda::std::greater<T>());
+  assert(cuda::std::is_sorted(work, work + N, cuda::std::greater<T>()));
+
+  for (int i = 0; i < N; ++i)
+  {
+    work[i] = T(N - i);
+  }
+  cuda::std::sort(Iter(work), Iter(work + N), cuda::std::greater<T>());
+  for (int i = 0; i < N; ++i)
+  {
+    assert(work[i] == T(N - i));
+  }
+}
+
+template <int N>
+__host__ __device__ TEST_CONSTEXPR_CXX14 void test_key()
+{
+  int work[N] = {};
+  long sum    = 0;
+  for (int i = 0; i < N; ++i)
+  {
+    work[i] = (i * 37) % N;
+    sum += work[i];
+  }
+
+  cuda::std::sort(work, work + N, key_less());
+  assert(cuda::std::is_sorted(work, work + N, key_less()));
+
+  long sorted_sum = 0;
+  for (int i = 0; i < N; ++i)
+  {
+    sorted_sum += work[i];
+  }
+  assert(sorted_sum == sum);
+}
+
+__host__ __device__ TEST_CONSTEXPR_CXX14 bool test()
+{
+  test<int, random_access_iterator<int*>, 5>();
+  test<int, int*, 5>();
+  test<int, random_access_iterator<int*>, 200>();
+  test<int, int*, 200>();
+
+  test<MoveOnly, random_access_iterator<MoveOnly*>, 200>();
+  test<MoveOnly, MoveOnly*, 200>();
+
+  test_key<5>();
+  test_key<200>();
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+#if TEST_STD_VER >= 2014 && defined(_CCCL_BUILTIN_IS_CONSTANT_EVALUATED)
+  static_assert(test(), "");
+#endif // TEST_STD_VER >= 2014 && _CCCL_BUILTIN_IS_CONSTANT_EVALUATED
+
+  return 0;
+}
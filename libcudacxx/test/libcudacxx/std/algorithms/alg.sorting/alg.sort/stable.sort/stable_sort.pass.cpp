@@ -0,0 +1,115 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// template<RandomAccessIterator Iter>
+//   requires ShuffleIterator<Iter> && LessThanComparable<Iter::value_type>
+//   void
+//   stable_sort(Iter first, Iter last);
+
+#include <cuda/std/__algorithm_>
+#include <cuda/std/cassert>
+
+#include "MoveOnly.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+// compares by the key only, and remembers the original position to check the stability
+struct Keyed
+{
+  int key;
+  int position;
+
+  __host__ __device__ friend bool operator<(const Keyed& x, const Keyed& y)
+  {
+    return x.key < y.key;
+  }
+};
+
+template <class Iter, int N>
+__host__ __device__ void test_stability(int distinct_keys)
+{
+  Keyed work[N];
+  unsigned seed = 1;
+  for (int i = 0; i < N; ++i)
+  {
+    seed    = seed * 1103515245u + 12345u;
+    work[i] = Keyed{static_cast<int>((seed >> 16) % distinct_keys), i};
+  }
+
+  cuda::std::stable_sort(Iter(work), Iter(work + N));
+
+  for (int i = 1; i < N; ++i)
+  {
+    assert(work[i - 1].key <= work[i].key);
+    assert(work[i - 1].key < work[i].key || work[i - 1].position < work[i].position);
+  }
+}
+
+template <class T, class Iter, int N>
+__host__ __device__ void test_patterns()
+{
+  for (int pattern = 0; pattern < 4; ++pattern)
+  {
+    T work[N] = {};
+    for (int i = 0; i < N; ++i)
+    {
+      int v = 0;
+      switch (pattern)
+      {
+        case 0:
+          v = i;
+          break;
+        case 1:
+          v = N - i;
+          break;
+        case 2:
+          v = i < N / 2 ? i : N - i;
+          break;
+        default:
+          v = (i * 37) % N;
+          break;
+      }
+      work[i] = T(v);
+    }
+
+    cuda::std::stable_sort(Iter(work), Iter(work + N));
+    assert(cuda::std::is_sorted(work, work + N));
+  }
+}
+
+__host__ __device__ bool test()
+{
+  int i = 42;
+  cuda::std::stable_sort(&i, &i); // no-op
+  assert(i == 42);
+
+  test_stability<Keyed*, 1>(1);
+  test_stability<Keyed*, 2>(1);
+  test_stability<Keyed*, 100>(7);
+  test_stability<random_access_iterator<Keyed*>, 1000>(7);
+  test_stability<Keyed*, 1000>(300);
+
+  test_patterns<int, int*, 5>();
+  test_patterns<int, random_access_iterator<int*>, 300>();
+  test_patterns<int, int*, 1000>();
+  test_patterns<MoveOnly, MoveOnly*, 300>();
+  test_patterns<MoveOnly, random_access_iterator<MoveOnly*>, 1000>();
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+
+  return 0;
+}
@@ -0,0 +1,90 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// template<RandomAccessIterator Iter, StrictWeakOrder<auto, Iter::value_type> Compare>
+//   requires ShuffleIterator<Iter>
+//         && CopyConstructible<Compare>
+//   void
+//   stable_sort(Iter first, Iter last, Compare comp);
+
+#include <cuda/std/__algorithm_>
+#include <cuda/std/cassert>
+#include <cuda/std/functional>
+
+#include "MoveOnly.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+// orders by the tens only, so that the stability is observable in the units
+struct tens_greater
+{
+  __host__ __device__ bool operator()(int x, int y) const
+  {
+    return x / 10 > y / 10;
+  }
+};
+
+template <int N>
+__host__ __device__ void test_stability()
+{
+  int work[N] = {};
+  for (int i = 0; i < N; ++i)
+  {
+    // the units of equal tens are increasing
+    work[i] = ((i * 37) % 7) * 10 + (i * 10) / N;
+  }
+
+  cuda::std::stable_sort(work, work + N, tens_greater());
+
+  for (int i = 1; i < N; ++i)
+  {
+    assert(work[i - 1] / 10 >= work[i] / 10);
+    assert(work[i - 1] / 10 > work[i] / 10 || work[i - 1] % 10 <= work[i] % 10);
+  }
+}
+
+template <class T, class Iter, int N>
+__host__ __device__ void test()
+{
+  T work[N] = {};
+  for (int i = 0; i < N; ++i)
+  {
+    work[i] = T((i * 37) % N);
+  }
+
+  cuda::std::stable_sort(Iter(work), Iter(work + N), cuda::std::greater<T>());
+
+  for (int i = 0; i < N; ++i)
+  {
+    assert(work[i] == T(N - 1 - i));
+  }
+}
+
+__host__ __device__ bool test()
+{
+  test_stability<10>();
+  test_stability<500>();
+
+  test<int, int*, 5>();
+  test<int, random_access_iterator<int*>, 1000>();
+  test<MoveOnly, MoveOnly*, 1000>();
+  test<MoveOnly, random_access_iterator<MoveOnly*>, 300>();
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+
+  return 0;
+}
@@ -0,0 +1,63 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: c++98, c++03
+// UNSUPPORTED: pre-sm-70
+
+// <cuda/std/atomic>
+
+#include <cuda/std/atomic>
+#include <cuda/std/cassert>
+#include <cuda/std/type_traits>
+
+#include "../atomics.types.operations.req/atomic_helpers.h"
+#include "concurrent_agents.h"
+#include "cuda_space_selector.h"
+#include "test_macros.h"
+
+template <class T, template <typename, typename> class Selector, cuda::thread_scope Scope>
+struct TestFn
+{
+  __host__ __device__ void operator()() const
+  {
+    typedef cuda::std::atomic<T> A;
+
+    SHARED A* t;
+    execute_on_main_thread([&] {
+      t = (A*) malloc(sizeof(A));
+      cuda::std::atomic_init(t, T(1));
+    });
+
+    auto agent_notify = LAMBDA()
+    {
+      cuda::std::atomic_store(t, T(3));
+      cuda::std::atomic_notify_all(t);
+    };
+
+    // both waiters have to be woken up by the single notify_all
+    auto agent_wait = LAMBDA()
+    {
+      cuda::std::atomic_wait(t, T(1));
+      assert(cuda::std::atomic_load(t) == T(3));
+    };
+
+    concurrent_agents_launch(agent_notify, agent_wait, agent_wait);
+  }
+};
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, cuda_thread_count = 3;)
+
+  TestEachAtomicType<TestFn, shared_memory_selector>()();
+
+  return 0;
+}
@@ -0,0 +1,123 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+#include <cuda/std/cassert>
+#include <cuda/std/mdspan>
+#include "../mdspan.layout.util/layout_util.hpp"
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+int main(int, char**)
+{
+  using ext3_t = cuda::std::dextents<int, 3>;
+
+  // Static padding, the padded stride rounds the rightmost extent up
+  {
+    cuda::std::layout_right_padded<4>::mapping<ext3_t> m{ext3_t{2, 3, 5}};
+
+    assert(m.stride(2) == 1);
+    assert(m.stride(1) == 8);
+    assert(m.stride(0) == 24);
+    assert(m(1, 2, 1) == 24 + 16 + 1);
+    assert(m.required_span_size() == 24 + 16 + 4 + 1);
+    assert(m.is_unique() == true);
+    assert(m.is_strided() == true);
+    assert(m.is_exhaustive() == false);
+  }
+
+  // Dynamic padding compares equal to the same static padding
+  {
+    cuda::std::layout_right_padded<4>::mapping<ext3_t> m{ext3_t{2, 3, 5}};
+    cuda::std::layout_right_padded<>::mapping<ext3_t> d{ext3_t{2, 3, 5}, 4};
+
+    assert(d.stride(1) == 8);
+    assert(d == m);
+
+    cuda::std::layout_right_padded<4>::mapping<ext3_t> m2(d);
+    assert(m2 == m);
+  }
+
+  // The offset matches the strides for every padding
+  {
+    for (int pad = 1; pad < 6; ++pad)
+    {
+      cuda::std::layout_right_padded<>::mapping<ext3_t> m{ext3_t{3, 4, 5}, pad};
+      int max_offset = 0;
+      for (int i = 0; i < 3; ++i)
+      {
+        for (int j = 0; j < 4; ++j)
+        {
+          for (int k = 0; k < 5; ++k)
+          {
+            const int offset = m(i, j, k);
+            assert(offset == i * m.stride(0) + j * m.stride(1) + k);
+            max_offset = offset > max_offset ? offset : max_offset;
+          }
+        }
+      }
+      assert(max_offset + 1 == m.required_span_size());
+    }
+  }
+
+  // Static extents give a static padded stride
+  {
+    using ext2_t = cuda::std::extents<int, 3, 6>;
+    constexpr cuda::std::layout_right_padded<4>::mapping<ext2_t> m{};
+
+    static_assert(m.stride(0) == 8, "");
+    static_assert(m(1, 1) == 9, "");
+    static_assert(m.is_always_exhaustive() == false, "");
+    static_assert(cuda::std::layout_right_padded<4>::mapping<cuda::std::extents<int, 3, 8>>::is_always_exhaustive(), "");
+  }
+
+  // Rank 0 and rank 1 are never padded
+  {
+    cuda::std::layout_right_padded<4>::mapping<cuda::std::extents<int>> m0;
+    assert(m0() == 0);
+    assert(m0.required_span_size() == 1);
+
+    cuda::std::layout_right_padded<4>::mapping<cuda::std::extents<int, dyn>> m1{cuda::std::extents<int, dyn>{7}};
+    assert(m1(6) == 6);
+    assert(m1.stride(0) == 1);
+    assert(m1.required_span_size() == 7);
+  }
+
+  // Conversions from and to layout_right and layout_stride
+  {
+    cuda::std::layout_right::mapping<ext3_t> r{ext3_t{2, 3, 8}};
+    cuda::std::layout_right_padded<4>::mapping<ext3_t> m = r;
+    assert(m.is_exhaustive() == true);
+    assert(m(1, 2, 1) == r(1, 2, 1));
+
+    cuda::std::layout_right::mapping<ext3_t> r2(m);
+    assert(r2 == r);
+
+    cuda::std::layout_right_padded<4>::mapping<ext3_t> p{ext3_t{2, 3, 5}};
+    cuda::std::layout_stride::mapping<ext3_t> s = p;
+    assert(s.stride(0) == 24);
+
+    cuda::std::layout_right_padded<4>::mapping<ext3_t> p2(s);
+    assert(p2 == p);
+  }
+
+  // Constraint: is_constructible_v<extents_type, OtherExtents> is true
+  {
+    using mapping0_t = cuda::std::layout_right_padded<4>::mapping<cuda::std::extents<int, 3, 8>>;
+    using mapping1_t = cuda::std::layout_right_padded<4>::mapping<cuda::std::extents<int, 4, 8>>;
+    using mappingd_t = cuda::std::layout_right_padded<4>::mapping<cuda::std::dextents<int, 2>>;
+
+    static_assert(is_cons_avail_v<mappingd_t, mapping0_t> == true, "");
+    static_assert(is_cons_avail_v<mapping1_t, mapping0_t> == false, "");
+  }
+
+  return 0;
+}
@@ -0,0 +1,123 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+#include <cuda/std/cassert>
+#include <cuda/std/mdspan>
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+template <class Mapping>
+__host__ __device__ void test_mapping(const Mapping& m)
+{
+  const auto& e       = m.extents();
+  const int span_size = m.required_span_size();
+  const bool strided  = m.is_strided();
+  bool hit[512]       = {};
+  int count           = 0;
+  int max_offset      = -1;
+  for (int i = 0; i < e.extent(0); ++i)
+  {
+    for (int j = 0; j < e.extent(1); ++j)
+    {
+      for (int k = 0; k < e.extent(2); ++k)
+      {
+        const int offset = m(i, j, k);
+        assert(offset >= 0 && offset < span_size);
+        assert(!hit[offset]);
+        hit[offset] = true;
+        max_offset  = offset > max_offset ? offset : max_offset;
+        ++count;
+        if (strided)
+        {
+          assert(offset == i * m.stride(0) + j * m.stride(1) + k * m.stride(2));
+        }
+      }
+    }
+  }
+  assert(max_offset + 1 == span_size);
+  assert(m.is_exhaustive() == (count == span_size));
+}
+
+int main(int, char**)
+{
+  using ext3_t = cuda::std::dextents<int, 3>;
+
+  // Elements of a tile are contiguous, tiles are row major
+  {
+    using ext2_t = cuda::std::extents<int, 8, 8>;
+    constexpr cuda::std::layout_tiled<4, 4>::mapping<ext2_t> m{};
+
+    static_assert(m(0, 1) == 1, "");
+    static_assert(m(1, 0) == 4, "");
+    static_assert(m(0, 4) == 16, "");
+    static_assert(m(4, 0) == 32, "");
+    static_assert(m.required_span_size() == 64, "");
+    static_assert(m.is_always_unique() == true, "");
+    static_assert(m.is_always_exhaustive() == true, "");
+    static_assert(m.is_always_strided() == false, "");
+    static_assert(m.is_strided() == false, "");
+    static_assert(m.tile_extents().extent(0) == 4, "");
+  }
+
+  // Partial tiles at the upper end are padded
+  {
+    cuda::std::layout_tiled<4, 4>::mapping<cuda::std::dextents<int, 2>> m{cuda::std::dextents<int, 2>{6, 6}};
+    assert(m.required_span_size() == 3 * 16 + 5 + 1);
+    assert(m.is_exhaustive() == false);
+  }
+
+  // Offsets are unique and the strides are consistent where the mapping is strided
+  {
+    for (int a = 0; a < 5; ++a)
+    {
+      for (int b = 1; b < 5; ++b)
+      {
+        for (int c = 1; c < 6; ++c)
+        {
+          test_mapping(cuda::std::layout_tiled<2, 3, 4>::mapping<ext3_t>{ext3_t{a, b, c}});
+          test_mapping(cuda::std::layout_tiled<1, 3, 1>::mapping<ext3_t>{ext3_t{a, b, c}});
+          test_mapping(cuda::std::layout_tiled<1, 1, 4>::mapping<ext3_t>{ext3_t{a, b, c}});
+          test_mapping(cuda::std::layout_tiled<1, 1, 1>::mapping<ext3_t>{ext3_t{a, b, c}});
+        }
+      }
+    }
+  }
+
+  // Unit tiles reproduce layout_right
+  {
+    cuda::std::layout_tiled<1, 1, 1>::mapping<ext3_t> m{ext3_t{2, 3, 4}};
+    cuda::std::layout_right::mapping<ext3_t> r{ext3_t{2, 3, 4}};
+    assert(m.is_strided() == true);
+    assert(m.stride(0) == r.stride(0));
+    assert(m.stride(1) == r.stride(1));
+    assert(m(1, 2, 3) == r(1, 2, 3));
+  }
+
+  // Rank 0
+  {
+    cuda::std::layout_tiled<>::mapping<cuda::std::extents<int>> m;
+    assert(m() == 0);
+    assert(m.required_span_size() == 1);
+  }
+
+  // Use in mdspan and comparison
+  {
+    int data[64] = {};
+    cuda::std::mdspan<int, cuda::std::extents<int, dyn, 8>, cuda::std::layout_tiled<4, 4>> md(data, 8);
+    md(5, 6) = 42;
+    assert(data[3 * 16 + 1 * 4 + 2] == 42);
+
+    cuda::std::layout_tiled<4, 4>::mapping<cuda::std::extents<int, 8, 8>> m{};
+    assert(md.mapping() == m);
+  }
+
+  return 0;
+}
@@ -0,0 +1,123 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+#include <cuda/std/cassert>
+#include <cuda/std/mdspan>
+#include <cuda/std/type_traits>
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+int main(int, char**)
+{
+  int data[128];
+  for (int i = 0; i < 128; ++i)
+  {
+    data[i] = i;
+  }
+
+  // layout_left_padded
+  {
+    using ext_t     = cuda::std::dextents<int, 3>;
+    using mapping_t = cuda::std::layout_left_padded<4>::mapping<ext_t>;
+    cuda::std::mdspan<int, ext_t, cuda::std::layout_left_padded<4>> a(data, mapping_t{ext_t{5, 3, 4}});
+
+    // Full leftmost dimension keeps the padding, which becomes dynamic with dynamic extents
+    auto s1 = cuda::std::submdspan(a, cuda::std::full_extent, cuda::std::full_extent, 1);
+    static_assert(cuda::std::is_same<decltype(s1)::layout_type, cuda::std::layout_left_padded<dyn>>::value, "");
+    assert(s1.mapping().stride(1) == 8);
+    for (int i = 0; i < 5; ++i)
+    {
+      for (int j = 0; j < 3; ++j)
+      {
+        assert(s1(i, j) == a(i, j, 1));
+      }
+    }
+
+    // A leading range and a trailing range keep the padding
+    auto s2 =
+      cuda::std::submdspan(a, cuda::std::pair<int, int>{1, 3}, cuda::std::full_extent, cuda::std::pair<int, int>{1, 3});
+    static_assert(cuda::std::is_same<decltype(s2)::layout_type, cuda::std::layout_left_padded<dyn>>::value, "");
+    for (int i = 0; i < 2; ++i)
+    {
+      for (int j = 0; j < 3; ++j)
+      {
+        for (int k = 0; k < 2; ++k)
+        {
+          assert(s2(i, j, k) == a(i + 1, j, k + 1));
+        }
+      }
+    }
+
+    // Rank one results are plain layout_left
+    auto s3 = cuda::std::submdspan(a, cuda::std::full_extent, 1, 2);
+    static_assert(cuda::std::is_same<decltype(s3)::layout_type, cuda::std::layout_left>::value, "");
+    assert(s3(3) == a(3, 1, 2));
+
+    // Slicing the leftmost dimension falls back to layout_stride
+    auto s4 = cuda::std::submdspan(a, 1, cuda::std::full_extent, cuda::std::full_extent);
+    static_assert(cuda::std::is_same<decltype(s4)::layout_type, cuda::std::layout_stride>::value, "");
+    for (int j = 0; j < 3; ++j)
+    {
+      for (int k = 0; k < 4; ++k)
+      {
+        assert(s4(j, k) == a(1, j, k));
+      }
+    }
+  }
+
+  // layout_right_padded
+  {
+    using ext_t = cuda::std::extents<int, 3, 4, 6>;
+    cuda::std::mdspan<int, ext_t, cuda::std::layout_right_padded<4>> a(data);
+
+    // Static extents keep a static padding
+    auto s1 = cuda::std::submdspan(a, 2, cuda::std::full_extent, cuda::std::full_extent);
+    static_assert(cuda::std::is_same<decltype(s1)::layout_type, cuda::std::layout_right_padded<8>>::value, "");
+    for (int j = 0; j < 4; ++j)
+    {
+      for (int k = 0; k < 6; ++k)
+      {
+        assert(s1(j, k) == a(2, j, k));
+      }
+    }
+
+    auto s2 =
+      cuda::std::submdspan(a, cuda::std::pair<int, int>{1, 3}, cuda::std::full_extent, cuda::std::pair<int, int>{2, 5});
+    static_assert(cuda::std::is_same<decltype(s2)::layout_type, cuda::std::layout_right_padded<8>>::value, "");
+    for (int i = 0; i < 2; ++i)
+    {
+      for (int j = 0; j < 4; ++j)
+      {
+        for (int k = 0; k < 3; ++k)
+        {
+          assert(s2(i, j, k) == a(i + 1, j, k + 2));
+        }
+      }
+    }
+
+    auto s3 = cuda::std::submdspan(a, 1, 2, cuda::std::full_extent);
+    static_assert(cuda::std::is_same<decltype(s3)::layout_type, cuda::std::layout_right>::value, "");
+    assert(s3(5) == a(1, 2, 5));
+
+    auto s4 = cuda::std::submdspan(a, cuda::std::full_extent, cuda::std::full_extent, 1);
+    static_assert(cuda::std::is_same<decltype(s4)::layout_type, cuda::std::layout_stride>::value, "");
+    for (int i = 0; i < 3; ++i)
+    {
+      for (int j = 0; j < 4; ++j)
+      {
+        assert(s4(i, j) == a(i, j, 1));
+      }
+    }
+  }
+
+  return 0;
+}
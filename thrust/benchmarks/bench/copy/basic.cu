@@ -68,6 +68,8 @@ struct non_trivial
       : a(nt.a)
       , b(nt.b)
   {}
+
+  non_trivial& operator=(const non_trivial&) = default;
 };
 
 static_assert(!::cuda::std::is_trivially_copyable<non_trivial>::value, ""); // as required by the C++ standard
@@ -0,0 +1,100 @@
+/******************************************************************************
+ * Copyright (c) 2025, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+#include <thrust/mr/disjoint_pool.h>
+#include <thrust/mr/new.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "nvbench_helper.cuh"
+
+// Frees and reallocates a fixed number of oversized blocks of a pool holding a growing number of live oversized
+// blocks. Every free has to look its block up among all of them, so the time per free should not depend on the number
+// of live blocks.
+static void oversized_free(nvbench::state& state)
+{
+  using pool_t = thrust::mr::disjoint_unsynchronized_pool_resource<thrust::mr::new_delete_resource,
+                                                                    thrust::mr::new_delete_resource>;
+
+  const auto live_blocks = static_cast<std::size_t>(state.get_int64("LiveBlocks"));
+  const std::size_t frees = 256;
+
+  thrust::mr::new_delete_resource upstream;
+  thrust::mr::new_delete_resource bookkeeper;
+
+  thrust::mr::pool_options options = pool_t::get_default_options();
+  options.largest_block_size       = 1024;
+  options.cache_oversized          = state.get_int64("CacheOversized") != 0;
+
+  pool_t pool(&upstream, &bookkeeper, options);
+
+  auto block_size = [&](std::size_t i) {
+    return options.largest_block_size * 2 + (i % 64) * 64;
+  };
+
+  std::vector<void*> blocks(live_blocks);
+  for (std::size_t i = 0; i < live_blocks; ++i)
+  {
+    blocks[i] = pool.do_allocate(block_size(i));
+  }
+
+  std::vector<std::size_t> victims(live_blocks);
+  for (std::size_t i = 0; i < live_blocks; ++i)
+  {
+    victims[i] = i;
+  }
+  std::mt19937 rng(1234);
+
+  state.add_element_count(frees);
+  state.exec(nvbench::exec_tag::timer | nvbench::exec_tag::no_batch, [&](nvbench::launch&, auto& timer) {
+    std::shuffle(victims.begin(), victims.end(), rng);
+
+    timer.start();
+    for (std::size_t i = 0; i < frees; ++i)
+    {
+      pool.do_deallocate(blocks[victims[i]], block_size(victims[i]));
+    }
+    timer.stop();
+
+    for (std::size_t i = 0; i < frees; ++i)
+    {
+      blocks[victims[i]] = pool.do_allocate(block_size(victims[i]));
+    }
+  });
+
+  for (std::size_t i = 0; i < live_blocks; ++i)
+  {
+    pool.do_deallocate(blocks[i], block_size(i));
+  }
+}
+
+NVBENCH_BENCH(oversized_free)
+  .set_name("oversized_free")
+  .add_int64_power_of_two_axis("LiveBlocks", nvbench::range(8, 16, 2))
+  .add_int64_axis("CacheOversized", {0, 1});
@@ -0,0 +1,88 @@
+/******************************************************************************
+ * Copyright (c) 2025, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+#include <thrust/fill.h>
+#include <thrust/reduce.h>
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+#  include <thrust/system/omp/execution_policy.h>
+#  include <thrust/system/omp/memory_resource.h>
+
+#  include <algorithm>
+#endif
+
+#include "nvbench_helper.cuh"
+
+// Reduces data whose pages were placed on the NUMA nodes in different ways. With threads bound to cores (e.g.
+// OMP_PROC_BIND=close OMP_PLACES=cores) on a host with several nodes, "serial" pages all live on the node of the main
+// thread, so that the threads on the other nodes read remote memory, "first_touch" pages live on the node of the
+// thread which reduces them, and "interleave" pages are spread over all nodes.
+template <typename T>
+static void placement(nvbench::state& state, nvbench::type_list<T>)
+{
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+  const auto elements          = static_cast<std::size_t>(state.get_int64("Elements"));
+  const std::string& placement = state.get_string("Placement");
+
+  thrust::system::omp::first_touch_memory_resource first_touch;
+  thrust::system::omp::interleaved_memory_resource interleaved;
+
+  thrust::mr::memory_resource<thrust::omp::pointer<void>>& resource =
+    placement == "interleave" ? static_cast<thrust::mr::memory_resource<thrust::omp::pointer<void>>&>(interleaved)
+                              : first_touch;
+
+  T* in = static_cast<T*>(resource.allocate(elements * sizeof(T), alignof(T)).get());
+
+  if (placement == "serial")
+  {
+    std::fill(in, in + elements, T{1});
+  }
+  else
+  {
+    // touches the pages with the decomposition of the reduction
+    thrust::fill(thrust::omp::par, in, in + elements, T{1});
+  }
+
+  state.add_element_count(elements);
+  state.add_global_memory_reads<T>(elements);
+  state.add_global_memory_writes<T>(1);
+
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    do_not_optimize(thrust::reduce(thrust::omp::par, in, in + elements));
+  });
+
+  resource.deallocate(thrust::omp::pointer<void>(in), elements * sizeof(T), alignof(T));
+#else
+  state.skip("Page placement only applies to the OMP system");
+#endif
+}
+
+NVBENCH_BENCH_TYPES(placement, NVBENCH_TYPE_AXES(nvbench::type_list<nvbench::int32_t, nvbench::float64_t>))
+  .set_name("placement")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(24, 28, 2))
+  .add_string_axis("Placement", {"serial", "first_touch", "interleave"});
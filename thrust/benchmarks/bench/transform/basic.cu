@@ -69,7 +69,7 @@ struct fib_t
 };
 
 template <typename... Args>
-void bench_transform(nvbench::state& state, Args&&... args)
+static void bench_transform(nvbench::state& state, Args&&... args)
 {
   caching_allocator_t alloc; // transform shouldn't allocate, but let's be consistent
   state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
@@ -85,10 +85,26 @@ function(thrust_add_header_test thrust_target label definitions)
 
   # List of headers that aren't implemented for all backends, but are implemented for TBB.
   set(partially_implemented_TBB
+    thrust/async/copy.h
+    thrust/async/for_each.h
+    thrust/async/reduce.h
+    thrust/async/scan.h
+    thrust/async/sort.h
+    thrust/async/transform.h
+    thrust/event.h
+    thrust/future.h
   )
 
   # List of headers that aren't implemented for all backends, but are implemented for OMP.
   set(partially_implemented_OMP
+    thrust/async/copy.h
+    thrust/async/for_each.h
+    thrust/async/reduce.h
+    thrust/async/scan.h
+    thrust/async/sort.h
+    thrust/async/transform.h
+    thrust/event.h
+    thrust/future.h
   )
 
   # List of all partially implemented headers.
@@ -4,6 +4,11 @@
 #include <thrust/mr/disjoint_sync_pool.h>
 #include <thrust/mr/new.h>
 
+#include <cstring>
+#include <set>
+#include <thread>
+#include <vector>
+
 #include <unittest/unittest.h>
 
 struct alloc_id
@@ -282,3 +287,192 @@ void TestSynchronizedDisjointGlobalPool()
   TestDisjointGlobalPool<thrust::mr::disjoint_synchronized_pool_resource>();
 }
 DECLARE_UNITTEST(TestSynchronizedDisjointGlobalPool);
+
+class counting_resource final : public thrust::mr::memory_resource<>
+{
+public:
+  counting_resource()
+      : allocations(0)
+      , deallocations(0)
+  {}
+
+  virtual void* do_allocate(std::size_t bytes, std::size_t alignment) override
+  {
+    ++allocations;
+    return upstream.do_allocate(bytes, alignment);
+  }
+
+  virtual void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+  {
+    ++deallocations;
+    upstream.do_deallocate(p, bytes, alignment);
+  }
+
+  thrust::mr::new_delete_resource upstream;
+  std::size_t allocations;
+  std::size_t deallocations;
+};
+
+template <template <typename, typename> class PoolTemplate>
+void TestDisjointPoolManyOversized()
+{
+  counting_resource upstream;
+  thrust::mr::new_delete_resource bookkeeper;
+
+  using Pool = PoolTemplate<counting_resource, thrust::mr::new_delete_resource>;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.largest_block_size       = 1024;
+
+  const std::size_t n = 1000;
+  auto block_size     = [](std::size_t i) {
+    return 2048 + (i % 37) * 64;
+  };
+
+  for (int cache = 0; cache < 2; ++cache)
+  {
+    opts.cache_oversized = cache == 1;
+
+    {
+      Pool pool(&upstream, &bookkeeper, opts);
+
+      std::vector<void*> blocks(n);
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        blocks[i] = pool.do_allocate(block_size(i), 32);
+      }
+
+      // free the blocks in an order unrelated to their allocation order or size
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        const std::size_t j = (i * 389) % n;
+        pool.do_deallocate(blocks[j], block_size(j), 32);
+      }
+
+      if (opts.cache_oversized)
+      {
+        // every block is cached, so allocating the same sizes again does not go upstream
+        const std::size_t allocations = upstream.allocations;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+          blocks[i] = pool.do_allocate(block_size(i), 32);
+        }
+        ASSERT_EQUAL(upstream.allocations, allocations);
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+          pool.do_deallocate(blocks[i], block_size(i), 32);
+        }
+      }
+      else
+      {
+        ASSERT_EQUAL(upstream.deallocations, upstream.allocations);
+      }
+    }
+
+    ASSERT_EQUAL(upstream.deallocations, upstream.allocations);
+  }
+}
+
+void TestDisjointUnsynchronizedPoolManyOversized()
+{
+  TestDisjointPoolManyOversized<thrust::mr::disjoint_unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointUnsynchronizedPoolManyOversized);
+
+void TestDisjointSynchronizedPoolManyOversized()
+{
+  TestDisjointPoolManyOversized<thrust::mr::disjoint_synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointSynchronizedPoolManyOversized);
+
+template <template <typename, typename> class PoolTemplate>
+void TestDisjointPoolCrossThreadDeallocation()
+{
+  using Pool = PoolTemplate<thrust::mr::new_delete_resource, thrust::mr::new_delete_resource>;
+
+  const std::size_t thread_count      = 4;
+  const std::size_t blocks_per_size   = 300;
+  const std::size_t sizes[]           = {8, 24, 64, 1000, 4096};
+  const std::size_t blocks_per_thread = blocks_per_size * (sizeof(sizes) / sizeof(*sizes));
+
+  Pool pool;
+
+  // every thread allocates blocks and stamps them with its index
+  std::vector<std::vector<void*>> blocks(thread_count);
+  auto allocate = [&](std::size_t t) {
+    for (std::size_t i = 0; i < blocks_per_thread; ++i)
+    {
+      std::size_t size = sizes[i % (sizeof(sizes) / sizeof(*sizes))];
+      void* p          = pool.do_allocate(size);
+      std::memset(p, static_cast<int>(t), size);
+      blocks[t].push_back(p);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < thread_count; ++t)
+  {
+    threads.emplace_back(allocate, t);
+  }
+  for (std::size_t t = 0; t < thread_count; ++t)
+  {
+    threads[t].join();
+  }
+  threads.clear();
+
+  // then frees the blocks of its neighbor, and allocates them again
+  std::vector<std::size_t> errors(thread_count);
+  auto exchange = [&](std::size_t t) {
+    std::vector<void*>& neighbor = blocks[(t + 1) % thread_count];
+    for (std::size_t i = 0; i < blocks_per_thread; ++i)
+    {
+      std::size_t size = sizes[i % (sizeof(sizes) / sizeof(*sizes))];
+      unsigned char* p = static_cast<unsigned char*>(neighbor[i]);
+      errors[t] += p[0] != (t + 1) % thread_count || p[size - 1] != (t + 1) % thread_count;
+      pool.do_deallocate(p, size);
+    }
+    neighbor.clear();
+    allocate((t + 1) % thread_count);
+  };
+
+  for (std::size_t t = 0; t < thread_count; ++t)
+  {
+    threads.emplace_back(exchange, t);
+  }
+  for (std::size_t t = 0; t < thread_count; ++t)
+  {
+    threads[t].join();
+  }
+
+  // no block may have been handed out twice
+  std::set<void*> unique;
+  for (std::size_t t = 0; t < thread_count; ++t)
+  {
+    ASSERT_EQUAL(errors[t], 0u);
+    for (std::size_t i = 0; i < blocks_per_thread; ++i)
+    {
+      std::size_t size = sizes[i % (sizeof(sizes) / sizeof(*sizes))];
+      unsigned char* p = static_cast<unsigned char*>(blocks[t][i]);
+      ASSERT_EQUAL(static_cast<std::size_t>(p[0]), t);
+      ASSERT_EQUAL(static_cast<std::size_t>(p[size - 1]), t);
+      unique.insert(p);
+    }
+  }
+  ASSERT_EQUAL(unique.size(), thread_count * blocks_per_thread);
+
+  // the threads are gone, but their cached blocks remain usable
+  for (std::size_t t = 0; t < thread_count; ++t)
+  {
+    for (std::size_t i = 0; i < blocks_per_thread; ++i)
+    {
+      pool.do_deallocate(blocks[t][i], sizes[i % (sizeof(sizes) / sizeof(*sizes))]);
+    }
+  }
+}
+
+void TestDisjointSynchronizedPoolCrossThreadDeallocation()
+{
+  TestDisjointPoolCrossThreadDeallocation<thrust::mr::disjoint_synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointSynchronizedPoolCrossThreadDeallocation);
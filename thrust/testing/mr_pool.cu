@@ -4,6 +4,12 @@
 #include <thrust/mr/pool.h>
 #include <thrust/mr/sync_pool.h>
 
+#include <atomic>
+#include <cstring>
+#include <set>
+#include <thread>
+#include <vector>
+
 #include <unittest/unittest.h>
 
 template <typename T>
@@ -372,3 +378,199 @@ void TestSynchronizedGlobalPool()
   TestGlobalPool<thrust::mr::synchronized_pool_resource>();
 }
 DECLARE_UNITTEST(TestSynchronizedGlobalPool);
+
+template <template <typename> class PoolTemplate>
+void TestPoolCrossThreadDeallocation()
+{
+  using Pool = PoolTemplate<thrust::mr::new_delete_resource>;
+
+  const std::size_t thread_count      = 4;
+  const std::size_t blocks_per_size   = 300;
+  const std::size_t sizes[]           = {8, 24, 64, 1000, 4096};
+  const std::size_t blocks_per_thread = blocks_per_size * (sizeof(sizes) / sizeof(*sizes));
+
+  Pool pool;
+
+  // every thread allocates blocks and stamps them with its index
+  std::vector<std::vector<void*>> blocks(thread_count);
+  auto allocate = [&](std::size_t t) {
+    for (std::size_t i = 0; i < blocks_per_thread; ++i)
+    {
+      std::size_t size = sizes[i % (sizeof(sizes) / sizeof(*sizes))];
+      void* p          = pool.do_allocate(size);
+      std::memset(p, static_cast<int>(t), size);
+      blocks[t].push_back(p);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < thread_count; ++t)
+  {
+    threads.emplace_back(allocate, t);
+  }
+  for (std::size_t t = 0; t < thread_count; ++t)
+  {
+    threads[t].join();
+  }
+  threads.clear();
+
+  // then frees the blocks of its neighbor, and allocates them again
+  std::vector<std::size_t> errors(thread_count);
+  auto exchange = [&](std::size_t t) {
+    std::vector<void*>& neighbor = blocks[(t + 1) % thread_count];
+    for (std::size_t i = 0; i < blocks_per_thread; ++i)
+    {
+      std::size_t size = sizes[i % (sizeof(sizes) / sizeof(*sizes))];
+      unsigned char* p = static_cast<unsigned char*>(neighbor[i]);
+      errors[t] += p[0] != (t + 1) % thread_count || p[size - 1] != (t + 1) % thread_count;
+      pool.do_deallocate(p, size);
+    }
+    neighbor.clear();
+    allocate((t + 1) % thread_count);
+  };
+
+  for (std::size_t t = 0; t < thread_count; ++t)
+  {
+    threads.emplace_back(exchange, t);
+  }
+  for (std::size_t t = 0; t < thread_count; ++t)
+  {
+    threads[t].join();
+  }
+
+  // no block may have been handed out twice
+  std::set<void*> unique;
+  for (std::size_t t = 0; t < thread_count; ++t)
+  {
+    ASSERT_EQUAL(errors[t], 0u);
+    for (std::size_t i = 0; i < blocks_per_thread; ++i)
+    {
+      std::size_t size = sizes[i % (sizeof(sizes) / sizeof(*sizes))];
+      unsigned char* p = static_cast<unsigned char*>(blocks[t][i]);
+      ASSERT_EQUAL(static_cast<std::size_t>(p[0]), t);
+      ASSERT_EQUAL(static_cast<std::size_t>(p[size - 1]), t);
+      unique.insert(p);
+    }
+  }
+  ASSERT_EQUAL(unique.size(), thread_count * blocks_per_thread);
+
+  // the threads are gone, but their cached blocks remain usable
+  for (std::size_t t = 0; t < thread_count; ++t)
+  {
+    for (std::size_t i = 0; i < blocks_per_thread; ++i)
+    {
+      pool.do_deallocate(blocks[t][i], sizes[i % (sizeof(sizes) / sizeof(*sizes))]);
+    }
+  }
+}
+
+void TestSynchronizedPoolCrossThreadDeallocation()
+{
+  TestPoolCrossThreadDeallocation<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolCrossThreadDeallocation);
+
+template <template <typename> class PoolTemplate>
+void TestPoolReleaseWithLiveThread()
+{
+  tracked_resource upstream;
+
+  upstream.id_to_allocate = -1u;
+
+  using Pool = PoolTemplate<tracked_resource>;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.cache_oversized          = false;
+
+  Pool* pool = new Pool(&upstream, opts);
+
+  // the thread and the main thread take turns, so that the thread keeps its cached blocks across the release
+  std::atomic<int> step(0);
+  auto wait_for = [&](int s) {
+    while (step.load() != s)
+    {
+      std::this_thread::yield();
+    }
+  };
+
+  tracked_pointer<void> a1, a2;
+  std::thread thread([&] {
+    upstream.id_to_allocate = 1;
+    a1                      = pool->do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+    pool->do_deallocate(a1, 16, THRUST_MR_DEFAULT_ALIGNMENT);
+    step.store(1);
+
+    wait_for(2);
+    upstream.id_to_allocate = 2;
+    a2                      = pool->do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+    step.store(3);
+  });
+
+  wait_for(1);
+  upstream.id_to_deallocate = 1;
+  pool->release();
+  ASSERT_EQUAL(upstream.id_to_deallocate, 0u);
+  step.store(2);
+
+  // the blocks still cached by the thread were returned to upstream, so it must not get any of them back
+  wait_for(3);
+  thread.join();
+  ASSERT_EQUAL(a1.id, 1u);
+  ASSERT_EQUAL(upstream.id_to_allocate, 0u);
+  ASSERT_EQUAL(a2.id, 2u);
+
+  upstream.id_to_deallocate = 2;
+  delete pool;
+  ASSERT_EQUAL(upstream.id_to_deallocate, 0u);
+}
+
+void TestSynchronizedPoolReleaseWithLiveThread()
+{
+  TestPoolReleaseWithLiveThread<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolReleaseWithLiveThread);
+
+template <typename Pool>
+struct deallocate_at_thread_exit
+{
+  Pool* pool       = nullptr;
+  void* block      = nullptr;
+  std::size_t size = 0;
+
+  ~deallocate_at_thread_exit()
+  {
+    if (pool)
+    {
+      pool->do_deallocate(block, size);
+      pool->do_deallocate(pool->do_allocate(size), size);
+    }
+  }
+};
+
+template <template <typename> class PoolTemplate>
+void TestPoolUseDuringThreadExit()
+{
+  using Pool = PoolTemplate<thrust::mr::new_delete_resource>;
+
+  Pool pool;
+
+  // the hook is constructed before the thread starts using the pool, so it is destroyed after the per-thread state of
+  // the pool
+  std::thread thread([&] {
+    static thread_local deallocate_at_thread_exit<Pool> hook;
+    hook.pool  = &pool;
+    hook.size  = 64;
+    hook.block = pool.do_allocate(hook.size);
+  });
+  thread.join();
+
+  void* p = pool.do_allocate(64);
+  ASSERT_EQUAL(p != nullptr, true);
+  pool.do_deallocate(p, 64);
+}
+
+void TestSynchronizedPoolUseDuringThreadExit()
+{
+  TestPoolUseDuringThreadExit<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolUseDuringThreadExit);
@@ -0,0 +1,117 @@
+#include <thrust/count.h>
+#include <thrust/sequence.h>
+#include <thrust/system/omp/memory_resource.h>
+#include <thrust/system/omp/vector.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <unittest/unittest.h>
+
+#if defined(__linux__)
+#  include <sys/mman.h>
+#  include <unistd.h>
+#endif
+
+template <typename Resource>
+void TestOmpPageResourceAlignment()
+{
+  Resource resource;
+
+  for (std::size_t alignment : {std::size_t{1}, std::size_t{64}, std::size_t{4096}, std::size_t{1} << 21})
+  {
+    for (std::size_t bytes : {std::size_t{1}, std::size_t{1000}, std::size_t{1} << 20})
+    {
+      thrust::omp::pointer<void> p = resource.allocate(bytes, alignment);
+      ASSERT_EQUAL(reinterpret_cast<std::uintptr_t>(p.get()) % alignment, 0u);
+
+      // the whole block is usable
+      unsigned char* bytes_ptr = static_cast<unsigned char*>(p.get());
+      bytes_ptr[0]             = 1;
+      bytes_ptr[bytes - 1]     = 1;
+
+      resource.deallocate(p, bytes, alignment);
+    }
+  }
+}
+
+void TestOmpFirstTouchResourceAlignment()
+{
+  TestOmpPageResourceAlignment<thrust::system::omp::first_touch_memory_resource>();
+}
+DECLARE_UNITTEST(TestOmpFirstTouchResourceAlignment);
+
+void TestOmpInterleavedResourceAlignment()
+{
+  TestOmpPageResourceAlignment<thrust::system::omp::interleaved_memory_resource>();
+}
+DECLARE_UNITTEST(TestOmpInterleavedResourceAlignment);
+
+#if defined(__linux__)
+void TestOmpFirstTouchResourcePagesAreUntouched()
+{
+  thrust::system::omp::first_touch_memory_resource resource;
+
+  const std::size_t page  = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+  const std::size_t pages = 64;
+
+  // unlike with a heap, the pages of a freed block are not handed out again
+  thrust::omp::pointer<void> previous = resource.allocate(pages * page);
+  std::memset(previous.get(), 1, pages * page);
+  resource.deallocate(previous, pages * page);
+
+  thrust::omp::pointer<void> p = resource.allocate(pages * page);
+
+  std::vector<unsigned char> resident(pages);
+  ASSERT_EQUAL(::mincore(p.get(), pages * page, resident.data()), 0);
+
+  for (std::size_t i = 0; i < pages; ++i)
+  {
+    ASSERT_EQUAL(resident[i] & 1, 0);
+  }
+
+  resource.deallocate(p, pages * page);
+}
+DECLARE_UNITTEST(TestOmpFirstTouchResourcePagesAreUntouched);
+#endif
+
+template <typename Vector>
+void TestOmpPlacedVector()
+{
+  using T = typename Vector::value_type;
+
+  Vector v(10000, T(7));
+  ASSERT_EQUAL(v.size(), 10000u);
+  ASSERT_EQUAL(thrust::count(v.begin(), v.end(), T(7)), 10000);
+
+  Vector zeros(777);
+  ASSERT_EQUAL(thrust::count(zeros.begin(), zeros.end(), T(0)), 777);
+
+  thrust::sequence(v.begin(), v.end());
+  v.resize(20000);
+
+  thrust::host_vector<T> h_v(20000);
+  thrust::sequence(h_v.begin(), h_v.begin() + 10000);
+  ASSERT_EQUAL(h_v, thrust::host_vector<T>(v.begin(), v.end()));
+
+  Vector copy = v;
+  ASSERT_EQUAL(h_v, thrust::host_vector<T>(copy.begin(), copy.end()));
+
+  Vector from_host(h_v.begin(), h_v.end());
+  ASSERT_EQUAL(h_v, thrust::host_vector<T>(from_host.begin(), from_host.end()));
+}
+
+void TestOmpFirstTouchVector()
+{
+  TestOmpPlacedVector<thrust::omp::first_touch_vector<int>>();
+  TestOmpPlacedVector<thrust::omp::first_touch_vector<double>>();
+}
+DECLARE_UNITTEST(TestOmpFirstTouchVector);
+
+void TestOmpInterleavedVector()
+{
+  TestOmpPlacedVector<thrust::omp::interleaved_vector<int>>();
+  TestOmpPlacedVector<thrust::omp::interleaved_vector<double>>();
+}
+DECLARE_UNITTEST(TestOmpInterleavedVector);
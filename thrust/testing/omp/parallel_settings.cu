@@ -0,0 +1,123 @@
+#include <thrust/for_each.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/execution_policy.h>
+#include <thrust/system/omp/vector.h>
+
+#include <memory>
+
+#include <omp.h>
+#include <unittest/unittest.h>
+
+struct record_team_size
+{
+  void operator()(int& x) const
+  {
+    x = omp_get_num_threads();
+  }
+};
+
+void TestOmpParNumThreads()
+{
+  thrust::omp::vector<int> team_sizes(1000, 0);
+
+  thrust::for_each(thrust::omp::par.num_threads(3), team_sizes.begin(), team_sizes.end(), record_team_size());
+  ASSERT_EQUAL(thrust::reduce(team_sizes.begin(), team_sizes.end(), 0, thrust::maximum<int>()), 3);
+
+  thrust::for_each(thrust::omp::par.num_threads(1), team_sizes.begin(), team_sizes.end(), record_team_size());
+  ASSERT_EQUAL(thrust::reduce(team_sizes.begin(), team_sizes.end(), 0, thrust::maximum<int>()), 1);
+
+  // the allocator and the settings can be attached in any order
+  std::allocator<int> alloc;
+  thrust::for_each(thrust::omp::par(alloc).num_threads(2), team_sizes.begin(), team_sizes.end(), record_team_size());
+  ASSERT_EQUAL(thrust::reduce(team_sizes.begin(), team_sizes.end(), 0, thrust::maximum<int>()), 2);
+
+  thrust::for_each(thrust::omp::par.num_threads(2)(alloc), team_sizes.begin(), team_sizes.end(), record_team_size());
+  ASSERT_EQUAL(thrust::reduce(team_sizes.begin(), team_sizes.end(), 0, thrust::maximum<int>()), 2);
+
+  auto settings_first =
+    thrust::omp::par.schedule(thrust::omp::schedule_kind::dynamic_schedule, 5)(std::allocator<int>());
+  ASSERT_EQUAL(static_cast<int>(get_parallel_settings(settings_first).schedule),
+               static_cast<int>(thrust::omp::schedule_kind::dynamic_schedule));
+  ASSERT_EQUAL(get_parallel_settings(settings_first).chunk_size, 5);
+}
+DECLARE_UNITTEST(TestOmpParNumThreads);
+
+void TestOmpParScheduleIsRestored()
+{
+  omp_sched_t kind_before;
+  int chunk_size_before;
+  omp_get_schedule(&kind_before, &chunk_size_before);
+
+  thrust::omp::vector<int> data(1000, 0);
+  thrust::for_each(thrust::omp::par.schedule(thrust::omp::schedule_kind::guided_schedule, 7),
+                   data.begin(),
+                   data.end(),
+                   record_team_size());
+
+  omp_sched_t kind_after;
+  int chunk_size_after;
+  omp_get_schedule(&kind_after, &chunk_size_after);
+
+  ASSERT_EQUAL(static_cast<int>(kind_before), static_cast<int>(kind_after));
+  ASSERT_EQUAL(chunk_size_before, chunk_size_after);
+}
+DECLARE_UNITTEST(TestOmpParScheduleIsRestored);
+
+void TestOmpDefaultDecompositionFollowsTeamSize()
+{
+  using thrust::system::omp::detail::default_decomposition;
+
+  const int max_threads = omp_get_max_threads();
+
+  omp_set_num_threads(3);
+  ASSERT_EQUAL(default_decomposition(1000).size(), 3);
+
+  // a policy's thread count takes precedence over the one of the calling thread
+  thrust::system::omp::detail::execute_with_settings exec = thrust::omp::par.num_threads(5);
+  ASSERT_EQUAL(default_decomposition(exec, 1000).size(), 5);
+
+  // there are never more intervals than elements
+  ASSERT_EQUAL(default_decomposition(exec, 2).size(), 2);
+
+  omp_set_num_threads(max_threads);
+}
+DECLARE_UNITTEST(TestOmpDefaultDecompositionFollowsTeamSize);
+
+template <typename T>
+struct TestOmpParSettings
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> h_data   = unittest::random_integers<T>(n);
+    thrust::omp::vector<T> omp_data = h_data;
+
+    const auto policies = {thrust::omp::par.num_threads(3),
+                           thrust::omp::par.num_threads(4).schedule(thrust::omp::schedule_kind::static_schedule, 5),
+                           thrust::omp::par.schedule(thrust::omp::schedule_kind::dynamic_schedule, 64),
+                           thrust::omp::par.num_threads(2).schedule(thrust::omp::schedule_kind::guided_schedule)};
+
+    thrust::host_vector<T> h_result(n);
+    thrust::inclusive_scan(h_data.begin(), h_data.end(), h_result.begin());
+
+    thrust::host_vector<T> h_sorted = h_data;
+    thrust::sort(h_sorted.begin(), h_sorted.end());
+
+    for (auto policy : policies)
+    {
+      ASSERT_EQUAL(thrust::reduce(policy, omp_data.begin(), omp_data.end()),
+                   thrust::reduce(h_data.begin(), h_data.end()));
+
+      thrust::omp::vector<T> omp_result(n);
+      thrust::inclusive_scan(policy, omp_data.begin(), omp_data.end(), omp_result.begin());
+      ASSERT_EQUAL(h_result, omp_result);
+
+      thrust::omp::vector<T> omp_sorted = omp_data;
+      thrust::sort(policy, omp_sorted.begin(), omp_sorted.end());
+      ASSERT_EQUAL(h_sorted, omp_sorted);
+    }
+  }
+};
+VariableUnitTest<TestOmpParSettings, IntegralTypes> TestOmpParSettingsInstance;
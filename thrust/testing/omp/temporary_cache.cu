@@ -0,0 +1,140 @@
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/system/cpp/execution_policy.h>
+#include <thrust/system/cpp/memory.h>
+#include <thrust/system/omp/execution_policy.h>
+#include <thrust/system/omp/memory.h>
+#include <thrust/system/omp/vector.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <unittest/unittest.h>
+
+void TestOmpTemporaryCacheReusesBuffers()
+{
+  thrust::omp::trim_temporary_cache();
+  const thrust::omp::temporary_cache_statistics before = thrust::omp::get_temporary_cache_statistics();
+  ASSERT_EQUAL(before.cached_bytes, 0u);
+
+  thrust::omp::vector<int> v(1 << 16);
+  thrust::omp::temporary_cache_allocator<char> alloc;
+
+  for (int i = 0; i < 10; ++i)
+  {
+    thrust::sequence(v.begin(), v.end(), static_cast<int>(v.size()), -1);
+    thrust::stable_sort(thrust::omp::par(alloc), v.begin(), v.end());
+
+    ASSERT_EQUAL(v[0], 1);
+    ASSERT_EQUAL(v[v.size() - 1], static_cast<int>(v.size()));
+  }
+
+  // only the first sort has to allocate its buffers
+  const thrust::omp::temporary_cache_statistics after = thrust::omp::get_temporary_cache_statistics();
+  const std::size_t misses                             = after.misses - before.misses;
+  const std::size_t hits                               = after.hits - before.hits;
+  ASSERT_EQUAL(misses > 0, true);
+  ASSERT_EQUAL(hits >= 9 * misses, true);
+  ASSERT_EQUAL(after.cached_bytes > 0, true);
+
+  thrust::omp::trim_temporary_cache();
+  ASSERT_EQUAL(thrust::omp::get_temporary_cache_statistics().cached_bytes, 0u);
+}
+DECLARE_UNITTEST(TestOmpTemporaryCacheReusesBuffers);
+
+void TestOmpTemporaryCacheTrim()
+{
+  thrust::omp::trim_temporary_cache();
+
+  thrust::omp::temporary_cache_allocator<char> alloc;
+
+  {
+    char* small = alloc.allocate(1000);
+    char* large = alloc.allocate(1000000);
+
+    // the buffers are aligned as by std::malloc
+    ASSERT_EQUAL(reinterpret_cast<std::uintptr_t>(small) % alignof(std::max_align_t), 0u);
+    ASSERT_EQUAL(reinterpret_cast<std::uintptr_t>(large) % alignof(std::max_align_t), 0u);
+
+    alloc.deallocate(small, 1000);
+    alloc.deallocate(large, 1000000);
+  }
+
+  // both buffers are cached, rounded up to powers of two
+  ASSERT_EQUAL(thrust::omp::get_temporary_cache_statistics().cached_bytes, 1024u + (1u << 20));
+
+  // the largest buffers are freed first
+  thrust::omp::trim_temporary_cache(1u << 20);
+  ASSERT_EQUAL(thrust::omp::get_temporary_cache_statistics().cached_bytes, 1024u);
+
+  thrust::omp::trim_temporary_cache();
+  ASSERT_EQUAL(thrust::omp::get_temporary_cache_statistics().cached_bytes, 0u);
+}
+DECLARE_UNITTEST(TestOmpTemporaryCacheTrim);
+
+void TestOmpTemporaryCacheIsBounded()
+{
+  thrust::omp::trim_temporary_cache();
+
+  thrust::omp::temporary_cache_allocator<char> alloc;
+
+  // buffers allocated by another thread and freed by this one
+  std::vector<char*> buffers(16);
+  std::thread thread([&] {
+    for (std::size_t i = 0; i < buffers.size(); ++i)
+    {
+      buffers[i] = alloc.allocate(4096);
+    }
+  });
+  thread.join();
+
+  for (std::size_t i = 0; i < buffers.size(); ++i)
+  {
+    alloc.deallocate(buffers[i], 4096);
+  }
+
+  // only a few of them stay in the cache of this thread, the others go back to std::free
+  const std::size_t cached_bytes = thrust::omp::get_temporary_cache_statistics().cached_bytes;
+  ASSERT_EQUAL(cached_bytes > 0, true);
+  ASSERT_EQUAL(cached_bytes < buffers.size() * 4096, true);
+
+  thrust::omp::trim_temporary_cache();
+}
+DECLARE_UNITTEST(TestOmpTemporaryCacheIsBounded);
+
+void TestOmpTemporaryCacheIsSharedWithCpp()
+{
+  thrust::cpp::trim_temporary_cache();
+
+  const std::size_t hits = thrust::cpp::get_temporary_cache_statistics().hits;
+
+  thrust::omp::temporary_cache_allocator<int> omp_alloc;
+  thrust::cpp::temporary_cache_allocator<int> cpp_alloc;
+
+  omp_alloc.deallocate(omp_alloc.allocate(4096), 4096);
+  cpp_alloc.deallocate(cpp_alloc.allocate(4096), 4096);
+
+  ASSERT_EQUAL(thrust::cpp::get_temporary_cache_statistics().hits, hits + 1);
+
+  thrust::cpp::trim_temporary_cache();
+}
+DECLARE_UNITTEST(TestOmpTemporaryCacheIsSharedWithCpp);
+
+void TestOmpTemporaryCacheIsOptIn()
+{
+  thrust::omp::trim_temporary_cache();
+
+  const thrust::omp::temporary_cache_statistics before = thrust::omp::get_temporary_cache_statistics();
+
+  thrust::omp::vector<int> v(1 << 16);
+  thrust::sequence(v.begin(), v.end(), static_cast<int>(v.size()), -1);
+  thrust::stable_sort(thrust::omp::par, v.begin(), v.end());
+
+  // a policy without the allocator does not touch the cache
+  const thrust::omp::temporary_cache_statistics after = thrust::omp::get_temporary_cache_statistics();
+  ASSERT_EQUAL(after.hits, before.hits);
+  ASSERT_EQUAL(after.misses, before.misses);
+  ASSERT_EQUAL(after.cached_bytes, 0u);
+}
+DECLARE_UNITTEST(TestOmpTemporaryCacheIsOptIn);
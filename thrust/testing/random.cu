@@ -1,5 +1,6 @@
 #include <thrust/generate.h>
 #include <thrust/random.h>
+#include <thrust/random/generate_random.h>
 
 #include <sstream>
 
@@ -139,6 +140,40 @@ struct ValidateEngineUnequal
   }
 };
 
+template <typename Engine>
+struct ValidateEngineDiscard
+{
+  _CCCL_HOST_DEVICE ValidateEngineDiscard(unsigned long long z)
+      : m_z(z)
+  {}
+
+  _CCCL_HOST_DEVICE bool operator()(void) const
+  {
+    Engine e0, e1;
+
+    // start away from the seeded state
+    e0.discard(7);
+    for (int i = 0; i < 7; ++i)
+    {
+      e1();
+    }
+
+    // discarding must be equivalent to producing the same number of values
+    for (unsigned long long i = 0; i < m_z; ++i)
+    {
+      e0();
+    }
+    e1.discard(m_z);
+
+    bool result = (e0 == e1);
+    result &= (e0() == e1());
+
+    return result;
+  }
+
+  const unsigned long long m_z;
+}; // end ValidateEngineDiscard
+
 template <typename Distribution, typename Engine>
 struct ValidateDistributionMin
 {
@@ -289,6 +324,28 @@ void TestEngineSaveRestore()
   ASSERT_EQUAL(e0(), e1());
 }
 
+template <typename Engine>
+void TestEngineDiscard()
+{
+  // the larger distances take the jump-ahead paths of the engines which have one
+  const unsigned long long distances[] = {0, 1, 2, 3, 5, 23, 1000, 100000};
+
+  for (unsigned long long z : distances)
+  {
+    // test host
+    thrust::host_vector<bool> h(1);
+    thrust::generate(h.begin(), h.end(), ValidateEngineDiscard<Engine>(z));
+
+    ASSERT_EQUAL(true, h[0]);
+
+    // test device
+    thrust::device_vector<bool> d(1);
+    thrust::generate(d.begin(), d.end(), ValidateEngineDiscard<Engine>(z));
+
+    ASSERT_EQUAL(true, d[0]);
+  }
+}
+
 template <typename Engine>
 void TestEngineEqual()
 {
@@ -357,6 +414,14 @@ void TestRanlux24BaseSaveRestore()
 }
 DECLARE_UNITTEST(TestRanlux24BaseSaveRestore);
 
+void TestRanlux24BaseDiscard()
+{
+  using Engine = thrust::random::ranlux24_base;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestRanlux24BaseDiscard);
+
 void TestRanlux24BaseEqual()
 {
   using Engine = thrust::random::ranlux24_base;
@@ -405,6 +470,14 @@ void TestRanlux48BaseSaveRestore()
 }
 DECLARE_UNITTEST(TestRanlux48BaseSaveRestore);
 
+void TestRanlux48BaseDiscard()
+{
+  using Engine = thrust::random::ranlux48_base;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestRanlux48BaseDiscard);
+
 void TestRanlux48BaseEqual()
 {
   using Engine = thrust::random::ranlux48_base;
@@ -462,6 +535,14 @@ void TestMinstdRandSaveRestore()
 }
 DECLARE_UNITTEST(TestMinstdRandSaveRestore);
 
+void TestMinstdRandDiscard()
+{
+  using Engine = thrust::random::minstd_rand;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestMinstdRandDiscard);
+
 void TestMinstdRandEqual()
 {
   using Engine = thrust::random::minstd_rand;
@@ -510,6 +591,14 @@ void TestMinstdRand0SaveRestore()
 }
 DECLARE_UNITTEST(TestMinstdRand0SaveRestore);
 
+void TestMinstdRand0Discard()
+{
+  using Engine = thrust::random::minstd_rand0;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestMinstdRand0Discard);
+
 void TestMinstdRand0Equal()
 {
   using Engine = thrust::random::minstd_rand0;
@@ -558,6 +647,14 @@ void TestTaus88SaveRestore()
 }
 DECLARE_UNITTEST(TestTaus88SaveRestore);
 
+void TestTaus88Discard()
+{
+  using Engine = thrust::random::taus88;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestTaus88Discard);
+
 void TestTaus88Equal()
 {
   using Engine = thrust::random::taus88;
@@ -606,6 +703,14 @@ void TestRanlux24SaveRestore()
 }
 DECLARE_UNITTEST(TestRanlux24SaveRestore);
 
+void TestRanlux24Discard()
+{
+  using Engine = thrust::random::ranlux24;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestRanlux24Discard);
+
 void TestRanlux24Equal()
 {
   using Engine = thrust::random::ranlux24;
@@ -654,6 +759,14 @@ void TestRanlux48SaveRestore()
 }
 DECLARE_UNITTEST(TestRanlux48SaveRestore);
 
+void TestRanlux48Discard()
+{
+  using Engine = thrust::random::ranlux48;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestRanlux48Discard);
+
 void TestRanlux48Equal()
 {
   using Engine = thrust::random::ranlux48;
@@ -670,6 +783,415 @@ void TestRanlux48Unequal()
 }
 DECLARE_UNITTEST(TestRanlux48Unequal);
 
+void TestPhilox4x32Validation()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineValidation<Engine, 1955073260u>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Validation);
+
+void TestPhilox4x32Min()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Min);
+
+void TestPhilox4x32Max()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Max);
+
+void TestPhilox4x32SaveRestore()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32SaveRestore);
+
+void TestPhilox4x32Discard()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Discard);
+
+void TestPhilox4x32Equal()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Equal);
+
+void TestPhilox4x32Unequal()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Unequal);
+
+void TestPhilox4x64Validation()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineValidation<Engine, 3409172418970261260ull>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Validation);
+
+void TestPhilox4x64Min()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Min);
+
+void TestPhilox4x64Max()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Max);
+
+void TestPhilox4x64SaveRestore()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64SaveRestore);
+
+void TestPhilox4x64Discard()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Discard);
+
+void TestPhilox4x64Equal()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Equal);
+
+void TestPhilox4x64Unequal()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Unequal);
+
+void TestThreefry2x32Validation()
+{
+  using Engine = thrust::random::threefry2x32;
+
+  TestEngineValidation<Engine, 1363243192u>();
+}
+DECLARE_UNITTEST(TestThreefry2x32Validation);
+
+void TestThreefry2x32Min()
+{
+  using Engine = thrust::random::threefry2x32;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry2x32Min);
+
+void TestThreefry2x32Max()
+{
+  using Engine = thrust::random::threefry2x32;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry2x32Max);
+
+void TestThreefry2x32SaveRestore()
+{
+  using Engine = thrust::random::threefry2x32;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry2x32SaveRestore);
+
+void TestThreefry2x32Discard()
+{
+  using Engine = thrust::random::threefry2x32;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry2x32Discard);
+
+void TestThreefry2x32Equal()
+{
+  using Engine = thrust::random::threefry2x32;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry2x32Equal);
+
+void TestThreefry2x32Unequal()
+{
+  using Engine = thrust::random::threefry2x32;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry2x32Unequal);
+
+void TestThreefry4x32Validation()
+{
+  using Engine = thrust::random::threefry4x32;
+
+  TestEngineValidation<Engine, 112810865u>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Validation);
+
+void TestThreefry4x32Min()
+{
+  using Engine = thrust::random::threefry4x32;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Min);
+
+void TestThreefry4x32Max()
+{
+  using Engine = thrust::random::threefry4x32;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Max);
+
+void TestThreefry4x32SaveRestore()
+{
+  using Engine = thrust::random::threefry4x32;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32SaveRestore);
+
+void TestThreefry4x32Discard()
+{
+  using Engine = thrust::random::threefry4x32;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Discard);
+
+void TestThreefry4x32Equal()
+{
+  using Engine = thrust::random::threefry4x32;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Equal);
+
+void TestThreefry4x32Unequal()
+{
+  using Engine = thrust::random::threefry4x32;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Unequal);
+
+void TestThreefry2x64Validation()
+{
+  using Engine = thrust::random::threefry2x64;
+
+  TestEngineValidation<Engine, 10067442004315573443ull>();
+}
+DECLARE_UNITTEST(TestThreefry2x64Validation);
+
+void TestThreefry2x64Min()
+{
+  using Engine = thrust::random::threefry2x64;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry2x64Min);
+
+void TestThreefry2x64Max()
+{
+  using Engine = thrust::random::threefry2x64;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry2x64Max);
+
+void TestThreefry2x64SaveRestore()
+{
+  using Engine = thrust::random::threefry2x64;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry2x64SaveRestore);
+
+void TestThreefry2x64Discard()
+{
+  using Engine = thrust::random::threefry2x64;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry2x64Discard);
+
+void TestThreefry2x64Equal()
+{
+  using Engine = thrust::random::threefry2x64;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry2x64Equal);
+
+void TestThreefry2x64Unequal()
+{
+  using Engine = thrust::random::threefry2x64;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry2x64Unequal);
+
+void TestThreefry4x64Validation()
+{
+  using Engine = thrust::random::threefry4x64;
+
+  TestEngineValidation<Engine, 9253438642465275567ull>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Validation);
+
+void TestThreefry4x64Min()
+{
+  using Engine = thrust::random::threefry4x64;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Min);
+
+void TestThreefry4x64Max()
+{
+  using Engine = thrust::random::threefry4x64;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Max);
+
+void TestThreefry4x64SaveRestore()
+{
+  using Engine = thrust::random::threefry4x64;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64SaveRestore);
+
+void TestThreefry4x64Discard()
+{
+  using Engine = thrust::random::threefry4x64;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Discard);
+
+void TestThreefry4x64Equal()
+{
+  using Engine = thrust::random::threefry4x64;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Equal);
+
+void TestThreefry4x64Unequal()
+{
+  using Engine = thrust::random::threefry4x64;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Unequal);
+
+template <typename Engine>
+void TestEngineKnownAnswer(const typename Engine::result_type (&expected)[Engine::word_count])
+{
+  // with a zero key and a zero counter, as in the known answer tests of Random123
+  Engine e(0);
+
+  for (size_t i = 0; i < Engine::word_count; ++i)
+  {
+    ASSERT_EQUAL(expected[i], e());
+  }
+}
+
+void TestPhiloxKnownAnswer()
+{
+  TestEngineKnownAnswer<thrust::random::philox4x32>({0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u});
+  TestEngineKnownAnswer<thrust::random::philox4x64>(
+    {0x16554d9eca36314cull, 0xdb20fe9d672d0fdcull, 0xd7e772cee186176bull, 0x7e68b68aec7ba23bull});
+}
+DECLARE_UNITTEST(TestPhiloxKnownAnswer);
+
+void TestThreefryKnownAnswer()
+{
+  TestEngineKnownAnswer<thrust::random::threefry2x32>({0x6b200159u, 0x99ba4efeu});
+  TestEngineKnownAnswer<thrust::random::threefry4x32>({0x9c6ca96au, 0xe17eae66u, 0xfc10ecd4u, 0x5256a7d8u});
+  TestEngineKnownAnswer<thrust::random::threefry2x64>({0xc2b6e3a8c2c69865ull, 0x6f81ed42f350084dull});
+  TestEngineKnownAnswer<thrust::random::threefry4x64>(
+    {0x09218ebde6c85537ull, 0x55941f5266d86105ull, 0x4bd25e16282434dcull, 0xee29ec846bd2e40bull});
+}
+DECLARE_UNITTEST(TestThreefryKnownAnswer);
+
+template <typename Engine>
+void TestEngineSetCounter()
+{
+  using T = typename Engine::result_type;
+
+  // the counter's most significant word comes first, and each counter yields a block of words
+  Engine e0, e1;
+  e0.set_counter({0, 0, 0, 13});
+  e1.discard(13 * Engine::word_count);
+  ASSERT_EQUAL(e0 == e1, true);
+  ASSERT_EQUAL(e0(), e1());
+
+  // counting carries into the next word
+  const T max = Engine::max;
+  Engine e2, e3;
+  e2.set_counter({0, 0, max, max});
+  e2.discard(Engine::word_count);
+  e3.set_counter({0, 1, 0, 0});
+  ASSERT_EQUAL(e2 == e3, true);
+  ASSERT_EQUAL(e2(), e3());
+
+  // the counter selects the block independently of the engine's position
+  Engine e4, e5;
+  e4.discard(1000);
+  e4.set_counter({0, 0, 0, 13});
+  e5.set_counter({0, 0, 0, 13});
+  ASSERT_EQUAL(e4 == e5, true);
+}
+
+void TestPhiloxSetCounter()
+{
+  TestEngineSetCounter<thrust::random::philox4x32>();
+  TestEngineSetCounter<thrust::random::philox4x64>();
+}
+DECLARE_UNITTEST(TestPhiloxSetCounter);
+
+void TestThreefrySetCounter()
+{
+  TestEngineSetCounter<thrust::random::threefry4x32>();
+  TestEngineSetCounter<thrust::random::threefry4x64>();
+}
+DECLARE_UNITTEST(TestThreefrySetCounter);
+
 _CCCL_DIAG_PUSH
 _CCCL_DIAG_SUPPRESS_MSVC(4305) // truncation warning
 template <typename Distribution, typename Validator>
@@ -841,3 +1363,144 @@ void TestNormalDistributionSaveRestore()
   TestDistributionSaveRestore<double_dist>();
 }
 DECLARE_UNITTEST(TestNormalDistributionSaveRestore);
+
+template <typename Distribution>
+void TestDistributionGenerateN(Distribution dist)
+{
+  using T = typename Distribution::result_type;
+
+  const size_t sizes[] = {0, 1, 2, 3, 64, 65, 1000};
+
+  for (size_t n : sizes)
+  {
+    thrust::minstd_rand e0, e1;
+    Distribution d0 = dist, d1 = dist;
+
+    // begin with the state left by an earlier call
+    d0(e0);
+    d1(e1);
+
+    thrust::host_vector<T> expected(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+      expected[i] = d0(e0);
+    }
+
+    thrust::host_vector<T> result(n);
+    ASSERT_EQUAL(true, d1.generate_n(e1, result.begin(), n) == result.end());
+
+    ASSERT_EQUAL(expected, result);
+    ASSERT_EQUAL(e0, e1);
+    ASSERT_EQUAL(d0(e0), d1(e1));
+  }
+}
+
+void TestUniformIntDistributionGenerateN()
+{
+  TestDistributionGenerateN(thrust::random::uniform_int_distribution<int>(-7, 13));
+  TestDistributionGenerateN(thrust::random::uniform_int_distribution<unsigned int>());
+}
+DECLARE_UNITTEST(TestUniformIntDistributionGenerateN);
+
+void TestUniformRealDistributionGenerateN()
+{
+  TestDistributionGenerateN(thrust::random::uniform_real_distribution<float>(-7, 13));
+  TestDistributionGenerateN(thrust::random::uniform_real_distribution<double>());
+}
+DECLARE_UNITTEST(TestUniformRealDistributionGenerateN);
+
+void TestNormalDistributionGenerateN()
+{
+  TestDistributionGenerateN(thrust::random::normal_distribution<float>(7, 13));
+  TestDistributionGenerateN(thrust::random::normal_distribution<double>());
+}
+DECLARE_UNITTEST(TestNormalDistributionGenerateN);
+
+template <typename Vector, typename Engine, typename Distribution>
+void TestGenerateRandom(Distribution dist)
+{
+  using T = typename Distribution::result_type;
+
+  // sizes spanning several tiles, with a partial tile at the end
+  const size_t sizes[] = {0, 1, 1001, (1 << 14) + 3, 3 * (1 << 14) + 1};
+
+  for (size_t n : sizes)
+  {
+    Engine e0, e1;
+    Distribution d0 = dist, d1 = dist;
+
+    d0(e0);
+    d1(e1);
+
+    d0.reset();
+    thrust::host_vector<T> expected(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+      expected[i] = d0(e0);
+    }
+    d0.reset();
+
+    Vector result(n);
+    thrust::random::generate_random(result.begin(), result.end(), e1, d1);
+
+    ASSERT_EQUAL(expected, result);
+    ASSERT_EQUAL(e0, e1);
+    ASSERT_EQUAL(d0(e0), d1(e1));
+  }
+}
+
+template <typename Vector, typename Engine>
+void TestGenerateRandomEngineValues()
+{
+  using T = typename Engine::result_type;
+
+  const size_t n = 2 * (1 << 14) + 5;
+
+  Engine e0, e1;
+
+  thrust::host_vector<T> expected(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    expected[i] = e0();
+  }
+
+  Vector result(n);
+  ASSERT_EQUAL(true, thrust::random::generate_random_n(result.begin(), n, e1) == result.end());
+
+  ASSERT_EQUAL(expected, result);
+  ASSERT_EQUAL(e0, e1);
+}
+
+void TestGenerateRandomUniformInt()
+{
+  using dist = thrust::random::uniform_int_distribution<int>;
+
+  TestGenerateRandom<thrust::host_vector<int>, thrust::minstd_rand>(dist(-7, 13));
+  TestGenerateRandom<thrust::device_vector<int>, thrust::philox4x32>(dist(-7, 13));
+}
+DECLARE_UNITTEST(TestGenerateRandomUniformInt);
+
+void TestGenerateRandomUniformReal()
+{
+  using dist = thrust::random::uniform_real_distribution<float>;
+
+  TestGenerateRandom<thrust::host_vector<float>, thrust::philox4x32>(dist(-7, 13));
+  TestGenerateRandom<thrust::device_vector<float>, thrust::minstd_rand>(dist(-7, 13));
+}
+DECLARE_UNITTEST(TestGenerateRandomUniformReal);
+
+void TestGenerateRandomNormal()
+{
+  using dist = thrust::random::normal_distribution<float>;
+
+  TestGenerateRandom<thrust::host_vector<float>, thrust::minstd_rand>(dist(7, 13));
+  TestGenerateRandom<thrust::device_vector<float>, thrust::philox4x32>(dist(7, 13));
+}
+DECLARE_UNITTEST(TestGenerateRandomNormal);
+
+void TestGenerateRandomEngine()
+{
+  TestGenerateRandomEngineValues<thrust::host_vector<unsigned int>, thrust::taus88>();
+  TestGenerateRandomEngineValues<thrust::device_vector<unsigned int>, thrust::philox4x32>();
+}
+DECLARE_UNITTEST(TestGenerateRandomEngine);
@@ -74,6 +74,21 @@ void TestSortAscendingKey(const size_t n)
 }
 DECLARE_VARIABLE_UNITTEST(TestSortAscendingKey);
 
+template <typename T>
+void TestSortPrimitiveKeyIsSorted(const size_t n)
+{
+  // sorting arithmetic keys under the default comparators may take a radix sort path, so check the result against
+  // a comparison rather than against another sort
+  thrust::device_vector<T> d_data = unittest::random_integers<T>(n);
+
+  thrust::sort(d_data.begin(), d_data.end(), thrust::less<T>());
+  ASSERT_EQUAL(true, thrust::is_sorted(d_data.begin(), d_data.end(), thrust::less<T>()));
+
+  thrust::sort(d_data.begin(), d_data.end(), thrust::greater<T>());
+  ASSERT_EQUAL(true, thrust::is_sorted(d_data.begin(), d_data.end(), thrust::greater<T>()));
+}
+DECLARE_VARIABLE_UNITTEST(TestSortPrimitiveKeyIsSorted);
+
 void TestSortDescendingKey()
 {
   const size_t n = 10027;
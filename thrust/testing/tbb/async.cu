@@ -0,0 +1,237 @@
+#include <thrust/detail/config.h>
+
+#if _CCCL_STD_VER >= 2014
+
+#  include <thrust/async/copy.h>
+#  include <thrust/async/for_each.h>
+#  include <thrust/async/reduce.h>
+#  include <thrust/async/scan.h>
+#  include <thrust/async/sort.h>
+#  include <thrust/async/transform.h>
+#  include <thrust/functional.h>
+#  include <thrust/host_vector.h>
+#  include <thrust/sequence.h>
+#  include <thrust/system/tbb/execution_policy.h>
+
+#  include <atomic>
+#  include <memory>
+#  include <vector>
+
+#  include <unittest/unittest.h>
+
+template <typename T>
+struct times_two
+{
+  _CCCL_HOST_DEVICE T operator()(T x) const
+  {
+    return x * 2;
+  }
+};
+
+template <typename T>
+struct increment
+{
+  _CCCL_HOST_DEVICE void operator()(T& x) const
+  {
+    ++x;
+  }
+};
+
+template <typename T>
+struct counting_allocator : std::allocator<T>
+{
+  template <typename U>
+  struct rebind
+  {
+    using other = counting_allocator<U>;
+  };
+
+  std::atomic<int>* allocations;
+
+  explicit counting_allocator(std::atomic<int>* a)
+      : allocations(a)
+  {}
+
+  template <typename U>
+  counting_allocator(const counting_allocator<U>& other)
+      : allocations(other.allocations)
+  {}
+
+  T* allocate(std::size_t n)
+  {
+    ++*allocations;
+    return std::allocator<T>::allocate(n);
+  }
+};
+
+template <typename T>
+void TestTbbAsyncReduce(const size_t n)
+{
+  thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+
+  auto f0 = thrust::async::reduce(thrust::tbb::par, h_data.begin(), h_data.end());
+  auto exec       = thrust::tbb::par.with_cutoffs(thrust::tbb::sort_cutoffs(16, 8));
+  auto f1         = thrust::async::reduce(exec, h_data.begin(), h_data.end(), T(1), thrust::plus<T>());
+
+  ASSERT_EQUAL(thrust::reduce(h_data.begin(), h_data.end()), f0.get());
+  ASSERT_EQUAL(thrust::reduce(h_data.begin(), h_data.end(), T(1)), f1.get());
+  ASSERT_EQUAL(true, f0.ready());
+}
+DECLARE_VARIABLE_UNITTEST(TestTbbAsyncReduce);
+
+template <typename T>
+void TestTbbAsyncReduceInto(const size_t n)
+{
+  thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+  thrust::host_vector<T> h_out(1);
+
+  auto e = thrust::async::reduce_into(thrust::tbb::par, h_data.begin(), h_data.end(), h_out.begin());
+  e.wait();
+
+  ASSERT_EQUAL(thrust::reduce(h_data.begin(), h_data.end()), h_out[0]);
+}
+DECLARE_VARIABLE_UNITTEST(TestTbbAsyncReduceInto);
+
+template <typename T>
+void TestTbbAsyncAlgorithms(const size_t n)
+{
+  thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+  thrust::host_vector<T> h_ref  = h_data;
+
+  thrust::host_vector<T> d_copy(n);
+  thrust::async::copy(thrust::tbb::par, thrust::tbb::par, h_data.begin(), h_data.end(), d_copy.begin()).wait();
+  ASSERT_EQUAL(h_ref, d_copy);
+
+  thrust::host_vector<T> d_transformed(n);
+  thrust::async::transform(thrust::tbb::par, h_data.begin(), h_data.end(), d_transformed.begin(), times_two<T>())
+    .wait();
+  thrust::host_vector<T> h_transformed(n);
+  thrust::transform(h_ref.begin(), h_ref.end(), h_transformed.begin(), times_two<T>());
+  ASSERT_EQUAL(h_transformed, d_transformed);
+
+  thrust::host_vector<T> d_scanned(n);
+  thrust::host_vector<T> h_scanned(n);
+  thrust::async::inclusive_scan(thrust::tbb::par, h_data.begin(), h_data.end(), d_scanned.begin(), thrust::plus<T>())
+    .wait();
+  thrust::inclusive_scan(h_ref.begin(), h_ref.end(), h_scanned.begin());
+  ASSERT_EQUAL(h_scanned, d_scanned);
+
+  thrust::async::exclusive_scan(
+    thrust::tbb::par, h_data.begin(), h_data.end(), d_scanned.begin(), T(3), thrust::plus<T>())
+    .wait();
+  thrust::exclusive_scan(h_ref.begin(), h_ref.end(), h_scanned.begin(), T(3));
+  ASSERT_EQUAL(h_scanned, d_scanned);
+
+  thrust::async::for_each(thrust::tbb::par, h_data.begin(), h_data.end(), increment<T>()).wait();
+  thrust::for_each(h_ref.begin(), h_ref.end(), increment<T>());
+  ASSERT_EQUAL(h_ref, h_data);
+
+  thrust::async::sort(thrust::tbb::par, h_data.begin(), h_data.end()).wait();
+  thrust::sort(h_ref.begin(), h_ref.end());
+  ASSERT_EQUAL(h_ref, h_data);
+
+  thrust::async::stable_sort(thrust::tbb::par, h_data.begin(), h_data.end(), thrust::greater<T>()).wait();
+  thrust::stable_sort(h_ref.begin(), h_ref.end(), thrust::greater<T>());
+  ASSERT_EQUAL(h_ref, h_data);
+}
+DECLARE_VARIABLE_UNITTEST(TestTbbAsyncAlgorithms);
+
+void TestTbbAsyncKeepsAllocator()
+{
+  const size_t n = 10000;
+
+  thrust::host_vector<int> h_data = unittest::random_integers<int>(n);
+  thrust::host_vector<int> h_ref  = h_data;
+  thrust::stable_sort(h_ref.begin(), h_ref.end(), thrust::greater<int>());
+
+  // the temporary buffers of the operation come from a copy of the allocator
+  std::atomic<int> allocations(0);
+  {
+    counting_allocator<int> alloc(&allocations);
+    auto e = thrust::async::stable_sort(thrust::tbb::par(alloc), h_data.begin(), h_data.end(), thrust::greater<int>());
+    e.wait();
+  }
+  ASSERT_EQUAL(h_ref, h_data);
+  ASSERT_EQUAL(true, allocations.load() > 0);
+}
+DECLARE_UNITTEST(TestTbbAsyncKeepsAllocator);
+
+void TestTbbAsyncManyOperations()
+{
+  const int count = 64;
+  thrust::host_vector<int> h_data(1000, 1);
+
+  // more operations than the system runs at once
+  std::vector<thrust::tbb::future<int>> futures;
+  for (int i = 0; i < count; ++i)
+  {
+    futures.push_back(thrust::async::reduce(thrust::tbb::par, h_data.begin(), h_data.end(), i));
+  }
+
+  for (int i = 0; i < count; ++i)
+  {
+    ASSERT_EQUAL(1000 + i, futures[i].get());
+  }
+}
+DECLARE_UNITTEST(TestTbbAsyncManyOperations);
+
+void TestTbbAsyncAfter()
+{
+  const size_t n = 1 << 12;
+  thrust::host_vector<int> h_data(n);
+  thrust::host_vector<int> h_sums(n);
+
+  // each operation only starts once the one before has completed
+  auto e0 = thrust::async::transform(
+    thrust::tbb::par,
+    thrust::make_counting_iterator<int>(0),
+    thrust::make_counting_iterator<int>(n),
+    h_data.begin(),
+    times_two<int>());
+  auto e1 = thrust::async::inclusive_scan(
+    thrust::tbb::par.after(e0), h_data.begin(), h_data.end(), h_sums.begin(), thrust::plus<int>());
+  auto f2 = thrust::async::reduce(thrust::tbb::par.after(e1), h_sums.begin(), h_sums.end(), 0, thrust::maximum<int>());
+
+  ASSERT_EQUAL(false, e0.valid_state());
+  ASSERT_EQUAL(false, e1.valid_state());
+
+  // the largest prefix sum is n * (n - 1)
+  ASSERT_EQUAL(static_cast<int>(n * (n - 1)), f2.get());
+}
+DECLARE_UNITTEST(TestTbbAsyncAfter);
+
+void TestTbbAsyncWhenAll()
+{
+  thrust::host_vector<int> a(1000);
+  thrust::host_vector<int> b(1000);
+
+  auto e0 = thrust::async::for_each(thrust::tbb::par, a.begin(), a.end(), increment<int>());
+  auto e1 = thrust::async::for_each(thrust::tbb::par, b.begin(), b.end(), increment<int>());
+  auto f  = thrust::async::reduce(thrust::tbb::par.after(thrust::tbb::when_all(e0, e1)), a.begin(), a.end());
+
+  ASSERT_EQUAL(1000, f.get());
+  ASSERT_EQUAL(1000, thrust::reduce(b.begin(), b.end()));
+}
+DECLARE_UNITTEST(TestTbbAsyncWhenAll);
+
+void TestTbbAsyncException()
+{
+  thrust::host_vector<int> h_data(10, 1);
+
+  // waiting for an event without state throws in the task, and fails it
+  auto f0 = thrust::async::reduce(thrust::tbb::par.after(thrust::tbb::event{}), h_data.begin(), h_data.end());
+  ASSERT_THROWS(f0.get(), thrust::event_error);
+
+  // dependents of a failed operation fail as well
+  auto e1 = thrust::async::for_each(
+    thrust::tbb::par.after(thrust::tbb::event{}), h_data.begin(), h_data.end(), increment<int>());
+  auto f2 = thrust::async::reduce(thrust::tbb::par.after(e1), h_data.begin(), h_data.end());
+  ASSERT_THROWS(f2.get(), thrust::event_error);
+  ASSERT_EQUAL(10, thrust::reduce(h_data.begin(), h_data.end()));
+
+  thrust::tbb::event e;
+  ASSERT_THROWS(e.wait(), thrust::event_error);
+}
+DECLARE_UNITTEST(TestTbbAsyncException);
+
+#endif // C++14
@@ -0,0 +1,125 @@
+#include <thrust/functional.h>
+#include <thrust/merge.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/system/tbb/execution_policy.h>
+
+#include <unittest/unittest.h>
+
+template <typename T>
+struct less_than_by_tens
+{
+  _CCCL_HOST_DEVICE bool operator()(const T& lhs, const T& rhs) const
+  {
+    return lhs / 10 < rhs / 10;
+  }
+};
+
+void TestTbbSortCutoffsDefault()
+{
+  thrust::tbb::sort_cutoffs cutoffs;
+
+  ASSERT_EQUAL(0u, cutoffs.leaf_size);
+  ASSERT_EQUAL(0u, cutoffs.merge_grain_size);
+
+  // derived cutoffs are never zero
+  ASSERT_EQUAL(true, thrust::system::tbb::detail::merge_sort_leaf_size(cutoffs, 0, 128) > 0);
+  ASSERT_EQUAL(true, thrust::system::tbb::detail::merge_grain_size(cutoffs, 0, 128) > 0);
+
+  // explicit cutoffs are used as given
+  ASSERT_EQUAL(7u, thrust::system::tbb::detail::merge_sort_leaf_size(thrust::tbb::sort_cutoffs(7, 3), 1 << 20, 4));
+  ASSERT_EQUAL(3u, thrust::system::tbb::detail::merge_grain_size(thrust::tbb::sort_cutoffs(7, 3), 1 << 20, 4));
+}
+DECLARE_UNITTEST(TestTbbSortCutoffsDefault);
+
+template <typename T>
+void TestTbbStableSortWithCutoffs(const size_t n)
+{
+  // a non-default comparator keeps the merge sort path
+  thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+  thrust::host_vector<T> d_data = h_data;
+
+  thrust::stable_sort(h_data.begin(), h_data.end(), less_than_by_tens<T>());
+  thrust::stable_sort(thrust::tbb::par.with_cutoffs(thrust::tbb::sort_cutoffs(16, 8)),
+                      d_data.begin(),
+                      d_data.end(),
+                      less_than_by_tens<T>());
+
+  ASSERT_EQUAL(h_data, d_data);
+}
+DECLARE_VARIABLE_UNITTEST(TestTbbStableSortWithCutoffs);
+
+template <typename T>
+void TestTbbStableSortByKeyWithCutoffs(const size_t n)
+{
+  thrust::host_vector<T> h_keys = unittest::random_integers<T>(n);
+  thrust::host_vector<T> d_keys = h_keys;
+
+  thrust::host_vector<int> h_values(n);
+  thrust::sequence(h_values.begin(), h_values.end());
+  thrust::host_vector<int> d_values = h_values;
+
+  thrust::stable_sort_by_key(h_keys.begin(), h_keys.end(), h_values.begin(), less_than_by_tens<T>());
+  thrust::stable_sort_by_key(
+    thrust::tbb::par.with_cutoffs(thrust::tbb::sort_cutoffs(16, 8)),
+    d_keys.begin(),
+    d_keys.end(),
+    d_values.begin(),
+    less_than_by_tens<T>());
+
+  ASSERT_EQUAL(h_keys, d_keys);
+  ASSERT_EQUAL(h_values, d_values);
+}
+DECLARE_VARIABLE_UNITTEST(TestTbbStableSortByKeyWithCutoffs);
+
+void TestTbbMergeWithCutoffs()
+{
+  const size_t n = 10027;
+
+  thrust::host_vector<int> a = unittest::random_integers<int>(n);
+  thrust::host_vector<int> b = unittest::random_integers<int>(n);
+  thrust::sort(a.begin(), a.end());
+  thrust::sort(b.begin(), b.end());
+
+  thrust::host_vector<int> h_result(2 * n);
+  thrust::host_vector<int> d_result(2 * n);
+
+  thrust::merge(a.begin(), a.end(), b.begin(), b.end(), h_result.begin());
+  thrust::merge(thrust::tbb::par.with_cutoffs(thrust::tbb::sort_cutoffs(0, 8)),
+                a.begin(),
+                a.end(),
+                b.begin(),
+                b.end(),
+                d_result.begin());
+
+  ASSERT_EQUAL(h_result, d_result);
+}
+DECLARE_UNITTEST(TestTbbMergeWithCutoffs);
+
+void TestTbbSortCutoffsWithAllocator()
+{
+  const size_t n = 10027;
+
+  thrust::host_vector<int> h_data = unittest::random_integers<int>(n);
+  thrust::host_vector<int> d_data = h_data;
+
+  thrust::stable_sort(h_data.begin(), h_data.end(), less_than_by_tens<int>());
+
+  // the allocator can be attached before or after the cutoffs, and keeps them either way
+  std::allocator<int> alloc;
+  auto cutoffs_first = thrust::tbb::par.with_cutoffs(thrust::tbb::sort_cutoffs(16, 8))(alloc);
+  auto alloc_first   = thrust::tbb::par(alloc).with_cutoffs(thrust::tbb::sort_cutoffs(16, 8));
+
+  ASSERT_EQUAL(16u, get_sort_cutoffs(cutoffs_first).leaf_size);
+  ASSERT_EQUAL(8u, get_sort_cutoffs(cutoffs_first).merge_grain_size);
+  ASSERT_EQUAL(16u, get_sort_cutoffs(alloc_first).leaf_size);
+  ASSERT_EQUAL(8u, get_sort_cutoffs(alloc_first).merge_grain_size);
+
+  thrust::stable_sort(cutoffs_first, d_data.begin(), d_data.end(), less_than_by_tens<int>());
+  ASSERT_EQUAL(h_data, d_data);
+
+  d_data = unittest::random_integers<int>(n);
+  thrust::stable_sort(alloc_first, d_data.begin(), d_data.end(), less_than_by_tens<int>());
+  ASSERT_EQUAL(h_data, d_data);
+}
+DECLARE_UNITTEST(TestTbbSortCutoffsWithAllocator);
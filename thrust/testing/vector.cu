@@ -2,6 +2,7 @@
 
 #include <thrust/device_malloc_allocator.h>
 #include <thrust/sequence.h>
+#include <thrust/universal_vector.h>
 
 #include <initializer_list>
 #include <limits>
@@ -641,6 +642,98 @@ void TestVectorResizing()
 }
 DECLARE_VECTOR_UNITTEST(TestVectorResizing);
 
+template <class Vector, class InitTag>
+void TestVectorTaggedInit(InitTag init)
+{
+  using T = typename Vector::value_type;
+
+  Vector v(5, init);
+  ASSERT_EQUAL(v.size(), 5lu);
+
+  thrust::sequence(v.begin(), v.end());
+
+  v.resize(8, init);
+  ASSERT_EQUAL(v.size(), 8lu);
+
+  // the appended elements are indeterminate, so only the old ones are compared
+  for (int i = 0; i < 5; ++i)
+  {
+    ASSERT_EQUAL(v[i], T(i));
+  }
+
+  v.resize(3, init);
+  ASSERT_EQUAL(v.size(), 3lu);
+
+  Vector ref{0, 1, 2};
+  ASSERT_EQUAL(v, ref);
+
+  // growing beyond the capacity keeps the elements
+  v.resize(1000, init);
+  ASSERT_EQUAL(v.size(), 1000lu);
+  ASSERT_EQUAL(v[2], T(2));
+
+  Vector w(7, init, v.get_allocator());
+  ASSERT_EQUAL(w.size(), 7lu);
+
+  Vector empty(0, init);
+  ASSERT_EQUAL(empty.size(), 0lu);
+}
+
+template <class Vector>
+void TestVectorDefaultInit()
+{
+  TestVectorTaggedInit<Vector>(thrust::default_init);
+}
+DECLARE_VECTOR_UNITTEST(TestVectorDefaultInit);
+
+void TestVectorNoInit()
+{
+  // no_init only accepts trivially default-constructible types
+  TestVectorTaggedInit<thrust::host_vector<short>>(thrust::no_init);
+  TestVectorTaggedInit<thrust::host_vector<float>>(thrust::no_init);
+  TestVectorTaggedInit<thrust::device_vector<short>>(thrust::no_init);
+  TestVectorTaggedInit<thrust::device_vector<float>>(thrust::no_init);
+  TestVectorTaggedInit<thrust::universal_vector<int>>(thrust::no_init);
+  TestVectorTaggedInit<
+    thrust::host_vector<int, thrust::mr::stateless_resource_allocator<int, thrust::host_memory_resource>>>(
+    thrust::no_init);
+}
+DECLARE_UNITTEST(TestVectorNoInit);
+
+struct DefaultInitCounter
+{
+  int value;
+
+  _CCCL_HOST_DEVICE DefaultInitCounter()
+      : value(42)
+  {}
+
+  _CCCL_HOST_DEVICE bool operator==(const DefaultInitCounter& other) const
+  {
+    return value == other.value;
+  }
+};
+
+void TestVectorDefaultInitNonTrivial()
+{
+  // default-initialization still runs nontrivial constructors
+  thrust::host_vector<DefaultInitCounter> h(10, thrust::default_init);
+  thrust::device_vector<DefaultInitCounter> d(10, thrust::default_init);
+  thrust::universal_vector<DefaultInitCounter> u(10, thrust::default_init);
+
+  thrust::host_vector<DefaultInitCounter> ref(10);
+  ASSERT_EQUAL_QUIET(h, ref);
+  ASSERT_EQUAL_QUIET(d, ref);
+  ASSERT_EQUAL_QUIET(u, ref);
+
+  h.resize(20, thrust::default_init);
+  d.resize(20, thrust::default_init);
+  ref.resize(20);
+  ASSERT_EQUAL_QUIET(h, ref);
+  ASSERT_EQUAL_QUIET(d, ref);
+}
+DECLARE_UNITTEST(TestVectorDefaultInitNonTrivial);
+
 template <class Vector>
 void TestVectorReserving()
 {
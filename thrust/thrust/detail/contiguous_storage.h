@@ -104,6 +104,8 @@ public:
 
   _CCCL_HOST_DEVICE void value_initialize_n(iterator first, size_type n);
 
+  _CCCL_HOST_DEVICE void default_initialize_n(iterator first, size_type n);
+
   _CCCL_HOST_DEVICE void uninitialized_fill_n(iterator first, size_type n, const value_type& value);
 
   template <typename InputIterator>
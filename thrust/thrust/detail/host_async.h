@@ -0,0 +1,497 @@
+/*
+ *  Copyright 2025 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief Events and futures of the asynchronous algorithms of the host
+ *         systems.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cpp14_required.h>
+
+#if _CCCL_STD_VER >= 2014
+
+#  include <thrust/detail/event_error.h>
+#  include <thrust/detail/static_assert.h>
+#  include <thrust/detail/tuple_algorithms.h>
+#  include <thrust/optional.h>
+#  include <thrust/type_traits/remove_cvref.h>
+
+#  include <atomic>
+#  include <condition_variable>
+#  include <cstddef>
+#  include <exception>
+#  include <functional>
+#  include <memory>
+#  include <mutex>
+#  include <tuple>
+#  include <type_traits>
+#  include <utility>
+#  include <vector>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace detail
+{
+
+// An asynchronous operation of a host system runs as a `Task`, which has to
+// provide `run(f)`, starting `f` in the background, and `join()`, blocking
+// until a started `f` has returned. Its dependencies on the same system delay
+// the start of the task instead of blocking a worker thread, the others are
+// waited for by the task before it runs the operation.
+
+template <typename Task>
+class host_unique_eager_event;
+
+template <typename T, typename Task>
+class host_unique_eager_future;
+
+struct host_async_operation
+{
+  virtual ~host_async_operation() = default;
+
+  virtual void run() = 0;
+};
+
+struct host_async_wait_fn
+{
+  template <typename Dependency>
+  void operator()(Dependency& dependency) const
+  {
+    // Also rethrows the exception a failed dependency exited with.
+    dependency.wait();
+  }
+};
+
+template <typename Dependencies, typename F>
+struct host_async_operation_impl final : host_async_operation
+{
+  Dependencies dependencies;
+  F f;
+
+  host_async_operation_impl(Dependencies&& deps, F&& f_)
+      : dependencies(std::move(deps))
+      , f(std::move(f_))
+  {}
+
+  void run() override
+  {
+    tuple_for_each(dependencies, host_async_wait_fn{});
+    f();
+  }
+};
+
+template <typename Task>
+class host_async_signal
+{
+  mutable std::mutex mutex_;
+  std::condition_variable completed_;
+  bool done_ = false;
+  std::exception_ptr error_;
+  std::vector<std::function<void()>> continuations_;
+
+  // The number of dependencies on the same system which are still running,
+  // plus one until the launch has registered with all of them.
+  std::atomic<std::size_t> pending_{1};
+  std::unique_ptr<host_async_operation> operation_;
+  Task task_;
+
+  struct register_fn
+  {
+    host_async_signal* self;
+
+    void operator()(host_unique_eager_event<Task>& dependency) const
+    {
+      self->depend_on(dependency);
+    }
+
+    template <typename X>
+    void operator()(host_unique_eager_future<X, Task>& dependency) const
+    {
+      self->depend_on(dependency);
+    }
+
+    // Dependencies on other systems are waited for by the task.
+    template <typename Dependency>
+    void operator()(Dependency&) const
+    {}
+  };
+
+  template <typename Dependency>
+  void depend_on(Dependency& dependency)
+  {
+    // A dependency without state is left to the task, whose wait reports the
+    // error.
+    if (dependency.valid_state())
+    {
+      ++pending_;
+      dependency.signal_->then([this] {
+        release();
+      });
+    }
+  }
+
+  void release()
+  {
+    if (--pending_ == 0)
+    {
+      try
+      {
+        task_.run([this] {
+          execute();
+        });
+      }
+      catch (...)
+      {
+        operation_.reset();
+        complete(std::current_exception());
+      }
+    }
+  }
+
+  void execute()
+  {
+    std::exception_ptr error;
+    try
+    {
+      operation_->run();
+    }
+    catch (...)
+    {
+      error = std::current_exception();
+    }
+
+    // Drop the dependencies before signalling completion, so that they are
+    // gone when a waiter wakes up.
+    operation_.reset();
+    complete(error);
+  }
+
+  void complete(std::exception_ptr error)
+  {
+    std::vector<std::function<void()>> continuations;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      done_  = true;
+      error_ = error;
+      continuations.swap(continuations_);
+    }
+    completed_.notify_all();
+
+    for (auto& continuation : continuations)
+    {
+      continuation();
+    }
+  }
+
+protected:
+  // Blocks until the operation has completed and its task has returned.
+  void finish()
+  {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      completed_.wait(lock, [this] {
+        return done_;
+      });
+    }
+    task_.join();
+  }
+
+public:
+  host_async_signal() = default;
+
+  host_async_signal(host_async_signal const&)            = delete;
+  host_async_signal& operator=(host_async_signal const&) = delete;
+
+  virtual ~host_async_signal()
+  {
+    finish();
+  }
+
+  // Runs `f` after all of `dependencies` have completed. May only be called
+  // once.
+  template <typename... Dependencies, typename F>
+  void launch(std::tuple<Dependencies...>&& dependencies, F&& f)
+  {
+    using operation_type = host_async_operation_impl<std::tuple<Dependencies...>, remove_cvref_t<F>>;
+
+    std::unique_ptr<operation_type> operation(
+      new operation_type(std::move(dependencies), remove_cvref_t<F>(THRUST_FWD(f))));
+    auto& deps = operation->dependencies;
+    operation_ = std::move(operation);
+
+    tuple_for_each(deps, register_fn{this});
+    release();
+  }
+
+  bool ready() const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return done_;
+  }
+
+  // Blocks, and rethrows the exception the operation exited with, if any.
+  void wait()
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    completed_.wait(lock, [this] {
+      return done_;
+    });
+
+    if (error_)
+    {
+      std::rethrow_exception(error_);
+    }
+  }
+
+  // Invokes `f` once the operation has completed, right away if it already
+  // has.
+  void then(std::function<void()> f)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!done_)
+      {
+        continuations_.push_back(std::move(f));
+        return;
+      }
+    }
+    f();
+  }
+};
+
+template <typename T, typename Task>
+class host_async_value final : public host_async_signal<Task>
+{
+  thrust::optional<T> value_;
+
+public:
+  ~host_async_value() override
+  {
+    // The task may still write the value, which is destroyed before the base.
+    this->finish();
+  }
+
+  template <typename... Dependencies, typename F>
+  void launch(std::tuple<Dependencies...>&& dependencies, F&& f)
+  {
+    host_async_signal<Task>::launch(std::move(dependencies), [this, f = remove_cvref_t<F>(THRUST_FWD(f))]() mutable {
+      value_.emplace(f());
+    });
+  }
+
+  T& get()
+  {
+    this->wait();
+    return *value_;
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename Task>
+class host_unique_eager_event final
+{
+  std::unique_ptr<host_async_signal<Task>> signal_;
+
+  friend class host_async_signal<Task>;
+
+public:
+  host_unique_eager_event() = default;
+
+  _CCCL_HOST explicit host_unique_eager_event(std::unique_ptr<host_async_signal<Task>> signal)
+      : signal_(std::move(signal))
+  {}
+
+  // Any `host_unique_eager_future<T, Task>` can be explicitly converted to an
+  // event.
+  template <typename U>
+  _CCCL_HOST explicit host_unique_eager_event(host_unique_eager_future<U, Task>&& other)
+      : signal_(std::move(other.signal_))
+  {}
+
+  host_unique_eager_event(host_unique_eager_event&&)                 = default;
+  host_unique_eager_event(host_unique_eager_event const&)            = delete;
+  host_unique_eager_event& operator=(host_unique_eager_event&&)      = default;
+  host_unique_eager_event& operator=(host_unique_eager_event const&) = delete;
+
+  // Blocks until the operation has completed.
+  ~host_unique_eager_event() = default;
+
+  _CCCL_HOST bool valid_state() const noexcept
+  {
+    return bool(signal_);
+  }
+
+  _CCCL_HOST bool ready() const noexcept
+  {
+    return valid_state() && signal_->ready();
+  }
+
+  // Blocks, and rethrows the exception the operation exited with, if any.
+  // Precondition: `true == valid_state()`.
+  _CCCL_HOST void wait()
+  {
+    if (!valid_state())
+    {
+      throw thrust::event_error(event_errc::no_state);
+    }
+
+    signal_->wait();
+  }
+};
+
+template <typename T, typename Task>
+class host_unique_eager_future final
+{
+  THRUST_STATIC_ASSERT_MSG((!std::is_same<T, remove_cvref_t<void>>::value),
+                           "`thrust::event` should be used to express valueless futures");
+
+  std::unique_ptr<host_async_value<T, Task>> signal_;
+
+  friend class host_async_signal<Task>;
+  friend class host_unique_eager_event<Task>;
+
+public:
+  using value_type = T;
+
+  host_unique_eager_future() = default;
+
+  _CCCL_HOST explicit host_unique_eager_future(std::unique_ptr<host_async_value<T, Task>> signal)
+      : signal_(std::move(signal))
+  {}
+
+  host_unique_eager_future(host_unique_eager_future&&)                 = default;
+  host_unique_eager_future(host_unique_eager_future const&)            = delete;
+  host_unique_eager_future& operator=(host_unique_eager_future&&)      = default;
+  host_unique_eager_future& operator=(host_unique_eager_future const&) = delete;
+
+  // Blocks until the operation has completed.
+  ~host_unique_eager_future() = default;
+
+  _CCCL_HOST bool valid_state() const noexcept
+  {
+    return bool(signal_);
+  }
+
+  // A host future always computes its content.
+  _CCCL_HOST bool valid_content() const noexcept
+  {
+    return valid_state();
+  }
+
+  _CCCL_HOST bool ready() const noexcept
+  {
+    return valid_state() && signal_->ready();
+  }
+
+  // Blocks, and rethrows the exception the operation exited with, if any.
+  // Precondition: `true == valid_state()`.
+  _CCCL_HOST void wait()
+  {
+    if (!valid_state())
+    {
+      throw thrust::event_error(event_errc::no_state);
+    }
+
+    signal_->wait();
+  }
+
+  // Blocks.
+  // Precondition: `true == valid_content()`.
+  _CCCL_HOST value_type get()
+  {
+    if (!valid_content())
+    {
+      throw thrust::event_error(event_errc::no_content);
+    }
+
+    return signal_->get();
+  }
+
+  // Blocks.
+  // Precondition: `true == valid_content()`.
+  _CCCL_NODISCARD _CCCL_HOST value_type extract()
+  {
+    if (!valid_content())
+    {
+      throw thrust::event_error(event_errc::no_content);
+    }
+
+    value_type tmp(std::move(signal_->get()));
+    signal_.reset();
+    return tmp;
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Runs `f()` as a `Task` once `deps` have completed, which are kept alive
+// until then.
+template <typename Task, typename... Dependencies, typename F>
+_CCCL_HOST host_unique_eager_event<Task> make_host_dependent_event(std::tuple<Dependencies...>&& deps, F&& f)
+{
+  std::unique_ptr<host_async_signal<Task>> signal(new host_async_signal<Task>());
+  signal->launch(std::move(deps), THRUST_FWD(f));
+  return host_unique_eager_event<Task>(std::move(signal));
+}
+
+// Computes the content of the future with `f()` as a `Task` once `deps` have
+// completed, which are kept alive until then.
+template <typename T, typename Task, typename... Dependencies, typename F>
+_CCCL_HOST host_unique_eager_future<T, Task> make_host_dependent_future(std::tuple<Dependencies...>&& deps, F&& f)
+{
+  std::unique_ptr<host_async_value<T, Task>> signal(new host_async_value<T, Task>());
+  signal->launch(std::move(deps), THRUST_FWD(f));
+  return host_unique_eager_future<T, Task>(std::move(signal));
+}
+
+struct host_async_noop
+{
+  void operator()() const {}
+};
+
+template <typename Task, typename... Events>
+_CCCL_HOST host_unique_eager_event<Task> host_when_all(Events&&... evs)
+{
+  return make_host_dependent_event<Task>(std::make_tuple(std::move(evs)...), host_async_noop{});
+}
+
+// ADL hook for transparent `.after` move support.
+template <typename Task>
+_CCCL_HOST auto capture_as_dependency(host_unique_eager_event<Task>& dependency)
+  THRUST_DECLTYPE_RETURNS(std::move(dependency))
+
+  // ADL hook for transparent `.after` move support.
+  template <typename T, typename Task>
+  _CCCL_HOST auto capture_as_dependency(host_unique_eager_future<T, Task>& dependency)
+    THRUST_DECLTYPE_RETURNS(std::move(dependency))
+
+} // namespace detail
+
+THRUST_NAMESPACE_END
+
+#endif // C++14
@@ -0,0 +1,92 @@
+/*
+ *  Copyright 2025 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file init_tags.h
+ *  \brief Tags selecting how the elements of a vector are initialized.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup container_classes Container Classes
+ *  \{
+ */
+
+/*! \p default_init_t is the type of \p default_init.
+ */
+struct default_init_t
+{
+  explicit default_init_t() = default;
+};
+
+/*! \p no_init_t is the type of \p no_init.
+ */
+struct no_init_t
+{
+  explicit no_init_t() = default;
+};
+
+/*! \p default_init asks the sizing constructors and \p resize of the thrust
+ *  vectors to default-initialize new elements instead of value-initializing
+ *  them. Elements of trivially default-constructible types are then left
+ *  uninitialized, unless the allocator customizes \p construct, which saves
+ *  a pass over memory when they are overwritten anyway. Other types are
+ *  constructed as before.
+ *
+ *  \code
+ *  #include <thrust/device_vector.h>
+ *  #include <thrust/sequence.h>
+ *  ...
+ *  thrust::device_vector<int> v(1 << 30, thrust::default_init); // no fill pass
+ *  thrust::sequence(v.begin(), v.end());
+ *  \endcode
+ *
+ *  \see no_init
+ */
+THRUST_INLINE_CONSTANT default_init_t default_init{};
+
+/*! \p no_init is like \p default_init, but never touches the new elements, not
+ *  even through an allocator's \p construct. It is only accepted for trivially
+ *  default-constructible element types.
+ *
+ *  \see default_init
+ */
+THRUST_INLINE_CONSTANT no_init_t no_init{};
+
+/*! \} // container_classes
+ */
+
+namespace detail
+{
+
+// selects value-initialization in vector_base, like the absence of a tag
+struct value_init_t
+{};
+
+} // namespace detail
+
+THRUST_NAMESPACE_END
@@ -45,6 +45,7 @@ THRUST_NAMESPACE_END
 #include <thrust/detail/allocator/no_throw_allocator.h>
 #include <thrust/detail/allocator/temporary_allocator.h>
 #include <thrust/detail/contiguous_storage.h>
+#include <thrust/detail/init_tags.h>
 #include <thrust/detail/memory_wrapper.h>
 #include <thrust/iterator/detail/tagged_iterator.h>
 #include <thrust/iterator/iterator_traits.h>
@@ -72,6 +73,9 @@ public:
   // provide a kill-switch to explicitly avoid initialization
   _CCCL_HOST_DEVICE temporary_array(int uninit, thrust::execution_policy<System>& system, size_type n);
 
+  // default-initializes the elements, which leaves trivially default-constructible ones uninitialized
+  _CCCL_HOST_DEVICE temporary_array(default_init_t, thrust::execution_policy<System>& system, size_type n);
+
   template <typename InputIterator>
   _CCCL_HOST_DEVICE temporary_array(thrust::execution_policy<System>& system, InputIterator first, size_type n);
 
@@ -76,6 +76,14 @@ _CCCL_HOST_DEVICE temporary_array<T, System>::temporary_array(int, thrust::execu
   ;
 } // end temporary_array::temporary_array()
 
+template <typename T, typename System>
+_CCCL_HOST_DEVICE
+temporary_array<T, System>::temporary_array(default_init_t, thrust::execution_policy<System>& system, size_type n)
+    : super_t(n, alloc_type(temporary_allocator<T, System>(system)))
+{
+  super_t::default_initialize_n(super_t::begin(), n);
+} // end temporary_array::temporary_array()
+
 template <typename T, typename System>
 template <typename InputIterator>
 _CCCL_HOST_DEVICE
@@ -32,6 +32,7 @@
 #endif // no system header
 
 #include <thrust/detail/contiguous_storage.h>
+#include <thrust/detail/init_tags.h>
 #include <thrust/detail/type_traits.h>
 #include <thrust/iterator/detail/normal_iterator.h>
 #include <thrust/iterator/iterator_traits.h>
@@ -90,6 +91,28 @@ public:
    */
   explicit vector_base(size_type n, const Alloc& alloc);
 
+  /*! This constructor creates a vector_base with default-initialized elements.
+   *  \param n The number of elements to create.
+   */
+  explicit vector_base(size_type n, default_init_t);
+
+  /*! This constructor creates a vector_base with default-initialized elements.
+   *  \param n The number of elements to create.
+   *  \param alloc The allocator to use by this vector_base.
+   */
+  explicit vector_base(size_type n, default_init_t, const Alloc& alloc);
+
+  /*! This constructor creates a vector_base with uninitialized elements.
+   *  \param n The number of elements to create.
+   */
+  explicit vector_base(size_type n, no_init_t);
+
+  /*! This constructor creates a vector_base with uninitialized elements.
+   *  \param n The number of elements to create.
+   *  \param alloc The allocator to use by this vector_base.
+   */
+  explicit vector_base(size_type n, no_init_t, const Alloc& alloc);
+
   /*! This constructor creates a vector_base with copies
    *  of an exemplar element.
    *  \param n The number of elements to initially create.
@@ -228,6 +251,22 @@ public:
    */
   void resize(size_type new_size, const value_type& x);
 
+  /*! \brief Resizes this vector_base to the specified number of elements.
+   *  \param new_size Number of elements this vector_base should contain.
+   *  \throw std::length_error If n exceeds max_size().
+   *
+   *  Like <tt>resize(new_size)</tt>, but new elements are default-initialized.
+   */
+  void resize(size_type new_size, default_init_t);
+
+  /*! \brief Resizes this vector_base to the specified number of elements.
+   *  \param new_size Number of elements this vector_base should contain.
+   *  \throw std::length_error If n exceeds max_size().
+   *
+   *  Like <tt>resize(new_size)</tt>, but new elements are left uninitialized.
+   */
+  void resize(size_type new_size, no_init_t);
+
   /*! Returns the number of elements in this vector_base.
    */
   _CCCL_HOST_DEVICE size_type size() const;
@@ -501,7 +540,8 @@ private:
   template <typename ForwardIterator>
   void range_init(ForwardIterator first, ForwardIterator last, thrust::random_access_traversal_tag);
 
-  void value_init(size_type n);
+  template <typename InitTag>
+  void size_init(size_type n, InitTag init);
 
   void fill_init(size_type n, const T& x);
 
@@ -514,8 +554,16 @@ private:
   template <typename InputIteratorOrIntegralType>
   void insert_dispatch(iterator position, InputIteratorOrIntegralType n, InputIteratorOrIntegralType x, true_type);
 
-  // this method appends n value-initialized elements at the end
-  void append(size_type n);
+  // these methods initialize the n elements at first in the given storage as the tag asks
+  static void initialize_n(storage_type& storage, iterator first, size_type n, value_init_t);
+
+  static void initialize_n(storage_type& storage, iterator first, size_type n, default_init_t);
+
+  static void initialize_n(storage_type& storage, iterator first, size_type n, no_init_t);
+
+  // this method appends n elements at the end, initialized as the tag asks
+  template <typename InitTag>
+  void append(size_type n, InitTag init);
 
   // this method performs insertion from a fill value
   void fill_insert(iterator position, size_type n, const T& x);
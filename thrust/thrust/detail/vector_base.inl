@@ -64,7 +64,7 @@ vector_base<T, Alloc>::vector_base(size_type n)
     : m_storage()
     , m_size(0)
 {
-  value_init(n);
+  size_init(n, value_init_t());
 } // end vector_base::vector_base()
 
 template <typename T, typename Alloc>
@@ -72,7 +72,39 @@ vector_base<T, Alloc>::vector_base(size_type n, const Alloc& alloc)
     : m_storage(alloc)
     , m_size(0)
 {
-  value_init(n);
+  size_init(n, value_init_t());
+} // end vector_base::vector_base()
+
+template <typename T, typename Alloc>
+vector_base<T, Alloc>::vector_base(size_type n, default_init_t init)
+    : m_storage()
+    , m_size(0)
+{
+  size_init(n, init);
+} // end vector_base::vector_base()
+
+template <typename T, typename Alloc>
+vector_base<T, Alloc>::vector_base(size_type n, default_init_t init, const Alloc& alloc)
+    : m_storage(alloc)
+    , m_size(0)
+{
+  size_init(n, init);
+} // end vector_base::vector_base()
+
+template <typename T, typename Alloc>
+vector_base<T, Alloc>::vector_base(size_type n, no_init_t init)
+    : m_storage()
+    , m_size(0)
+{
+  size_init(n, init);
+} // end vector_base::vector_base()
+
+template <typename T, typename Alloc>
+vector_base<T, Alloc>::vector_base(size_type n, no_init_t init, const Alloc& alloc)
+    : m_storage(alloc)
+    , m_size(0)
+{
+  size_init(n, init);
 } // end vector_base::vector_base()
 
 template <typename T, typename Alloc>
@@ -212,16 +244,36 @@ void vector_base<T, Alloc>::init_dispatch(IteratorOrIntegralType n, IteratorOrIn
 } // end vector_base::init_dispatch()
 
 template <typename T, typename Alloc>
-void vector_base<T, Alloc>::value_init(size_type n)
+template <typename InitTag>
+void vector_base<T, Alloc>::size_init(size_type n, InitTag init)
 {
   if (n > 0)
   {
     m_storage.allocate(n);
     m_size = n;
 
-    m_storage.value_initialize_n(begin(), size());
+    initialize_n(m_storage, begin(), size(), init);
   } // end if
-} // end vector_base::value_init()
+} // end vector_base::size_init()
+
+template <typename T, typename Alloc>
+void vector_base<T, Alloc>::initialize_n(storage_type& storage, iterator first, size_type n, value_init_t)
+{
+  storage.value_initialize_n(first, n);
+} // end vector_base::initialize_n()
+
+template <typename T, typename Alloc>
+void vector_base<T, Alloc>::initialize_n(storage_type& storage, iterator first, size_type n, default_init_t)
+{
+  storage.default_initialize_n(first, n);
+} // end vector_base::initialize_n()
+
+template <typename T, typename Alloc>
+void vector_base<T, Alloc>::initialize_n(storage_type&, iterator, size_type, no_init_t)
+{
+  static_assert(::cuda::std::is_trivially_default_constructible<T>::value,
+                "thrust::no_init requires a trivially default-constructible element type");
+} // end vector_base::initialize_n()
 
 template <typename T, typename Alloc>
 void vector_base<T, Alloc>::fill_init(size_type n, const T& x)
@@ -308,7 +360,37 @@ void vector_base<T, Alloc>::resize(size_type new_size)
   } // end if
   else
   {
-    append(new_size - size());
+    append(new_size - size(), value_init_t());
+  } // end else
+} // end vector_base::resize()
+
+template <typename T, typename Alloc>
+void vector_base<T, Alloc>::resize(size_type new_size, default_init_t init)
+{
+  if (new_size < size())
+  {
+    iterator new_end = begin();
+    thrust::advance(new_end, new_size);
+    erase(new_end, end());
+  } // end if
+  else
+  {
+    append(new_size - size(), init);
+  } // end else
+} // end vector_base::resize()
+
+template <typename T, typename Alloc>
+void vector_base<T, Alloc>::resize(size_type new_size, no_init_t init)
+{
+  if (new_size < size())
+  {
+    iterator new_end = begin();
+    thrust::advance(new_end, new_size);
+    erase(new_end, end());
+  } // end if
+  else
+  {
+    append(new_size - size(), init);
   } // end else
 } // end vector_base::resize()
 
@@ -785,7 +867,8 @@ void vector_base<T, Alloc>::copy_insert(iterator position, ForwardIterator first
 } // end vector_base::copy_insert()
 
 template <typename T, typename Alloc>
-void vector_base<T, Alloc>::append(size_type n)
+template <typename InitTag>
+void vector_base<T, Alloc>::append(size_type n, InitTag init)
 {
   if (n != 0)
   {
@@ -793,8 +876,8 @@ void vector_base<T, Alloc>::append(size_type n)
     {
       // we've got room for all of them
 
-      // default construct new elements at the end of the vector
-      m_storage.value_initialize_n(end(), n);
+      // construct new elements at the end of the vector
+      initialize_n(m_storage, end(), n, init);
 
       // extend the size
       m_size += n;
@@ -824,7 +907,7 @@ void vector_base<T, Alloc>::append(size_type n)
         new_end = m_storage.uninitialized_copy(begin(), end(), new_storage.begin());
 
         // construct new elements to insert
-        new_storage.value_initialize_n(new_end, n);
+        initialize_n(new_storage, new_end, n, init);
         new_end += n;
       } // end try
       catch (...)
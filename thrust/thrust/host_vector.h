@@ -106,6 +106,44 @@ public:
       : Parent(n, alloc)
   {}
 
+  /*! This constructor creates a \p host_vector with the given size and
+   *  default-initialized elements, which leaves elements of trivially
+   *  default-constructible types uninitialized.
+   *  \param n The number of elements to initially create.
+   */
+  _CCCL_HOST explicit host_vector(size_type n, default_init_t init)
+      : Parent(n, init)
+  {}
+
+  /*! This constructor creates a \p host_vector with the given size and
+   *  default-initialized elements, which leaves elements of trivially
+   *  default-constructible types uninitialized.
+   *  \param n The number of elements to initially create.
+   *  \param alloc The allocator to use by this host_vector.
+   */
+  _CCCL_HOST explicit host_vector(size_type n, default_init_t init, const Alloc& alloc)
+      : Parent(n, init, alloc)
+  {}
+
+  /*! This constructor creates a \p host_vector with the given size and
+   *  uninitialized elements. The element type must be trivially
+   *  default-constructible.
+   *  \param n The number of elements to initially create.
+   */
+  _CCCL_HOST explicit host_vector(size_type n, no_init_t init)
+      : Parent(n, init)
+  {}
+
+  /*! This constructor creates a \p host_vector with the given size and
+   *  uninitialized elements. The element type must be trivially
+   *  default-constructible.
+   *  \param n The number of elements to initially create.
+   *  \param alloc The allocator to use by this host_vector.
+   */
+  _CCCL_HOST explicit host_vector(size_type n, no_init_t init, const Alloc& alloc)
+      : Parent(n, init, alloc)
+  {}
+
   /*! This constructor creates a \p host_vector with copies
    *  of an exemplar element.
    *  \param n The number of elements to initially create.
@@ -288,6 +326,25 @@ public:
      */
     void resize(size_type new_size, const value_type &x = value_type());
 
+    /*! \brief Resizes this vector to the specified number of elements.
+     *  \param new_size Number of elements this vector should contain.
+     *  \throw std::length_error If n exceeds max_size().
+     *
+     *  Like <tt>resize(new_size)</tt>, but new elements are default-initialized,
+     *  which leaves elements of trivially default-constructible types
+     *  uninitialized.
+     */
+    void resize(size_type new_size, default_init_t);
+
+    /*! \brief Resizes this vector to the specified number of elements.
+     *  \param new_size Number of elements this vector should contain.
+     *  \throw std::length_error If n exceeds max_size().
+     *
+     *  Like <tt>resize(new_size)</tt>, but new elements are left uninitialized.
+     *  The element type must be trivially default-constructible.
+     */
+    void resize(size_type new_size, no_init_t);
+
     /*! Returns the number of elements in this vector.
      */
     size_type size() const;
@@ -0,0 +1,563 @@
+/*
+ *  Copyright 2025 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief Per-thread caches of free blocks in front of a mutex-synchronized pool resource.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/integer_math.h>
+#include <thrust/mr/pool_options.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+
+// Wraps an unsynchronized pool resource in a mutex, and puts a small magazine of free blocks of every pool size in
+// front of it for each thread using it.
+//
+// A thread allocates from and frees to its own magazines without any synchronization. When a magazine runs empty, it
+// is swapped for a full one from the depot of its size, and only when the depot is empty as well is the magazine
+// refilled halfway from the pool under the mutex. A thread freeing into a full magazine swaps it for an empty one and
+// pushes the full one to the depot. Blocks freed by a thread other than the one that allocated them therefore flow
+// back to the allocating thread through the depot without the mutex ever being taken. Once a depot holds
+// depot_magazines full magazines, a full magazine is instead drained halfway into the pool under the mutex, so that the
+// depots stay bounded when one thread keeps freeing what another one allocates.
+//
+// The depots are lock-free stacks. A pop takes the whole stack and pushes back all but its first magazine, so that no
+// magazine can be popped and pushed again in the middle of another pop.
+//
+// The magazines of a thread are only ever touched by that thread. A release of the pool bumps its generation instead,
+// and every thread empties its magazines the next time it uses the pool.
+template <typename Pool, typename VoidPtr>
+class thread_cached_pool
+{
+  using lock_t = std::lock_guard<std::mutex>;
+
+  static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+  static constexpr std::size_t magazine_slots = 64;
+
+  // XXX this value is a tuning opportunity
+  static constexpr std::size_t depot_magazines = 8;
+
+  struct magazine
+  {
+    magazine* next;
+    std::size_t count;
+    VoidPtr blocks[magazine_slots];
+  };
+
+  // padded, so that threads swapping magazines of different sizes do not share cache lines
+  struct depot
+  {
+    std::atomic<magazine*> head;
+    // the number of magazines pushed or about to be pushed, at most depot_magazines
+    std::atomic<std::size_t> count;
+    char padding[64 - sizeof(std::atomic<magazine*>) - sizeof(std::atomic<std::size_t>)];
+  };
+
+  enum thread_cache_state
+  {
+    cache_in_use,
+    cache_orphaned,
+    cache_retired
+  };
+
+  // the magazines of one thread; shared between the pool and the thread, so that either may go away first
+  struct thread_cache
+  {
+    std::atomic<int> state;
+    // the generation of the pool the blocks in the magazines belong to
+    std::size_t generation;
+    std::vector<magazine*> loaded;
+  };
+
+  struct registry_entry
+  {
+    std::uint64_t pool_id;
+    std::shared_ptr<thread_cache> cache;
+  };
+
+  // set when the registry of the current thread is destroyed; trivially destructible, so that it can still be read from
+  // the destructors of later thread_local objects, or of static objects on the main thread
+  static bool& current_thread_registry_destroyed()
+  {
+    static thread_local bool destroyed = false;
+    return destroyed;
+  }
+
+  // the caches of the current thread, one for each live pool of this type it used
+  struct thread_registry
+  {
+    std::vector<registry_entry> entries;
+
+    ~thread_registry()
+    {
+      // leave the magazines for the next thread that starts using the pool; a retired cache stays retired
+      for (std::size_t i = 0; i < entries.size(); ++i)
+      {
+        int expected = cache_in_use;
+        entries[i].cache->state.compare_exchange_strong(expected, cache_orphaned, std::memory_order_release);
+      }
+      current_thread_registry_destroyed() = true;
+    }
+  };
+
+  // nullptr once the registry of the current thread has been destroyed
+  static thread_registry* current_thread_registry()
+  {
+    if (current_thread_registry_destroyed())
+    {
+      return nullptr;
+    }
+
+    static thread_local thread_registry registry;
+    return &registry;
+  }
+
+  static std::uint64_t next_pool_id()
+  {
+    static std::atomic<std::uint64_t> next_id(0);
+    return next_id.fetch_add(1, std::memory_order_relaxed);
+  }
+
+public:
+  template <typename... Args>
+  thread_cached_pool(const mr::pool_options& options, Args&&... args)
+      : m_pool(static_cast<Args&&>(args)..., options)
+      , m_id(next_pool_id())
+      , m_smallest_block_log2(thrust::detail::log2_ri(options.smallest_block_size))
+      , m_smallest_block_size(options.smallest_block_size)
+      , m_largest_block_size(options.largest_block_size)
+      , m_alignment(options.alignment)
+      , m_capacity(thrust::detail::log2_ri(options.largest_block_size) - m_smallest_block_log2 + 1)
+      , m_full(new depot[m_capacity.size()])
+      , m_empty(nullptr)
+      , m_generation(0)
+  {
+    for (std::size_t i = 0; i < m_capacity.size(); ++i)
+    {
+      // every cached pool size gets about options.thread_cache_bytes in each magazine; pool sizes which fit less
+      // than two blocks into that are not cached at all
+      std::size_t block_size = static_cast<std::size_t>(1) << (i + m_smallest_block_log2);
+      std::size_t capacity   = options.thread_cache_bytes / block_size;
+      if (capacity > magazine_slots)
+      {
+        capacity = magazine_slots;
+      }
+      m_capacity[i] = capacity >= 2 ? capacity : 0;
+      m_full[i].head.store(nullptr, std::memory_order_relaxed);
+      m_full[i].count.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  ~thread_cached_pool()
+  {
+    lock_t lock(m_mtx);
+
+    for (std::size_t i = 0; i < m_threads.size(); ++i)
+    {
+      thread_cache& cache = *m_threads[i];
+      cache.state.store(cache_retired, std::memory_order_relaxed);
+      for (std::size_t j = 0; j < cache.loaded.size(); ++j)
+      {
+        delete cache.loaded[j];
+        cache.loaded[j] = nullptr;
+      }
+    }
+
+    for (std::size_t i = 0; i < m_capacity.size(); ++i)
+    {
+      delete_magazines(m_full[i].head.exchange(nullptr, std::memory_order_acquire));
+    }
+    delete_magazines(m_empty.exchange(nullptr, std::memory_order_acquire));
+  }
+
+  thread_cached_pool(const thread_cached_pool&)            = delete;
+  thread_cached_pool& operator=(const thread_cached_pool&) = delete;
+
+  // Like the release of the pool, this must not run concurrently with allocations, which it invalidates anyway. The
+  // magazines of the threads are left alone; each thread empties its own the next time it uses the pool.
+  void release()
+  {
+    lock_t lock(m_mtx);
+
+    m_generation.fetch_add(1, std::memory_order_release);
+
+    for (std::size_t i = 0; i < m_capacity.size(); ++i)
+    {
+      magazine* full = m_full[i].head.exchange(nullptr, std::memory_order_acquire);
+      m_full[i].count.store(0, std::memory_order_relaxed);
+      while (full)
+      {
+        magazine* next = full->next;
+        full->count    = 0;
+        push(m_empty, full);
+        full = next;
+      }
+    }
+
+    m_pool.release();
+  }
+
+  VoidPtr do_allocate(std::size_t bytes, std::size_t alignment)
+  {
+    std::size_t cls = size_class(bytes, alignment);
+    if (cls == npos)
+    {
+      lock_t lock(m_mtx);
+      return m_pool.do_allocate(bytes, alignment);
+    }
+
+    thread_cache* cache = local_cache();
+    if (!cache)
+    {
+      lock_t lock(m_mtx);
+      return m_pool.do_allocate(block_size(cls), m_alignment);
+    }
+
+    magazine*& loaded = cache->loaded[cls];
+    if (!loaded || loaded->count == 0)
+    {
+      refill(cls, loaded);
+    }
+
+    return loaded->blocks[--loaded->count];
+  }
+
+  void do_deallocate(VoidPtr p, std::size_t n, std::size_t alignment)
+  {
+    std::size_t cls = size_class(n, alignment);
+    if (cls == npos)
+    {
+      lock_t lock(m_mtx);
+      m_pool.do_deallocate(p, n, alignment);
+      return;
+    }
+
+    thread_cache* cache = local_cache();
+    if (!cache)
+    {
+      lock_t lock(m_mtx);
+      m_pool.do_deallocate(p, block_size(cls), m_alignment);
+      return;
+    }
+
+    magazine*& loaded = cache->loaded[cls];
+    if (loaded && loaded->count == m_capacity[cls] && !reserve(m_full[cls]))
+    {
+      // the depot has enough full magazines already
+      drain(cls, *loaded);
+    }
+    else if (!loaded || loaded->count == m_capacity[cls])
+    {
+      magazine* empty = pop(m_empty);
+      if (!empty)
+      {
+        empty = new (std::nothrow) magazine;
+      }
+      if (!empty)
+      {
+        if (loaded)
+        {
+          m_full[cls].count.fetch_sub(1, std::memory_order_relaxed);
+        }
+        lock_t lock(m_mtx);
+        m_pool.do_deallocate(p, block_size(cls), m_alignment);
+        return;
+      }
+
+      empty->count = 0;
+      if (loaded)
+      {
+        push(m_full[cls], loaded);
+      }
+      loaded = empty;
+    }
+
+    loaded->blocks[loaded->count++] = p;
+  }
+
+private:
+  std::size_t block_size(std::size_t cls) const
+  {
+    return static_cast<std::size_t>(1) << (cls + m_smallest_block_log2);
+  }
+
+  // the index of the pool size serving the request, or npos if the request bypasses the magazines
+  std::size_t size_class(std::size_t bytes, std::size_t alignment) const
+  {
+    bytes = (std::max)(bytes, m_smallest_block_size);
+    if (bytes > m_largest_block_size || alignment > m_alignment)
+    {
+      return npos;
+    }
+
+    std::size_t cls = thrust::detail::log2_ri(bytes) - m_smallest_block_log2;
+    return m_capacity[cls] ? cls : npos;
+  }
+
+  // makes room for one more magazine in the depot, unless it is full
+  static bool reserve(depot& d)
+  {
+    std::size_t count = d.count.load(std::memory_order_relaxed);
+    do
+    {
+      if (count >= depot_magazines)
+      {
+        return false;
+      }
+    } while (!d.count.compare_exchange_weak(count, count + 1, std::memory_order_relaxed));
+    return true;
+  }
+
+  // the magazine must have been reserved room for
+  static void push(depot& d, magazine* m)
+  {
+    push(d.head, m);
+  }
+
+  static magazine* pop(depot& d)
+  {
+    magazine* m = pop(d.head);
+    if (m)
+    {
+      d.count.fetch_sub(1, std::memory_order_relaxed);
+    }
+    return m;
+  }
+
+  static void push(std::atomic<magazine*>& head, magazine* m)
+  {
+    m->next = head.load(std::memory_order_relaxed);
+    while (!head.compare_exchange_weak(m->next, m, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+  }
+
+  static magazine* pop(std::atomic<magazine*>& head)
+  {
+    magazine* first = head.exchange(nullptr, std::memory_order_acquire);
+    if (!first)
+    {
+      return nullptr;
+    }
+
+    magazine* rest = first->next;
+    if (rest)
+    {
+      magazine* last = rest;
+      while (last->next)
+      {
+        last = last->next;
+      }
+
+      last->next = head.load(std::memory_order_relaxed);
+      while (!head.compare_exchange_weak(last->next, rest, std::memory_order_release, std::memory_order_relaxed))
+      {
+      }
+    }
+
+    return first;
+  }
+
+  static void delete_magazines(magazine* m)
+  {
+    while (m)
+    {
+      magazine* next = m->next;
+      delete m;
+      m = next;
+    }
+  }
+
+  // returns the blocks in the upper half of a full magazine to the pool in one batch
+  void drain(std::size_t cls, magazine& m)
+  {
+    std::size_t count = m_capacity[cls] / 2;
+
+    lock_t lock(m_mtx);
+    while (m.count > count)
+    {
+      --m.count;
+      m_pool.do_deallocate(m.blocks[m.count], block_size(cls), m_alignment);
+    }
+  }
+
+  void refill(std::size_t cls, magazine*& loaded)
+  {
+    magazine* full = pop(m_full[cls]);
+    if (full)
+    {
+      if (loaded)
+      {
+        push(m_empty, loaded);
+      }
+      loaded = full;
+      return;
+    }
+
+    if (!loaded)
+    {
+      loaded = pop(m_empty);
+      if (!loaded)
+      {
+        loaded = new magazine;
+      }
+      loaded->count = 0;
+    }
+
+    // fill the magazine only halfway, so that freeing the blocks back does not immediately overflow it
+    std::size_t count = m_capacity[cls] / 2;
+
+    lock_t lock(m_mtx);
+    try
+    {
+      while (loaded->count < count)
+      {
+        loaded->blocks[loaded->count] = m_pool.do_allocate(block_size(cls), m_alignment);
+        ++loaded->count;
+      }
+    }
+    catch (...)
+    {
+      if (loaded->count == 0)
+      {
+        throw;
+      }
+    }
+  }
+
+  // the cache of the current thread, with the magazines emptied if the pool has been released since it last used them
+  thread_cache* local_cache()
+  {
+    thread_cache* cache = find_local_cache();
+    if (cache)
+    {
+      std::size_t generation = m_generation.load(std::memory_order_acquire);
+      if (cache->generation != generation)
+      {
+        for (std::size_t i = 0; i < cache->loaded.size(); ++i)
+        {
+          if (cache->loaded[i])
+          {
+            cache->loaded[i]->count = 0;
+          }
+        }
+        cache->generation = generation;
+      }
+    }
+    return cache;
+  }
+
+  // the cache of the current thread, or nullptr if the thread is exiting and its registry is gone already
+  thread_cache* find_local_cache()
+  {
+    thread_registry* registry_ptr = current_thread_registry();
+    if (!registry_ptr)
+    {
+      return nullptr;
+    }
+
+    thread_registry& registry = *registry_ptr;
+    for (std::size_t i = 0; i < registry.entries.size(); ++i)
+    {
+      if (registry.entries[i].pool_id == m_id)
+      {
+        return registry.entries[i].cache.get();
+      }
+    }
+
+    // forget about the caches of pools that are gone
+    std::size_t live = 0;
+    for (std::size_t i = 0; i < registry.entries.size(); ++i)
+    {
+      if (registry.entries[i].cache->state.load(std::memory_order_relaxed) != cache_retired)
+      {
+        registry.entries[live++] = registry.entries[i];
+      }
+    }
+    registry.entries.resize(live);
+
+    registry_entry entry;
+    entry.pool_id = m_id;
+
+    {
+      lock_t lock(m_mtx);
+
+      // adopt the magazines of a thread that has exited, if there is one
+      for (std::size_t i = 0; i < m_threads.size() && !entry.cache; ++i)
+      {
+        int expected = cache_orphaned;
+        if (m_threads[i]->state.compare_exchange_strong(expected, cache_in_use, std::memory_order_acquire))
+        {
+          entry.cache = m_threads[i];
+        }
+      }
+
+      if (!entry.cache)
+      {
+        entry.cache = std::make_shared<thread_cache>();
+        entry.cache->state.store(cache_in_use, std::memory_order_relaxed);
+        entry.cache->generation = m_generation.load(std::memory_order_relaxed);
+        entry.cache->loaded.resize(m_capacity.size(), nullptr);
+        m_threads.push_back(entry.cache);
+      }
+    }
+
+    registry.entries.push_back(entry);
+    return entry.cache.get();
+  }
+
+  std::mutex m_mtx;
+  Pool m_pool;
+
+  std::uint64_t m_id;
+  std::size_t m_smallest_block_log2;
+  std::size_t m_smallest_block_size;
+  std::size_t m_largest_block_size;
+  std::size_t m_alignment;
+
+  // the number of blocks in a full magazine, for each pool size; zero for pool sizes that are not cached
+  std::vector<std::size_t> m_capacity;
+  std::unique_ptr<depot[]> m_full;
+  std::atomic<magazine*> m_empty;
+  std::atomic<std::size_t> m_generation;
+
+  std::vector<std::shared_ptr<thread_cache>> m_threads;
+};
+
+} // namespace detail
+THRUST_NAMESPACE_END
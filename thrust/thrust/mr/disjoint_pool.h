@@ -33,15 +33,15 @@
 
 #include <thrust/detail/config.h>
 
-#include <thrust/binary_search.h>
 #include <thrust/detail/algorithm_wrapper.h>
-#include <thrust/detail/seq.h>
+#include <thrust/detail/raw_reference_cast.h>
 #include <thrust/host_vector.h>
 #include <thrust/mr/allocator.h>
 #include <thrust/mr/memory_resource.h>
 #include <thrust/mr/pool_options.h>
 
 #include <cassert>
+#include <cstdint>
 
 THRUST_NAMESPACE_BEGIN
 namespace mr
@@ -105,6 +105,8 @@ public:
     ret.cached_size_cutoff_factor      = 16;
     ret.cached_alignment_cutoff_factor = 16;
 
+    ret.thread_cache_bytes = static_cast<std::size_t>(1) << 16;
+
     return ret;
   }
 
@@ -179,52 +181,389 @@ private:
     std::size_t size;
     std::size_t alignment;
     void_ptr pointer;
+  };
+
+  using oversized_block_vector =
+    thrust::host_vector<oversized_block_descriptor, allocator<oversized_block_descriptor, Bookkeeper>>;
+
+  static constexpr std::size_t npos = static_cast<std::size_t>(-1);
 
-    _CCCL_HOST_DEVICE bool operator==(const oversized_block_descriptor& other) const
+  // An open addressing hash table of all oversized/overaligned allocations from upstream, keyed by their pointers.
+  // Empty slots have an alignment of zero.
+  class oversized_block_index
+  {
+  public:
+    oversized_block_index(Bookkeeper* bookkeeper)
+        : m_slots(bookkeeper)
+        , m_count(0)
+    {}
+
+    std::size_t capacity() const
     {
-      return size == other.size && alignment == other.alignment && pointer == other.pointer;
+      return m_slots.size();
     }
 
-    _CCCL_HOST_DEVICE bool operator<(const oversized_block_descriptor& other) const
+    bool occupied(std::size_t slot) const
     {
-      return size < other.size || (size == other.size && alignment < other.alignment);
+      return get(slot).alignment != 0;
     }
-  };
 
-  struct equal_pointers
-  {
-  public:
-    _CCCL_HOST_DEVICE equal_pointers(void_ptr p)
-        : p(p)
-    {}
+    const oversized_block_descriptor& operator[](std::size_t slot) const
+    {
+      return get(slot);
+    }
 
-    _CCCL_HOST_DEVICE bool operator()(const oversized_block_descriptor& desc) const
+    // returns the slot of the block starting at p, or npos
+    std::size_t find(void_ptr p) const
     {
-      return desc.pointer == p;
+      if (m_slots.empty())
+      {
+        return npos;
+      }
+
+      const std::size_t mask = m_slots.size() - 1;
+      for (std::size_t slot = hash(p) & mask;; slot = (slot + 1) & mask)
+      {
+        if (!occupied(slot))
+        {
+          return npos;
+        }
+        if (get(slot).pointer == p)
+        {
+          return slot;
+        }
+      }
+    }
+
+    void insert(const oversized_block_descriptor& desc)
+    {
+      // keep the load factor at or below 3/4
+      if (4 * (m_count + 1) > 3 * m_slots.size())
+      {
+        rehash((std::max)(static_cast<std::size_t>(16), 2 * m_slots.size()));
+      }
+
+      place(desc);
+      ++m_count;
+    }
+
+    void erase(std::size_t slot)
+    {
+      // backward shift deletion: move every following block of the probe sequence which would not be found anymore
+      // into the hole left behind
+      const std::size_t mask = m_slots.size() - 1;
+      for (std::size_t next = (slot + 1) & mask; occupied(next); next = (next + 1) & mask)
+      {
+        const std::size_t home = hash(get(next).pointer) & mask;
+        if (((next - home) & mask) >= ((next - slot) & mask))
+        {
+          get(slot) = get(next);
+          slot      = next;
+        }
+      }
+
+      get(slot).alignment = 0;
+      --m_count;
+    }
+
+    void clear()
+    {
+      m_slots.clear();
+      m_count = 0;
     }
 
   private:
-    void_ptr p;
+    oversized_block_descriptor& get(std::size_t slot)
+    {
+      return thrust::raw_reference_cast(m_slots[slot]);
+    }
+
+    const oversized_block_descriptor& get(std::size_t slot) const
+    {
+      return thrust::raw_reference_cast(m_slots[slot]);
+    }
+
+    static std::size_t hash(void_ptr p)
+    {
+      // blocks are aligned, so the low bits of their addresses carry no information; mix the high ones into them
+      std::uint64_t h =
+        static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(thrust::detail::pointer_traits<void_ptr>::get(p)));
+      h ^= h >> 33;
+      h *= 0xff51afd7ed558ccdull;
+      h ^= h >> 33;
+      return static_cast<std::size_t>(h);
+    }
+
+    void place(const oversized_block_descriptor& desc)
+    {
+      const std::size_t mask = m_slots.size() - 1;
+      std::size_t slot       = hash(desc.pointer) & mask;
+      while (occupied(slot))
+      {
+        slot = (slot + 1) & mask;
+      }
+      get(slot) = desc;
+    }
+
+    void rehash(std::size_t capacity)
+    {
+      oversized_block_descriptor empty;
+      empty.size      = 0;
+      empty.alignment = 0;
+      empty.pointer   = void_ptr();
+
+      oversized_block_vector old(capacity, empty, m_slots.get_allocator());
+      old.swap(m_slots);
+
+      for (std::size_t slot = 0; slot < old.size(); ++slot)
+      {
+        const oversized_block_descriptor& desc = thrust::raw_reference_cast(old[slot]);
+        if (desc.alignment != 0)
+        {
+          place(desc);
+        }
+      }
+    }
+
+    oversized_block_vector m_slots;
+    std::size_t m_count;
+  };
+
+  struct cached_block_node
+  {
+    oversized_block_descriptor block;
+    std::size_t priority;
+    std::size_t left;
+    std::size_t right;
   };
 
-  struct matching_alignment
+  using cached_block_node_vector = thrust::host_vector<cached_block_node, allocator<cached_block_node, Bookkeeper>>;
+
+  // A treap of the cached oversized/overaligned blocks, ordered by size, then alignment. Nodes are kept in a vector
+  // and refer to each other by index; ties are broken by the node index, which makes every key unique.
+  class cached_block_tree
   {
   public:
-    _CCCL_HOST_DEVICE matching_alignment(std::size_t requested)
-        : requested(requested)
+    cached_block_tree(Bookkeeper* bookkeeper)
+        : m_nodes(bookkeeper)
+        , m_root(npos)
+        , m_free(npos)
+        , m_seed(0)
     {}
 
-    _CCCL_HOST_DEVICE bool operator()(const oversized_block_descriptor& desc) const
+    bool empty() const
+    {
+      return m_root == npos;
+    }
+
+    const oversized_block_descriptor& operator[](std::size_t node) const
+    {
+      return get(node).block;
+    }
+
+    void insert(const oversized_block_descriptor& desc)
+    {
+      std::size_t node = m_free;
+      if (node != npos)
+      {
+        m_free = get(node).left;
+      }
+      else
+      {
+        node = m_nodes.size();
+        m_nodes.push_back(cached_block_node());
+      }
+
+      cached_block_node& n = get(node);
+      n.block              = desc;
+      n.priority           = next_priority();
+      n.left               = npos;
+      n.right              = npos;
+
+      m_root = insert(m_root, node);
+    }
+
+    void erase(std::size_t node)
+    {
+      m_root = erase(m_root, node);
+
+      get(node).left = m_free;
+      m_free         = node;
+    }
+
+    // returns the first node whose block is not ordered before a block of the given size and alignment, or npos
+    std::size_t lower_bound(std::size_t size, std::size_t alignment) const
     {
-      return desc.alignment >= requested;
+      std::size_t result = npos;
+      for (std::size_t node = m_root; node != npos;)
+      {
+        const oversized_block_descriptor& block = get(node).block;
+        if (block.size < size || (block.size == size && block.alignment < alignment))
+        {
+          node = get(node).right;
+        }
+        else
+        {
+          result = node;
+          node   = get(node).left;
+        }
+      }
+      return result;
+    }
+
+    // returns the node following the given one, or npos
+    std::size_t next(std::size_t node) const
+    {
+      std::size_t result = npos;
+      for (std::size_t current = m_root; current != npos;)
+      {
+        if (less(node, current))
+        {
+          result  = current;
+          current = get(current).left;
+        }
+        else
+        {
+          current = get(current).right;
+        }
+      }
+      return result;
+    }
+
+    void clear()
+    {
+      m_nodes.clear();
+      m_root = npos;
+      m_free = npos;
     }
 
   private:
-    std::size_t requested;
-  };
+    cached_block_node& get(std::size_t node)
+    {
+      return thrust::raw_reference_cast(m_nodes[node]);
+    }
 
-  using oversized_block_vector =
-    thrust::host_vector<oversized_block_descriptor, allocator<oversized_block_descriptor, Bookkeeper>>;
+    const cached_block_node& get(std::size_t node) const
+    {
+      return thrust::raw_reference_cast(m_nodes[node]);
+    }
+
+    bool less(std::size_t lhs, std::size_t rhs) const
+    {
+      const oversized_block_descriptor& l = get(lhs).block;
+      const oversized_block_descriptor& r = get(rhs).block;
+      if (l.size != r.size)
+      {
+        return l.size < r.size;
+      }
+      if (l.alignment != r.alignment)
+      {
+        return l.alignment < r.alignment;
+      }
+      return lhs < rhs;
+    }
+
+    std::size_t next_priority()
+    {
+      // splitmix64
+      std::uint64_t z = (m_seed += 0x9e3779b97f4a7c15ull);
+      z               = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+      z               = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+      return static_cast<std::size_t>(z ^ (z >> 31));
+    }
+
+    // splits the subtree rooted at root into the nodes ordered before node and the rest
+    void split(std::size_t root, std::size_t node, std::size_t& before, std::size_t& after)
+    {
+      if (root == npos)
+      {
+        before = npos;
+        after  = npos;
+      }
+      else if (less(root, node))
+      {
+        split(get(root).right, node, get(root).right, after);
+        before = root;
+      }
+      else
+      {
+        split(get(root).left, node, before, get(root).left);
+        after = root;
+      }
+    }
+
+    // joins two subtrees, all nodes of the first one being ordered before those of the second one
+    std::size_t merge(std::size_t before, std::size_t after)
+    {
+      if (before == npos)
+      {
+        return after;
+      }
+      if (after == npos)
+      {
+        return before;
+      }
+
+      if (get(before).priority > get(after).priority)
+      {
+        get(before).right = merge(get(before).right, after);
+        return before;
+      }
+
+      get(after).left = merge(before, get(after).left);
+      return after;
+    }
+
+    std::size_t insert(std::size_t root, std::size_t node)
+    {
+      if (root == npos)
+      {
+        return node;
+      }
+
+      if (get(node).priority > get(root).priority)
+      {
+        split(root, node, get(node).left, get(node).right);
+        return node;
+      }
+
+      if (less(node, root))
+      {
+        get(root).left = insert(get(root).left, node);
+      }
+      else
+      {
+        get(root).right = insert(get(root).right, node);
+      }
+      return root;
+    }
+
+    std::size_t erase(std::size_t root, std::size_t node)
+    {
+      assert(root != npos);
+
+      if (root == node)
+      {
+        return merge(get(root).left, get(root).right);
+      }
+
+      if (less(node, root))
+      {
+        get(root).left = erase(get(root).left, node);
+      }
+      else
+      {
+        get(root).right = erase(get(root).right, node);
+      }
+      return root;
+    }
+
+    cached_block_node_vector m_nodes;
+    std::size_t m_root;
+    // singly linked list of erased nodes, threaded through their left indices
+    std::size_t m_free;
+    std::uint64_t m_seed;
+  };
 
   using pointer_vector = thrust::host_vector<void_ptr, allocator<void_ptr, Bookkeeper>>;
 
@@ -260,10 +599,10 @@ private:
   pool_vector m_pools;
   // list of all allocations from upstream for the above
   chunk_vector m_allocated;
-  // list of all cached oversized/overaligned blocks that have been returned to the pool to cache
-  oversized_block_vector m_cached_oversized;
-  // list of all oversized/overaligned allocations from upstream
-  oversized_block_vector m_oversized;
+  // all cached oversized/overaligned blocks that have been returned to the pool to cache
+  cached_block_tree m_cached_oversized;
+  // all oversized/overaligned allocations from upstream
+  oversized_block_index m_oversized;
 
 public:
   /*! Releases all held memory to upstream.
@@ -284,9 +623,12 @@ public:
     }
 
     // deallocate cached oversized/overaligned memory
-    for (std::size_t i = 0; i < m_oversized.size(); ++i)
+    for (std::size_t i = 0; i < m_oversized.capacity(); ++i)
     {
-      m_upstream->do_deallocate(m_oversized[i].pointer, m_oversized[i].size, m_oversized[i].alignment);
+      if (m_oversized.occupied(i))
+      {
+        m_upstream->do_deallocate(m_oversized[i].pointer, m_oversized[i].size, m_oversized[i].alignment);
+      }
     }
 
     m_allocated.clear();
@@ -309,49 +651,44 @@ public:
 
       if (m_options.cache_oversized && !m_cached_oversized.empty())
       {
-        typename oversized_block_vector::iterator it =
-          thrust::lower_bound(thrust::seq, m_cached_oversized.begin(), m_cached_oversized.end(), oversized);
+        std::size_t node = m_cached_oversized.lower_bound(bytes, alignment);
 
-        // if the size is bigger than the requested size by a factor
-        // bigger than or equal to the specified cutoff for size,
-        // allocate a new block
-        if (it != m_cached_oversized.end())
+        // skip over blocks that are not aligned enough, but stop at the first one which is bigger than the requested
+        // size by a factor bigger than or equal to the specified cutoff for size; allocate a new block then
+        while (node != npos && m_cached_oversized[node].size / bytes < m_options.cached_size_cutoff_factor
+               && m_cached_oversized[node].alignment < alignment)
         {
-          std::size_t size_factor = (*it).size / bytes;
-          if (size_factor >= m_options.cached_size_cutoff_factor)
-          {
-            it = m_cached_oversized.end();
-          }
+          node = m_cached_oversized.next(node);
         }
 
-        if (it != m_cached_oversized.end() && (*it).alignment < alignment)
+        if (node != npos && m_cached_oversized[node].size / bytes >= m_options.cached_size_cutoff_factor)
         {
-          it = find_if(it + 1, m_cached_oversized.end(), matching_alignment(alignment));
+          node = npos;
         }
 
         // if the alignment is bigger than the requested one by a factor
         // bigger than or equal to the specified cutoff for alignment,
         // allocate a new block
-        if (it != m_cached_oversized.end())
+        if (node != npos)
         {
-          std::size_t alignment_factor = (*it).alignment / alignment;
+          std::size_t alignment_factor = m_cached_oversized[node].alignment / alignment;
           if (alignment_factor >= m_options.cached_alignment_cutoff_factor)
           {
-            it = m_cached_oversized.end();
+            node = npos;
           }
         }
 
-        if (it != m_cached_oversized.end())
+        if (node != npos)
         {
-          oversized.pointer = (*it).pointer;
-          m_cached_oversized.erase(it);
+          oversized.pointer = m_cached_oversized[node].pointer;
+          m_cached_oversized.erase(node);
           return oversized.pointer;
         }
       }
 
       // no fitting cached block found; allocate a new one that's just up to the specs
       oversized.pointer = m_upstream->do_allocate(bytes, alignment);
-      m_oversized.push_back(oversized);
+      m_oversized.insert(oversized);
 
       return oversized.pointer;
     }
@@ -426,20 +763,18 @@ public:
     // the deallocated block is oversized and/or overaligned
     if (n > m_options.largest_block_size || alignment > m_options.alignment)
     {
-      typename oversized_block_vector::iterator it = find_if(m_oversized.begin(), m_oversized.end(), equal_pointers(p));
-      assert(it != m_oversized.end());
+      std::size_t slot = m_oversized.find(p);
+      assert(slot != npos);
 
-      oversized_block_descriptor oversized = *it;
+      oversized_block_descriptor oversized = m_oversized[slot];
 
       if (m_options.cache_oversized)
       {
-        typename oversized_block_vector::iterator position =
-          lower_bound(m_cached_oversized.begin(), m_cached_oversized.end(), oversized);
-        m_cached_oversized.insert(position, oversized);
+        m_cached_oversized.insert(oversized);
         return;
       }
 
-      m_oversized.erase(it);
+      m_oversized.erase(slot);
 
       m_upstream->do_deallocate(p, oversized.size, oversized.alignment);
 
@@ -39,6 +39,7 @@
 #include <thrust/mr/pool_options.h>
 
 #include <cassert>
+#include <climits>
 
 THRUST_NAMESPACE_BEGIN
 namespace mr
@@ -100,6 +101,8 @@ public:
     ret.cached_size_cutoff_factor      = 16;
     ret.cached_alignment_cutoff_factor = 16;
 
+    ret.thread_cache_bytes = static_cast<std::size_t>(1) << 16;
+
     return ret;
   }
 
@@ -214,7 +217,9 @@ private:
   pool_vector m_pools;
   chunk_descriptor_ptr m_allocated;
   oversized_block_descriptor_ptr m_oversized;
-  oversized_block_descriptor_ptr m_cached_oversized;
+  // cached oversized/overaligned blocks, in lists binned by the base 2 logarithm of their size, so that a fitting
+  // block is looked for only among blocks of similar sizes
+  oversized_block_descriptor_ptr m_cached_oversized[sizeof(std::size_t) * CHAR_BIT];
 
 public:
   /*! Releases all held memory to upstream.
@@ -252,7 +257,10 @@ public:
       m_upstream->do_deallocate(p, desc.size + sizeof(oversized_block_descriptor), desc.alignment);
     }
 
-    m_cached_oversized = oversized_block_descriptor_ptr();
+    for (std::size_t bin = 0; bin < sizeof(std::size_t) * CHAR_BIT; ++bin)
+    {
+      m_cached_oversized[bin] = oversized_block_descriptor_ptr();
+    }
   }
 
   _CCCL_NODISCARD virtual void_ptr
@@ -266,80 +274,90 @@ public:
     {
       if (m_options.cache_oversized)
       {
-        oversized_block_descriptor_ptr ptr       = m_cached_oversized;
-        oversized_block_descriptor_ptr* previous = &m_cached_oversized;
-        while (oversized_block_ptr_traits::get(ptr))
+        for (std::size_t bin = detail::log2(bytes); bin < sizeof(std::size_t) * CHAR_BIT; ++bin)
         {
-          oversized_block_descriptor desc = *ptr;
-          bool is_good                    = desc.size >= bytes && desc.alignment >= alignment;
-
-          // if the size is bigger than the requested size by a factor
-          // bigger than or equal to the specified cutoff for size,
-          // allocate a new block
-          if (is_good)
+          // all blocks in this bin and the following ones are bigger than the requested size by a factor bigger than
+          // or equal to the specified cutoff for size
+          if ((static_cast<std::size_t>(1) << bin) / bytes >= m_options.cached_size_cutoff_factor)
           {
-            std::size_t size_factor = desc.size / bytes;
-            if (size_factor >= m_options.cached_size_cutoff_factor)
-            {
-              is_good = false;
-            }
+            break;
           }
 
-          // if the alignment is bigger than the requested one by a factor
-          // bigger than or equal to the specified cutoff for alignment,
-          // allocate a new block
-          if (is_good)
+          oversized_block_descriptor_ptr ptr       = m_cached_oversized[bin];
+          oversized_block_descriptor_ptr* previous = &m_cached_oversized[bin];
+          while (oversized_block_ptr_traits::get(ptr))
           {
-            std::size_t alignment_factor = desc.alignment / alignment;
-            if (alignment_factor >= m_options.cached_alignment_cutoff_factor)
-            {
-              is_good = false;
-            }
-          }
+            oversized_block_descriptor desc = *ptr;
+            bool is_good                    = desc.size >= bytes && desc.alignment >= alignment;
 
-          if (is_good)
-          {
-            if (previous != &m_cached_oversized)
+            // if the size is bigger than the requested size by a factor
+            // bigger than or equal to the specified cutoff for size,
+            // allocate a new block
+            if (is_good)
             {
-              *previous = desc.next_cached;
+              std::size_t size_factor = desc.size / bytes;
+              if (size_factor >= m_options.cached_size_cutoff_factor)
+              {
+                is_good = false;
+              }
             }
-            else
+
+            // if the alignment is bigger than the requested one by a factor
+            // bigger than or equal to the specified cutoff for alignment,
+            // allocate a new block
+            if (is_good)
             {
-              m_cached_oversized = desc.next_cached;
+              std::size_t alignment_factor = desc.alignment / alignment;
+              if (alignment_factor >= m_options.cached_alignment_cutoff_factor)
+              {
+                is_good = false;
+              }
             }
 
-            desc.next_cached = oversized_block_descriptor_ptr();
-
-            auto ret = static_cast<char_ptr>(static_cast<void_ptr>(ptr)) - desc.size;
-
-            if (bytes != desc.size)
+            if (is_good)
             {
-              desc.current_size = bytes;
-
-              ptr = static_cast<oversized_block_descriptor_ptr>(static_cast<void_ptr>(ret + bytes));
-
-              if (oversized_block_ptr_traits::get(desc.prev))
+              if (previous != &m_cached_oversized[bin])
               {
-                thrust::raw_reference_cast(*desc.prev).next = ptr;
+                *previous = desc.next_cached;
               }
               else
               {
-                m_oversized = ptr;
+                m_cached_oversized[bin] = desc.next_cached;
               }
 
-              if (oversized_block_ptr_traits::get(desc.next))
+              desc.next_cached = oversized_block_descriptor_ptr();
+
+              auto ret = static_cast<char_ptr>(static_cast<void_ptr>(ptr)) - desc.size;
+
+              if (bytes != desc.size)
               {
-                thrust::raw_reference_cast(*desc.next).prev = ptr;
+                desc.current_size = bytes;
+
+                ptr = static_cast<oversized_block_descriptor_ptr>(static_cast<void_ptr>(ret + bytes));
+
+                if (oversized_block_ptr_traits::get(desc.prev))
+                {
+                  thrust::raw_reference_cast(*desc.prev).next = ptr;
+                }
+                else
+                {
+                  m_oversized = ptr;
+                }
+
+                if (oversized_block_ptr_traits::get(desc.next))
+                {
+                  thrust::raw_reference_cast(*desc.next).prev = ptr;
+                }
               }
-            }
 
-            *ptr = desc;
+              *ptr = desc;
 
-            return static_cast<void_ptr>(ret);
-          }
+              return static_cast<void_ptr>(ret);
+            }
 
-          previous = &thrust::raw_reference_cast(*ptr).next_cached;
-          ptr      = *previous;
+            previous = &thrust::raw_reference_cast(*ptr).next_cached;
+            ptr      = *previous;
+          }
         }
       }
 
@@ -455,7 +473,8 @@ public:
 
       if (m_options.cache_oversized)
       {
-        desc.next_cached = m_cached_oversized;
+        std::size_t bin  = detail::log2(desc.size);
+        desc.next_cached = m_cached_oversized[bin];
 
         if (desc.size != n)
         {
@@ -477,8 +496,8 @@ public:
           }
         }
 
-        m_cached_oversized = block;
-        *block             = desc;
+        m_cached_oversized[bin] = block;
+        *block                  = desc;
 
         return;
       }
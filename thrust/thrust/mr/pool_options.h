@@ -98,6 +98,12 @@ struct pool_options
    */
   std::size_t cached_alignment_cutoff_factor;
 
+  /*! The number of bytes of free blocks of each pool size that the synchronized pool resources cache for every thread,
+   *      to avoid taking their lock on each allocation. Pool sizes of which fewer than two blocks fit in this many
+   *      bytes are not cached. Zero disables the per-thread caches. Ignored by unsynchronized pool resources.
+   */
+  std::size_t thread_cache_bytes;
+
   /*! Checks if the options are self-consistent.
    *
    *  /returns true if the options are self-consitent, false otherwise.
@@ -29,10 +29,9 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/mr/detail/thread_cache.h>
 #include <thrust/mr/pool.h>
 
-#include <mutex>
-
 THRUST_NAMESPACE_BEGIN
 namespace mr
 {
@@ -43,6 +42,8 @@ namespace mr
  */
 
 /*! A mutex-synchronized version of \p unsynchronized_pool_resource. Uses \p std::mutex, and therefore requires C++11.
+ *      Each thread keeps up to \p pool_options::thread_cache_bytes of free blocks of every pool size to itself, and
+ *      only takes the mutex to exchange them with the pool in batches.
  *
  *  \tparam Upstream the type of memory resources that will be used for allocating memory
  */
@@ -50,7 +51,6 @@ template <typename Upstream>
 struct synchronized_pool_resource : public memory_resource<typename Upstream::pointer>
 {
   using unsync_pool = unsynchronized_pool_resource<Upstream>;
-  using lock_t      = std::lock_guard<std::mutex>;
 
   using void_ptr = typename Upstream::pointer;
 
@@ -70,7 +70,7 @@ public:
    *  \param options pool options to use
    */
   synchronized_pool_resource(Upstream* upstream, pool_options options = get_default_options())
-      : upstream_pool(upstream, options)
+      : upstream_pool(options, upstream)
   {}
 
   /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
@@ -78,33 +78,29 @@ public:
    *  \param options pool options to use
    */
   synchronized_pool_resource(pool_options options = get_default_options())
-      : upstream_pool(get_global_resource<Upstream>(), options)
+      : upstream_pool(options, get_global_resource<Upstream>())
   {}
 
   /*! Releases all held memory to upstream.
    */
   void release()
   {
-    lock_t lock(mtx);
     upstream_pool.release();
   }
 
   _CCCL_NODISCARD virtual void_ptr
   do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
   {
-    lock_t lock(mtx);
     return upstream_pool.do_allocate(bytes, alignment);
   }
 
   virtual void do_deallocate(void_ptr p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
   {
-    lock_t lock(mtx);
     upstream_pool.do_deallocate(p, n, alignment);
   }
 
 private:
-  std::mutex mtx;
-  unsync_pool upstream_pool;
+  detail::thread_cached_pool<unsync_pool, void_ptr> upstream_pool;
 };
 
 /*! \} // memory_resources
@@ -0,0 +1,111 @@
+/*
+ *  Copyright 2025 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+namespace detail
+{
+
+// the w low bits of a UIntType
+template <typename UIntType, size_t w>
+struct counter_based_engine_wordmask
+{
+  static const UIntType value = static_cast<UIntType>(~UIntType(0)) >> (sizeof(UIntType) * 8 - w);
+}; // end counter_based_engine_wordmask
+
+// The counter of a counter-based engine is a single (n * w)-bit integer,
+// stored as n w-bit words with the least significant word first. The engine
+// buffers the n words produced from the counter's previous value, and i is the
+// index of the word it returned last.
+template <typename UIntType, size_t w, size_t n>
+struct counter_based_engine_counter
+{
+  static const UIntType wordmask = counter_based_engine_wordmask<UIntType, w>::value;
+
+  _CCCL_HOST_DEVICE static void increment(UIntType (&x)[n], unsigned long long z)
+  {
+    for (size_t j = 0; j < n && z > 0; ++j)
+    {
+      const UIntType digit = static_cast<UIntType>(z & wordmask);
+      const UIntType sum   = static_cast<UIntType>((x[j] + digit) & wordmask);
+
+      // shift twice, as w may be the width of z
+      z = (z >> (w - 1)) >> 1;
+      if (sum < digit)
+      {
+        // carry into the next word
+        ++z;
+      }
+
+      x[j] = sum;
+    }
+  }
+
+  _CCCL_HOST_DEVICE static void decrement(UIntType (&x)[n])
+  {
+    for (size_t j = 0; j < n; ++j)
+    {
+      const bool borrow = (x[j] == 0);
+      x[j]              = static_cast<UIntType>((x[j] - 1) & wordmask);
+      if (!borrow)
+      {
+        break;
+      }
+    }
+  }
+
+  // advances the counter x and the index i past z words; returns true if the
+  // buffered words have to be regenerated from the updated counter, which is
+  // then incremented by one
+  _CCCL_HOST_DEVICE static bool discard(UIntType (&x)[n], unsigned int& i, unsigned long long z)
+  {
+    const unsigned long long buffered = n - 1 - i;
+    if (z <= buffered)
+    {
+      i += static_cast<unsigned int>(z);
+      return false;
+    }
+
+    z -= buffered + 1;
+    increment(x, z / n);
+    i = static_cast<unsigned int>(z % n);
+    return true;
+  }
+}; // end counter_based_engine_counter
+
+} // namespace detail
+
+} // namespace random
+
+THRUST_NAMESPACE_END
@@ -85,11 +85,38 @@ discard_block_engine<Engine, p, r>::operator()(void)
 template <typename Engine, size_t p, size_t r>
 _CCCL_HOST_DEVICE void discard_block_engine<Engine, p, r>::discard(unsigned long long z)
 {
-  // XXX this should be accelerated
-  for (; z > 0; --z)
+  if (z == 0)
   {
-    this->operator()();
-  } // end for
+    return;
+  }
+
+  // count the values the base engine has to produce for the next z values of this engine,
+  // so that the base engine may skip them all at once
+  unsigned long long skip = 0;
+
+  if (m_n >= used_block)
+  {
+    skip += block_size - m_n;
+    m_n = 0;
+  }
+
+  const unsigned long long available = used_block - m_n;
+  if (z <= available)
+  {
+    skip += z;
+    m_n += static_cast<unsigned int>(z);
+  }
+  else
+  {
+    // each further block discards its last p - r values
+    z -= available;
+    const unsigned long long blocks = (z + used_block - 1) / used_block;
+
+    skip += available + blocks * (block_size - used_block) + z;
+    m_n = static_cast<unsigned int>(z - (blocks - 1) * used_block);
+  }
+
+  m_e.discard(skip);
 }
 
 template <typename Engine, size_t p, size_t r>
@@ -0,0 +1,204 @@
+/*
+ *  Copyright 2025 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/random/generate_random.h>
+#include <thrust/system/detail/generic/select_system.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+namespace detail
+{
+
+// the number of results generated sequentially by one copy of the engine
+// it is a multiple of every generate_random_traits::results_per_block
+const unsigned long long generate_random_tile_size = 1ull << 14;
+
+// a distribution which returns the values of the engine unchanged
+template <typename UniformRandomNumberGenerator>
+struct engine_values
+{
+  using result_type = typename UniformRandomNumberGenerator::result_type;
+
+  _CCCL_HOST_DEVICE void reset() {}
+
+  _CCCL_HOST_DEVICE result_type operator()(UniformRandomNumberGenerator& urng)
+  {
+    return urng();
+  }
+
+  template <typename OutputIterator, typename Size>
+  _CCCL_HOST_DEVICE OutputIterator generate_n(UniformRandomNumberGenerator& urng, OutputIterator result, Size n)
+  {
+    for (; n > 0; --n, ++result)
+    {
+      *result = urng();
+    }
+
+    return result;
+  }
+};
+
+// the number of draws of the engine which precede the result with the given index
+template <typename Distribution>
+_CCCL_HOST_DEVICE unsigned long long generate_random_draws(unsigned long long index)
+{
+  using traits = generate_random_traits<Distribution>;
+
+  return ((index + traits::results_per_block - 1) / traits::results_per_block) * traits::draws_per_block;
+}
+
+template <typename RandomAccessIterator, typename Size, typename UniformRandomNumberGenerator, typename Distribution>
+struct generate_random_tile_functor
+{
+  RandomAccessIterator result;
+  Size n;
+  UniformRandomNumberGenerator urng;
+  Distribution dist;
+
+  _CCCL_HOST_DEVICE void operator()(Size tile)
+  {
+    const Size first     = static_cast<Size>(tile * static_cast<Size>(generate_random_tile_size));
+    const Size remaining = n - first;
+    const Size count = remaining < static_cast<Size>(generate_random_tile_size)
+                       ? remaining
+                       : static_cast<Size>(generate_random_tile_size);
+
+    // each tile begins at a block boundary, with a freshly reset distribution
+    UniformRandomNumberGenerator tile_urng = urng;
+    tile_urng.discard(generate_random_draws<Distribution>(first));
+
+    Distribution tile_dist = dist;
+    tile_dist.generate_n(tile_urng, result + first, count);
+  }
+};
+
+} // namespace detail
+
+template <typename UniformRandomNumberGenerator>
+struct generate_random_traits<detail::engine_values<UniformRandomNumberGenerator>>
+{
+  static const unsigned long long results_per_block = 1;
+  static const unsigned long long draws_per_block   = 1;
+};
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename Size,
+          typename UniformRandomNumberGenerator,
+          typename Distribution>
+_CCCL_HOST_DEVICE RandomAccessIterator generate_random_n(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator result,
+  Size n,
+  UniformRandomNumberGenerator& urng,
+  Distribution& dist)
+{
+  dist.reset();
+
+  if (n <= 0)
+  {
+    return result;
+  }
+
+  const Size tile_size  = static_cast<Size>(detail::generate_random_tile_size);
+  const Size tile_count = (n + tile_size - 1) / tile_size;
+
+  thrust::for_each_n(
+    exec,
+    thrust::counting_iterator<Size>(0),
+    tile_count,
+    detail::generate_random_tile_functor<RandomAccessIterator, Size, UniformRandomNumberGenerator, Distribution>{
+      result, n, urng, dist});
+
+  // advance past the values consumed, as n calls of dist(urng) would have
+  urng.discard(detail::generate_random_draws<Distribution>(static_cast<unsigned long long>(n)));
+
+  return result + n;
+} // end generate_random_n()
+
+template <typename RandomAccessIterator, typename Size, typename UniformRandomNumberGenerator, typename Distribution>
+RandomAccessIterator
+generate_random_n(RandomAccessIterator result, Size n, UniformRandomNumberGenerator& urng, Distribution& dist)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System = typename thrust::iterator_system<RandomAccessIterator>::type;
+
+  System system;
+
+  return thrust::random::generate_random_n(select_system(system), result, n, urng, dist);
+} // end generate_random_n()
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename Size, typename UniformRandomNumberGenerator>
+_CCCL_HOST_DEVICE RandomAccessIterator generate_random_n(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator result,
+  Size n,
+  UniformRandomNumberGenerator& urng)
+{
+  detail::engine_values<UniformRandomNumberGenerator> dist;
+  return thrust::random::generate_random_n(exec, result, n, urng, dist);
+} // end generate_random_n()
+
+template <typename RandomAccessIterator, typename Size, typename UniformRandomNumberGenerator>
+RandomAccessIterator generate_random_n(RandomAccessIterator result, Size n, UniformRandomNumberGenerator& urng)
+{
+  detail::engine_values<UniformRandomNumberGenerator> dist;
+  return thrust::random::generate_random_n(result, n, urng, dist);
+} // end generate_random_n()
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename UniformRandomNumberGenerator,
+          typename Distribution>
+_CCCL_HOST_DEVICE void generate_random(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  UniformRandomNumberGenerator& urng,
+  Distribution& dist)
+{
+  thrust::random::generate_random_n(exec, first, last - first, urng, dist);
+} // end generate_random()
+
+template <typename RandomAccessIterator, typename UniformRandomNumberGenerator, typename Distribution>
+void generate_random(
+  RandomAccessIterator first, RandomAccessIterator last, UniformRandomNumberGenerator& urng, Distribution& dist)
+{
+  thrust::random::generate_random_n(first, last - first, urng, dist);
+} // end generate_random()
+
+} // namespace random
+
+THRUST_NAMESPACE_END
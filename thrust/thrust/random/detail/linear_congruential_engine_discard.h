@@ -38,67 +38,90 @@ namespace random
 namespace detail
 {
 
-template <typename UIntType, UIntType a, unsigned long long c, UIntType m>
-struct linear_congruential_engine_discard_implementation
+// arithmetic modulo m on operands which are already reduced modulo m
+template <typename UIntType, UIntType m, bool = (m == 0)>
+struct linear_congruential_engine_arithmetic
 {
-  _CCCL_HOST_DEVICE static void discard(UIntType& state, unsigned long long z)
+  _CCCL_HOST_DEVICE static UIntType add(UIntType x, UIntType y)
   {
-    for (; z > 0; --z)
-    {
-      state = detail::mod<UIntType, a, c, m>(state);
-    }
+    // compare against the distance to m, as x + y may overflow
+    const UIntType d = m - x;
+    return (y >= d) ? UIntType(y - d) : UIntType(x + y);
   }
-}; // end linear_congruential_engine_discard
 
-// specialize for small integers and c == 0
-// XXX figure out a robust implemenation of this for any unsigned integer type later
-template <std::uint32_t a, std::uint32_t m>
-struct linear_congruential_engine_discard_implementation<std::uint32_t, a, 0, m>
-{
-  _CCCL_HOST_DEVICE static void discard(std::uint32_t& state, unsigned long long z)
+  _CCCL_HOST_DEVICE static UIntType multiply(UIntType x, UIntType y)
   {
-    const std::uint32_t modulus = m;
-
-    // XXX we need to use unsigned long long here or we will encounter overflow in the
-    //     multiplies below
-    //     figure out a robust implementation of this later
-    unsigned long long multiplier      = a;
-    unsigned long long multiplier_to_z = 1;
+    if (static_cast<unsigned long long>(m - 1) <= 0xffffffffull)
+    {
+      // the product fits into 64 bits
+      return static_cast<UIntType>((static_cast<unsigned long long>(x) * y) % m);
+    }
 
-    // see http://en.wikipedia.org/wiki/Modular_exponentiation
-    while (z > 0)
+    // see http://en.wikipedia.org/wiki/Modular_arithmetic, double and add
+    UIntType result = 0;
+    for (; y > 0; y >>= 1)
     {
-      if (z & 1)
+      if (y & 1)
       {
-        // multiply in this bit's contribution while using modulus to keep result small
-        multiplier_to_z = (multiplier_to_z * multiplier) % modulus;
+        result = add(result, x);
       }
-
-      // move to the next bit of the exponent, square (and mod) the base accordingly
-      z >>= 1;
-      multiplier = (multiplier * multiplier) % modulus;
+      x = add(x, x);
     }
 
-    state = static_cast<std::uint32_t>((multiplier_to_z * state) % modulus);
+    return result;
   }
-}; // end linear_congruential_engine_discard
+}; // end linear_congruential_engine_arithmetic
+
+// m == 0 denotes the modulus 2^N of an N-bit UIntType, for which we rely on machine overflow handling
+template <typename UIntType, UIntType m>
+struct linear_congruential_engine_arithmetic<UIntType, m, true>
+{
+  _CCCL_HOST_DEVICE static UIntType add(UIntType x, UIntType y)
+  {
+    return static_cast<UIntType>(x + y);
+  }
+
+  _CCCL_HOST_DEVICE static UIntType multiply(UIntType x, UIntType y)
+  {
+    return static_cast<UIntType>(static_cast<unsigned long long>(x) * y);
+  }
+}; // end linear_congruential_engine_arithmetic
 
 struct linear_congruential_engine_discard
 {
   template <typename LinearCongruentialEngine>
   _CCCL_HOST_DEVICE static void discard(LinearCongruentialEngine& lcg, unsigned long long z)
   {
-    using result_type   = typename LinearCongruentialEngine::result_type;
-    const result_type c = LinearCongruentialEngine::increment;
-    const result_type a = LinearCongruentialEngine::multiplier;
+    using result_type = typename LinearCongruentialEngine::result_type;
+    using arithmetic  = linear_congruential_engine_arithmetic<result_type, LinearCongruentialEngine::modulus>;
+
     const result_type m = LinearCongruentialEngine::modulus;
 
-    // XXX WAR unused variable warnings
-    (void) c;
-    (void) a;
-    (void) m;
+    // a step of the engine is the affine map x -> a * x + c, so z steps are the map's
+    // z-th power, which we compute by repeated squaring in O(log z)
+    // see http://en.wikipedia.org/wiki/Modular_exponentiation
+    result_type a = detail::mod<result_type, 1, 0, m>(LinearCongruentialEngine::multiplier);
+    result_type c = detail::mod<result_type, 1, 0, m>(LinearCongruentialEngine::increment);
+
+    result_type a_to_z = detail::mod<result_type, 1, 0, m>(1);
+    result_type c_to_z = 0;
+
+    while (z > 0)
+    {
+      if (z & 1)
+      {
+        // compose this bit's contribution with the result so far
+        a_to_z = arithmetic::multiply(a, a_to_z);
+        c_to_z = arithmetic::add(arithmetic::multiply(a, c_to_z), c);
+      }
+
+      // move to the next bit of the exponent, square the map accordingly
+      z >>= 1;
+      c = arithmetic::add(arithmetic::multiply(a, c), c);
+      a = arithmetic::multiply(a, a);
+    }
 
-    linear_congruential_engine_discard_implementation<result_type, a, c, m>::discard(lcg.m_x, z);
+    lcg.m_x = arithmetic::add(arithmetic::multiply(a_to_z, lcg.m_x), c_to_z);
   }
 }; // end linear_congruential_engine_discard
 
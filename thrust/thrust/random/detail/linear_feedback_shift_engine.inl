@@ -45,23 +45,88 @@ _CCCL_HOST_DEVICE void linear_feedback_shift_engine<UIntType, w, k, q, s>::seed(
   m_value = value;
 } // end linear_feedback_shift_engine::seed()
 
+namespace detail
+{
+
+// multiplies a matrix over GF(2), stored as its columns, by the vector of the bits of x
+template <typename UIntType, size_t n>
+_CCCL_HOST_DEVICE UIntType gf2_matrix_multiply(const UIntType (&columns)[n], UIntType x)
+{
+  UIntType result = 0;
+  for (size_t j = 0; j < n && x != 0; ++j, x >>= 1)
+  {
+    if (x & 1)
+    {
+      result ^= columns[j];
+    }
+  }
+  return result;
+} // end gf2_matrix_multiply()
+
+} // namespace detail
+
 template <typename UIntType, size_t w, size_t k, size_t q, size_t s>
 _CCCL_HOST_DEVICE typename linear_feedback_shift_engine<UIntType, w, k, q, s>::result_type
-linear_feedback_shift_engine<UIntType, w, k, q, s>::operator()(void)
+linear_feedback_shift_engine<UIntType, w, k, q, s>::transition(result_type value)
 {
-  const UIntType b    = (((m_value << q) ^ m_value) & wordmask) >> (k - s);
+  const UIntType b    = (((value << q) ^ value) & wordmask) >> (k - s);
   const UIntType mask = ((~static_cast<UIntType>(0)) << (w - k)) & wordmask;
-  m_value             = ((m_value & mask) << s) ^ b;
+  return ((value & mask) << s) ^ b;
+} // end linear_feedback_shift_engine::transition()
+
+template <typename UIntType, size_t w, size_t k, size_t q, size_t s>
+_CCCL_HOST_DEVICE typename linear_feedback_shift_engine<UIntType, w, k, q, s>::result_type
+linear_feedback_shift_engine<UIntType, w, k, q, s>::operator()(void)
+{
+  m_value = transition(m_value);
   return m_value;
 } // end linear_feedback_shift_engine::operator()()
 
 template <typename UIntType, size_t w, size_t k, size_t q, size_t s>
 _CCCL_HOST_DEVICE void linear_feedback_shift_engine<UIntType, w, k, q, s>::discard(unsigned long long z)
 {
-  for (; z > 0; --z)
+  const size_t bits = sizeof(UIntType) * 8;
+
+  // the transition is linear over GF(2), so z steps are the z-th power of its
+  // bits x bits matrix, which we compute by repeated squaring once z outweighs
+  // the log(z) squarings of bits^2 operations each
+  if (z < 64 * bits * bits)
+  {
+    for (; z > 0; --z)
+    {
+      m_value = transition(m_value);
+    } // end for
+    return;
+  }
+
+  // the columns of the matrix are the images of the unit vectors
+  UIntType columns[bits];
+  for (size_t j = 0; j < bits; ++j)
+  {
+    columns[j] = transition(static_cast<UIntType>(UIntType(1) << j));
+  }
+
+  while (z > 0)
   {
-    this->operator()();
-  } // end for
+    if (z & 1)
+    {
+      m_value = detail::gf2_matrix_multiply(columns, m_value);
+    }
+
+    z >>= 1;
+    if (z > 0)
+    {
+      UIntType squared[bits];
+      for (size_t j = 0; j < bits; ++j)
+      {
+        squared[j] = detail::gf2_matrix_multiply(columns, columns[j]);
+      }
+      for (size_t j = 0; j < bits; ++j)
+      {
+        columns[j] = squared[j];
+      }
+    }
+  }
 } // end linear_feedback_shift_engine::discard()
 
 template <typename UIntType, size_t w, size_t k, size_t q, size_t s>
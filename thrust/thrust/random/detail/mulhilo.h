@@ -0,0 +1,87 @@
+/*
+ *  Copyright 2025 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cstdint>
+
+#include <nv/target>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+namespace detail
+{
+
+// computes the high and low halves of the double-width product of two
+// w-bit words, which are held in a UIntType
+template <typename UIntType, size_t w, bool = (w <= 32)>
+struct mulhilo
+{
+  _CCCL_HOST_DEVICE static void multiply(UIntType a, UIntType b, UIntType& hi, UIntType& lo)
+  {
+    const std::uint64_t product = static_cast<std::uint64_t>(a) * static_cast<std::uint64_t>(b);
+    hi                          = static_cast<UIntType>(product >> w);
+    lo                          = static_cast<UIntType>(product & ((std::uint64_t(1) << w) - 1));
+  }
+}; // end mulhilo
+
+template <typename UIntType>
+struct mulhilo<UIntType, 64, false>
+{
+  _CCCL_HOST_DEVICE static void multiply(UIntType a, UIntType b, UIntType& hi, UIntType& lo)
+  {
+    const std::uint64_t x = a;
+    const std::uint64_t y = b;
+
+    lo = static_cast<UIntType>(x * y);
+
+    // clang-format off
+    NV_IF_TARGET(NV_IS_DEVICE,
+      (hi = static_cast<UIntType>(__umul64hi(x, y));),
+      (// schoolbook multiplication of the 32-bit halves
+       const std::uint64_t mask = 0xffffffffu;
+       const std::uint64_t x_lo = x & mask, x_hi = x >> 32;
+       const std::uint64_t y_lo = y & mask, y_hi = y >> 32;
+
+       const std::uint64_t lo_lo = x_lo * y_lo;
+       const std::uint64_t hi_lo = x_hi * y_lo;
+       const std::uint64_t lo_hi = x_lo * y_hi;
+       const std::uint64_t hi_hi = x_hi * y_hi;
+
+       const std::uint64_t middle = (lo_lo >> 32) + (hi_lo & mask) + lo_hi;
+       hi = static_cast<UIntType>(hi_hi + (hi_lo >> 32) + (middle >> 32));));
+    // clang-format on
+  }
+}; // end mulhilo
+
+} // namespace detail
+
+} // namespace random
+
+THRUST_NAMESPACE_END
@@ -73,6 +73,14 @@ normal_distribution<RealType>::operator()(UniformRandomNumberGenerator& urng, co
   return super_t::sample(urng, parm.first, parm.second);
 } // end normal_distribution::operator()()
 
+template <typename RealType>
+template <typename UniformRandomNumberGenerator, typename OutputIterator, typename Size>
+_CCCL_HOST_DEVICE OutputIterator
+normal_distribution<RealType>::generate_n(UniformRandomNumberGenerator& urng, OutputIterator result, Size n)
+{
+  return super_t::sample_n(urng, result, n, m_param.first, m_param.second);
+} // end normal_distribution::generate_n()
+
 template <typename RealType>
 _CCCL_HOST_DEVICE typename normal_distribution<RealType>::param_type normal_distribution<RealType>::param() const
 {
@@ -79,6 +79,18 @@ protected:
     return mean + stddev * S3 * erfcinv(2 * p);
   }
 
+  template <typename UniformRandomNumberGenerator, typename OutputIterator, typename Size>
+  _CCCL_HOST_DEVICE OutputIterator
+  sample_n(UniformRandomNumberGenerator& urng, OutputIterator result, Size n, const RealType mean, const RealType stddev)
+  {
+    for (; n > 0; --n, ++result)
+    {
+      *result = sample(urng, mean, stddev);
+    }
+
+    return result;
+  }
+
   // no-op
   _CCCL_HOST_DEVICE void reset() {}
 };
@@ -140,6 +152,73 @@ protected:
     return mean + stddev * result;
   }
 
+  // note that we promise to call this member function with the same mean and stddev
+  template <typename UniformRandomNumberGenerator, typename OutputIterator, typename Size>
+  _CCCL_HOST_DEVICE OutputIterator
+  sample_n(UniformRandomNumberGenerator& urng, OutputIterator result, Size n, const RealType mean, const RealType stddev)
+  {
+    using std::cos;
+    using std::log;
+    using std::sin;
+    using std::sqrt;
+
+    // finish the pair begun by an earlier call
+    if (n > 0 && m_valid)
+    {
+      *result = sample(urng, mean, stddev);
+      ++result;
+      --n;
+    }
+
+    // transform whole pairs in blocks, so that the loop over the transcendental
+    // functions has neither calls to urng nor branches in it
+    const int block_size = 32;
+    RealType first[block_size], second[block_size];
+
+    uniform_real_distribution<RealType> u01;
+    const RealType pi = RealType(3.14159265358979323846);
+
+    while (n >= 2)
+    {
+      const int count = (n / 2 < Size(block_size)) ? static_cast<int>(n / 2) : block_size;
+
+      for (int i = 0; i < count; ++i)
+      {
+        first[i]  = u01(urng);
+        second[i] = u01(urng);
+      }
+
+      // the same values as two calls of sample
+      for (int i = 0; i < count; ++i)
+      {
+        const RealType rho = sqrt(-RealType(2) * log(RealType(1) - second[i]));
+        const RealType r1  = first[i];
+
+        first[i]  = mean + stddev * (rho * cos(RealType(2) * pi * r1));
+        second[i] = mean + stddev * (rho * sin(RealType(2) * pi * r1));
+      }
+
+      for (int i = 0; i < count; ++i)
+      {
+        *result = first[i];
+        ++result;
+        *result = second[i];
+        ++result;
+      }
+
+      n -= 2 * count;
+    }
+
+    // begin a pair for the last value
+    if (n > 0)
+    {
+      *result = sample(urng, mean, stddev);
+      ++result;
+    }
+
+    return result;
+  }
+
 private:
   RealType m_r1, m_r2, m_cached_rho;
   bool m_valid;
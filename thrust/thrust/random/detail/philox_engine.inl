@@ -0,0 +1,260 @@
+/*
+ *  Copyright 2025 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/random/detail/counter_based_engine.h>
+#include <thrust/random/detail/mulhilo.h>
+#include <thrust/random/detail/random_core_access.h>
+#include <thrust/random/philox_engine.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE philox_engine<UIntType, w, n, r, consts...>::philox_engine(result_type value)
+{
+  seed(value);
+} // end philox_engine::philox_engine()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE void philox_engine<UIntType, w, n, r, consts...>::seed(result_type value)
+{
+  for (size_t j = 0; j < word_count; ++j)
+  {
+    m_x[j] = 0;
+    m_y[j] = 0;
+  } // end for j
+
+  m_k[0] = value & wordmask;
+  for (size_t k = 1; k < word_count / 2; ++k)
+  {
+    m_k[k] = 0;
+  } // end for k
+
+  m_i = word_count - 1;
+} // end philox_engine::seed()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE void
+philox_engine<UIntType, w, n, r, consts...>::set_counter(const result_type (&counter)[word_count])
+{
+  for (size_t j = 0; j < word_count; ++j)
+  {
+    m_x[j] = counter[word_count - 1 - j] & wordmask;
+  } // end for j
+
+  m_i = word_count - 1;
+} // end philox_engine::set_counter()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE void philox_engine<UIntType, w, n, r, consts...>::generate_block()
+{
+  result_type x[word_count];
+  result_type key[word_count / 2];
+
+  for (size_t j = 0; j < word_count; ++j)
+  {
+    x[j] = m_x[j];
+  }
+  for (size_t k = 0; k < word_count / 2; ++k)
+  {
+    key[k] = m_k[k];
+  }
+
+  for (size_t q = 0; q < round_count; ++q)
+  {
+    // the four word variant permutes the words as (2, 1, 0, 3) before each round
+    result_type v[word_count];
+    for (size_t j = 0; j < word_count; ++j)
+    {
+      v[j] = x[(word_count == 4 && j % 2 == 0) ? 2 - j : j];
+    }
+
+    for (size_t k = 0; k < word_count / 2; ++k)
+    {
+      result_type hi, lo;
+      detail::mulhilo<result_type, w>::multiply(v[2 * k], multiplier(k), hi, lo);
+
+      x[2 * k]     = hi ^ key[k] ^ v[2 * k + 1];
+      x[2 * k + 1] = lo;
+    }
+
+    for (size_t k = 0; k < word_count / 2; ++k)
+    {
+      key[k] = (key[k] + round_constant(k)) & wordmask;
+    }
+  } // end for q
+
+  for (size_t j = 0; j < word_count; ++j)
+  {
+    m_y[j] = x[j];
+  }
+} // end philox_engine::generate_block()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE typename philox_engine<UIntType, w, n, r, consts...>::result_type
+philox_engine<UIntType, w, n, r, consts...>::operator()(void)
+{
+  ++m_i;
+  if (m_i == word_count)
+  {
+    generate_block();
+    detail::counter_based_engine_counter<UIntType, w, n>::increment(m_x, 1);
+    m_i = 0;
+  }
+
+  return m_y[m_i];
+} // end philox_engine::operator()()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE void philox_engine<UIntType, w, n, r, consts...>::discard(unsigned long long z)
+{
+  if (detail::counter_based_engine_counter<UIntType, w, n>::discard(m_x, m_i, z))
+  {
+    generate_block();
+    detail::counter_based_engine_counter<UIntType, w, n>::increment(m_x, 1);
+  }
+} // end philox_engine::discard()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+template <typename CharT, typename Traits>
+std::basic_ostream<CharT, Traits>&
+philox_engine<UIntType, w, n, r, consts...>::stream_out(std::basic_ostream<CharT, Traits>& os) const
+{
+  using ostream_type = std::basic_ostream<CharT, Traits>;
+  using ios_base     = typename ostream_type::ios_base;
+
+  const typename ios_base::fmtflags flags = os.flags();
+  const CharT fill                        = os.fill();
+  const CharT space                       = os.widen(' ');
+  os.flags(ios_base::dec | ios_base::fixed | ios_base::left);
+  os.fill(space);
+
+  // the buffered words are a function of the key and the counter
+  for (size_t k = 0; k < word_count / 2; ++k)
+  {
+    os << m_k[k] << space;
+  }
+  for (size_t j = 0; j < word_count; ++j)
+  {
+    os << m_x[j] << space;
+  }
+  os << m_i;
+
+  os.flags(flags);
+  os.fill(fill);
+  return os;
+}
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+template <typename CharT, typename Traits>
+std::basic_istream<CharT, Traits>&
+philox_engine<UIntType, w, n, r, consts...>::stream_in(std::basic_istream<CharT, Traits>& is)
+{
+  using istream_type = std::basic_istream<CharT, Traits>;
+  using ios_base     = typename istream_type::ios_base;
+
+  const typename ios_base::fmtflags flags = is.flags();
+  is.flags(ios_base::dec | ios_base::skipws);
+
+  for (size_t k = 0; k < word_count / 2; ++k)
+  {
+    is >> m_k[k];
+  }
+  for (size_t j = 0; j < word_count; ++j)
+  {
+    is >> m_x[j];
+  }
+  is >> m_i;
+
+  // regenerate the buffered words from the previous counter
+  if (m_i != word_count - 1)
+  {
+    detail::counter_based_engine_counter<UIntType, w, n>::decrement(m_x);
+    generate_block();
+    detail::counter_based_engine_counter<UIntType, w, n>::increment(m_x, 1);
+  }
+
+  is.flags(flags);
+  return is;
+}
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE bool philox_engine<UIntType, w, n, r, consts...>::equal(const philox_engine& rhs) const
+{
+  for (size_t k = 0; k < word_count / 2; ++k)
+  {
+    if (m_k[k] != rhs.m_k[k])
+    {
+      return false;
+    }
+  }
+  for (size_t j = 0; j < word_count; ++j)
+  {
+    if (m_x[j] != rhs.m_x[j])
+    {
+      return false;
+    }
+  }
+
+  return m_i == rhs.m_i;
+}
+
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_>
+_CCCL_HOST_DEVICE bool operator==(const philox_engine<UIntType_, w_, n_, r_, consts_...>& lhs,
+                                  const philox_engine<UIntType_, w_, n_, r_, consts_...>& rhs)
+{
+  return thrust::random::detail::random_core_access::equal(lhs, rhs);
+}
+
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_>
+_CCCL_HOST_DEVICE bool operator!=(const philox_engine<UIntType_, w_, n_, r_, consts_...>& lhs,
+                                  const philox_engine<UIntType_, w_, n_, r_, consts_...>& rhs)
+{
+  return !(lhs == rhs);
+}
+
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_, typename CharT, typename Traits>
+std::basic_ostream<CharT, Traits>&
+operator<<(std::basic_ostream<CharT, Traits>& os, const philox_engine<UIntType_, w_, n_, r_, consts_...>& e)
+{
+  return thrust::random::detail::random_core_access::stream_out(os, e);
+}
+
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_, typename CharT, typename Traits>
+std::basic_istream<CharT, Traits>&
+operator>>(std::basic_istream<CharT, Traits>& is, philox_engine<UIntType_, w_, n_, r_, consts_...>& e)
+{
+  return thrust::random::detail::random_core_access::stream_in(is, e);
+}
+
+} // namespace random
+
+THRUST_NAMESPACE_END
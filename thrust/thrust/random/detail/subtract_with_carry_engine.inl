@@ -28,6 +28,7 @@
 
 #include <thrust/random/detail/mod.h>
 #include <thrust/random/detail/random_core_access.h>
+#include <thrust/random/detail/subtract_with_carry_engine_discard.h>
 #include <thrust/random/linear_congruential_engine.h>
 #include <thrust/random/subtract_with_carry_engine.h>
 
@@ -94,10 +95,25 @@ subtract_with_carry_engine<UIntType, w, s, r>::operator()(void)
 template <typename UIntType, size_t w, size_t s, size_t r>
 _CCCL_HOST_DEVICE void subtract_with_carry_engine<UIntType, w, s, r>::discard(unsigned long long z)
 {
-  for (; z > 0; --z)
+  // below this many steps, stepping is cheaper than the modular exponentiation
+  const unsigned long long jump_threshold = 1 << 14;
+
+  if (z < jump_threshold + long_lag)
+  {
+    for (; z > 0; --z)
+    {
+      this->operator()();
+    } // end for
+    return;
+  }
+
+  // the jump requires a state which the generator produced itself
+  for (size_t i = 0; i < long_lag; ++i)
   {
     this->operator()();
   } // end for
+
+  detail::subtract_with_carry_engine_discard<UIntType, w, s, r>::discard(m_x, m_k, m_carry, z - long_lag);
 } // end subtract_with_carry_engine::discard()
 
 template <typename UIntType, size_t w, size_t s, size_t r>
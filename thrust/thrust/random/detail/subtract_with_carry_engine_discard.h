@@ -0,0 +1,410 @@
+/*
+ *  Copyright 2025 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cstddef>
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+namespace detail
+{
+
+// Marsaglia & Zaman's subtract with carry generator with word size w, short lag s
+// and long lag r is a linear congruential generator in disguise: with b = 2^w and
+// the prime m = b^r - b^s + 1, the window x_{n-r}, ..., x_{n-1} and the carry c of
+// its state form the number
+//
+//   d_n = sum_{i<r} x_{n-r+i} b^i - sum_{j<s} x_{n-s+j} b^j + c,
+//
+// for which d_{n+1} = b^-1 d_n mod m, and the window is recovered as the digits
+// x_{n-1-k} = floor(b d_{n-k} / m), d_{n-k-1} = b d_{n-k} - x_{n-1-k} m. So z steps
+// are a multiplication by b^-z mod m, which takes O(log z) multiplications of
+// (r * w)-bit integers. The digits are recovered correctly from any state which
+// the generator produced itself, which is any state after r steps.
+template <typename UIntType, size_t w, size_t s, size_t r>
+struct subtract_with_carry_engine_discard
+{
+  static const size_t bits       = w * r;
+  static const size_t short_bits = w * s;
+
+  // enough 32-bit limbs for the product of two numbers below 2^(bits + 1)
+  static const size_t limbs = 2 * (bits / 32 + 3);
+
+  using number = std::uint32_t[limbs];
+
+  _CCCL_HOST_DEVICE static void assign(number& x, std::uint64_t value)
+  {
+    x[0] = static_cast<std::uint32_t>(value);
+    x[1] = static_cast<std::uint32_t>(value >> 32);
+    for (size_t i = 2; i < limbs; ++i)
+    {
+      x[i] = 0;
+    }
+  }
+
+  _CCCL_HOST_DEVICE static void copy(number& x, const number& y)
+  {
+    for (size_t i = 0; i < limbs; ++i)
+    {
+      x[i] = y[i];
+    }
+  }
+
+  _CCCL_HOST_DEVICE static int compare(const number& x, const number& y)
+  {
+    for (size_t i = limbs; i-- > 0;)
+    {
+      if (x[i] != y[i])
+      {
+        return x[i] < y[i] ? -1 : 1;
+      }
+    }
+    return 0;
+  }
+
+  // x += y
+  _CCCL_HOST_DEVICE static void add(number& x, const number& y)
+  {
+    std::uint64_t carry = 0;
+    for (size_t i = 0; i < limbs; ++i)
+    {
+      carry += std::uint64_t(x[i]) + y[i];
+      x[i] = static_cast<std::uint32_t>(carry);
+      carry >>= 32;
+    }
+  }
+
+  // x -= y, for x >= y
+  _CCCL_HOST_DEVICE static void subtract(number& x, const number& y)
+  {
+    std::uint64_t borrow = 0;
+    for (size_t i = 0; i < limbs; ++i)
+    {
+      const std::uint64_t difference = std::uint64_t(x[i]) - y[i] - borrow;
+      x[i]                           = static_cast<std::uint32_t>(difference);
+      borrow                         = difference >> 63;
+    }
+  }
+
+  // x |= value << position, for value < 2^64
+  _CCCL_HOST_DEVICE static void insert(number& x, std::uint64_t value, size_t position)
+  {
+    const size_t limb   = position / 32;
+    const size_t offset = position % 32;
+
+    const std::uint64_t lo = value << offset;
+    const std::uint64_t hi = offset == 0 ? 0 : value >> (64 - offset);
+
+    x[limb] |= static_cast<std::uint32_t>(lo);
+    if (limb + 1 < limbs)
+    {
+      x[limb + 1] |= static_cast<std::uint32_t>(lo >> 32);
+    }
+    if (limb + 2 < limbs)
+    {
+      x[limb + 2] |= static_cast<std::uint32_t>(hi);
+    }
+  }
+
+  // the width bits of x at position, for width <= 64
+  _CCCL_HOST_DEVICE static std::uint64_t extract(const number& x, size_t position, size_t width)
+  {
+    const size_t limb   = position / 32;
+    const size_t offset = position % 32;
+
+    std::uint64_t lo = x[limb];
+    std::uint64_t hi = 0;
+    if (limb + 1 < limbs)
+    {
+      lo |= std::uint64_t(x[limb + 1]) << 32;
+    }
+    if (limb + 2 < limbs)
+    {
+      hi = x[limb + 2];
+    }
+
+    std::uint64_t result = lo >> offset;
+    if (offset != 0)
+    {
+      result |= hi << (64 - offset);
+    }
+
+    return width == 64 ? result : result & ((std::uint64_t(1) << width) - 1);
+  }
+
+  // x = y << shift
+  _CCCL_HOST_DEVICE static void shift_left(number& x, const number& y, size_t shift)
+  {
+    const size_t limb   = shift / 32;
+    const size_t offset = shift % 32;
+    for (size_t i = limbs; i-- > 0;)
+    {
+      std::uint32_t value = 0;
+      if (i >= limb)
+      {
+        value = y[i - limb] << offset;
+        if (offset != 0 && i > limb)
+        {
+          value |= y[i - limb - 1] >> (32 - offset);
+        }
+      }
+      x[i] = value;
+    }
+  }
+
+  // x = y >> shift
+  _CCCL_HOST_DEVICE static void shift_right(number& x, const number& y, size_t shift)
+  {
+    const size_t limb   = shift / 32;
+    const size_t offset = shift % 32;
+    for (size_t i = 0; i < limbs; ++i)
+    {
+      std::uint32_t value = 0;
+      if (i + limb < limbs)
+      {
+        value = y[i + limb] >> offset;
+        if (offset != 0 && i + limb + 1 < limbs)
+        {
+          value |= y[i + limb + 1] << (32 - offset);
+        }
+      }
+      x[i] = value;
+    }
+  }
+
+  // x = x mod 2^bits
+  _CCCL_HOST_DEVICE static void truncate(number& x)
+  {
+    const size_t limb   = bits / 32;
+    const size_t offset = bits % 32;
+    for (size_t i = limb; i < limbs; ++i)
+    {
+      x[i] = (i == limb) ? x[i] & ((std::uint32_t(1) << offset) - 1) : 0;
+    }
+  }
+
+  _CCCL_HOST_DEVICE static bool is_zero(const number& x)
+  {
+    for (size_t i = 0; i < limbs; ++i)
+    {
+      if (x[i] != 0)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  _CCCL_HOST_DEVICE static void modulus(number& m)
+  {
+    // m = 2^bits - 2^short_bits + 1
+    number power;
+    assign(m, 1);
+    assign(power, 0);
+    insert(m, 1, bits);
+    insert(power, 1, short_bits);
+    subtract(m, power);
+  }
+
+  // x = x mod m, using b^r = b^s - 1 mod m
+  _CCCL_HOST_DEVICE static void reduce(number& x, const number& m)
+  {
+    number high, shifted;
+    for (shift_right(high, x, bits); !is_zero(high); shift_right(high, x, bits))
+    {
+      // x = x mod 2^bits + high * 2^short_bits - high
+      truncate(x);
+      shift_left(shifted, high, short_bits);
+      add(x, shifted);
+      subtract(x, high);
+    }
+
+    while (compare(x, m) >= 0)
+    {
+      subtract(x, m);
+    }
+  }
+
+  // x = x * y mod m
+  _CCCL_HOST_DEVICE static void multiply(number& x, const number& y, const number& m)
+  {
+    number product;
+    assign(product, 0);
+
+    for (size_t i = 0; i < limbs; ++i)
+    {
+      if (x[i] == 0)
+      {
+        continue;
+      }
+
+      std::uint64_t carry = 0;
+      for (size_t j = 0; i + j < limbs; ++j)
+      {
+        carry += std::uint64_t(x[i]) * y[j] + product[i + j];
+        product[i + j] = static_cast<std::uint32_t>(carry);
+        carry >>= 32;
+      }
+    }
+
+    reduce(product, m);
+    copy(x, product);
+  }
+
+  // d = sum_{i<r} x_i b^i - sum_{j<s} x_{r-s+j} b^j, for the window x_0, ..., x_{r-1}
+  // which starts at the oldest value
+  template <typename Window>
+  _CCCL_HOST_DEVICE static void digits_to_number(number& d, const Window& window)
+  {
+    number newest;
+    assign(d, 0);
+    assign(newest, 0);
+    for (size_t i = 0; i < r; ++i)
+    {
+      insert(d, window(i), i * w);
+    }
+    for (size_t j = 0; j < s; ++j)
+    {
+      insert(newest, window(r - s + j), j * w);
+    }
+    subtract(d, newest);
+  }
+
+  struct state_window
+  {
+    const UIntType* x;
+    unsigned int k;
+
+    _CCCL_HOST_DEVICE std::uint64_t operator()(size_t i) const
+    {
+      return x[(k + i) % r];
+    }
+  };
+
+  struct number_window
+  {
+    const number* digits;
+
+    _CCCL_HOST_DEVICE std::uint64_t operator()(size_t i) const
+    {
+      return extract(*digits, i * w, w);
+    }
+  };
+
+  _CCCL_HOST_DEVICE static void discard(UIntType (&x)[r], unsigned int& k, int& carry, unsigned long long z)
+  {
+    number m, d, scratch;
+    modulus(m);
+
+    state_window window = {x, k};
+    digits_to_number(d, window);
+    assign(scratch, static_cast<std::uint64_t>(carry));
+    add(d, scratch);
+
+    // a window of maximal digits with a carry, d == m, is a fixed point, as is d == 0
+    if (compare(d, m) == 0)
+    {
+      return;
+    }
+
+    // b^-1 = m - (m - 1) / b = m - b^(r-1) + b^(s-1)
+    number inverse, factor;
+    copy(inverse, m);
+    assign(scratch, 0);
+    insert(scratch, 1, short_bits - w);
+    add(inverse, scratch);
+    assign(scratch, 0);
+    insert(scratch, 1, bits - w);
+    subtract(inverse, scratch);
+
+    // factor = b^-z mod m
+    // see http://en.wikipedia.org/wiki/Modular_exponentiation
+    assign(factor, 1);
+    while (z > 0)
+    {
+      if (z & 1)
+      {
+        multiply(factor, inverse, m);
+      }
+
+      z >>= 1;
+      if (z > 0)
+      {
+        multiply(inverse, inverse, m);
+      }
+    }
+
+    multiply(d, factor, m);
+
+    // recover the window, newest value first, into the digits of a number
+    number window_digits, remainder, quotient;
+    assign(window_digits, 0);
+    copy(remainder, d);
+    for (size_t i = r; i-- > 0;)
+    {
+      // b * remainder = q * 2^bits + low, and b * remainder - q * m = low + q * 2^short_bits - q
+      shift_left(scratch, remainder, w);
+      std::uint64_t q = extract(scratch, bits, w);
+      truncate(scratch);
+
+      assign(quotient, q);
+      shift_left(remainder, quotient, short_bits);
+      add(remainder, scratch);
+      subtract(remainder, quotient);
+
+      while (compare(remainder, m) >= 0)
+      {
+        subtract(remainder, m);
+        ++q;
+      }
+
+      insert(window_digits, q, i * w);
+    }
+
+    number_window digits = {&window_digits};
+    for (size_t i = 0; i < r; ++i)
+    {
+      x[i] = static_cast<UIntType>(digits(i));
+    }
+    k = 0;
+
+    // the carry is what d exceeds the number of the window by
+    digits_to_number(scratch, digits);
+    carry = compare(d, scratch) == 0 ? 0 : 1;
+  }
+}; // end subtract_with_carry_engine_discard
+
+} // namespace detail
+
+} // namespace random
+
+THRUST_NAMESPACE_END
@@ -0,0 +1,313 @@
+/*
+ *  Copyright 2025 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/random/detail/counter_based_engine.h>
+#include <thrust/random/detail/random_core_access.h>
+#include <thrust/random/threefry_engine.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+namespace detail
+{
+
+// the rotation distances and the key schedule parity of Threefry,
+// as chosen by Salmon et al. for each word size and word count
+template <size_t w, size_t n>
+struct threefry_constants;
+
+template <>
+struct threefry_constants<32, 2>
+{
+  static const std::uint32_t parity = 0x1BD11BDAu;
+
+  _CCCL_HOST_DEVICE static unsigned int rotation(size_t round, size_t)
+  {
+    const unsigned int distances[8] = {13, 15, 26, 6, 17, 29, 16, 24};
+    return distances[round % 8];
+  }
+}; // end threefry_constants
+
+template <>
+struct threefry_constants<32, 4>
+{
+  static const std::uint32_t parity = 0x1BD11BDAu;
+
+  _CCCL_HOST_DEVICE static unsigned int rotation(size_t round, size_t pair)
+  {
+    const unsigned int distances[8][2] = {{10, 26}, {11, 21}, {13, 27}, {23, 5}, {6, 20}, {17, 11}, {25, 10}, {18, 20}};
+    return distances[round % 8][pair];
+  }
+}; // end threefry_constants
+
+template <>
+struct threefry_constants<64, 2>
+{
+  static const std::uint64_t parity = 0x1BD11BDAA9FC1A22ull;
+
+  _CCCL_HOST_DEVICE static unsigned int rotation(size_t round, size_t)
+  {
+    const unsigned int distances[8] = {16, 42, 12, 31, 16, 32, 24, 21};
+    return distances[round % 8];
+  }
+}; // end threefry_constants
+
+template <>
+struct threefry_constants<64, 4>
+{
+  static const std::uint64_t parity = 0x1BD11BDAA9FC1A22ull;
+
+  _CCCL_HOST_DEVICE static unsigned int rotation(size_t round, size_t pair)
+  {
+    const unsigned int distances[8][2] = {
+      {14, 16}, {52, 57}, {23, 40}, {5, 37}, {25, 33}, {46, 12}, {58, 22}, {32, 32}};
+    return distances[round % 8][pair];
+  }
+}; // end threefry_constants
+
+} // namespace detail
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE threefry_engine<UIntType, w, n, r>::threefry_engine(result_type value)
+{
+  seed(value);
+} // end threefry_engine::threefry_engine()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE void threefry_engine<UIntType, w, n, r>::seed(result_type value)
+{
+  for (size_t j = 0; j < word_count; ++j)
+  {
+    m_x[j] = 0;
+    m_k[j] = 0;
+    m_y[j] = 0;
+  } // end for j
+
+  m_k[0] = value & wordmask;
+  m_i    = word_count - 1;
+} // end threefry_engine::seed()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE void threefry_engine<UIntType, w, n, r>::set_counter(const result_type (&counter)[word_count])
+{
+  for (size_t j = 0; j < word_count; ++j)
+  {
+    m_x[j] = counter[word_count - 1 - j] & wordmask;
+  } // end for j
+
+  m_i = word_count - 1;
+} // end threefry_engine::set_counter()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE void threefry_engine<UIntType, w, n, r>::generate_block()
+{
+  using constants = detail::threefry_constants<w, n>;
+
+  // the key schedule appends the parity of the key words
+  result_type ks[word_count + 1];
+  ks[word_count] = static_cast<result_type>(constants::parity);
+
+  result_type x[word_count];
+  for (size_t j = 0; j < word_count; ++j)
+  {
+    ks[j] = m_k[j];
+    ks[word_count] ^= m_k[j];
+    x[j] = (m_x[j] + ks[j]) & wordmask;
+  }
+
+  for (size_t q = 0; q < round_count; ++q)
+  {
+    // the four word variant pairs word 0 with 1 and 2 with 3 in even rounds,
+    // and word 0 with 3 and 2 with 1 in odd rounds
+    for (size_t p = 0; p < word_count / 2; ++p)
+    {
+      const size_t a = 2 * p;
+      const size_t b = (word_count == 4 && q % 2 == 1) ? 3 - a : a + 1;
+
+      const unsigned int distance = constants::rotation(q, p);
+
+      x[a] = (x[a] + x[b]) & wordmask;
+      x[b] = (((x[b] << distance) | (x[b] >> (w - distance))) & wordmask) ^ x[a];
+    }
+
+    // inject the key every four rounds
+    if (q % 4 == 3)
+    {
+      const size_t s = q / 4 + 1;
+      for (size_t j = 0; j < word_count; ++j)
+      {
+        x[j] = (x[j] + ks[(s + j) % (word_count + 1)]) & wordmask;
+      }
+      x[word_count - 1] = (x[word_count - 1] + static_cast<result_type>(s)) & wordmask;
+    }
+  } // end for q
+
+  for (size_t j = 0; j < word_count; ++j)
+  {
+    m_y[j] = x[j];
+  }
+} // end threefry_engine::generate_block()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE typename threefry_engine<UIntType, w, n, r>::result_type
+threefry_engine<UIntType, w, n, r>::operator()(void)
+{
+  ++m_i;
+  if (m_i == word_count)
+  {
+    generate_block();
+    detail::counter_based_engine_counter<UIntType, w, n>::increment(m_x, 1);
+    m_i = 0;
+  }
+
+  return m_y[m_i];
+} // end threefry_engine::operator()()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE void threefry_engine<UIntType, w, n, r>::discard(unsigned long long z)
+{
+  if (detail::counter_based_engine_counter<UIntType, w, n>::discard(m_x, m_i, z))
+  {
+    generate_block();
+    detail::counter_based_engine_counter<UIntType, w, n>::increment(m_x, 1);
+  }
+} // end threefry_engine::discard()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+template <typename CharT, typename Traits>
+std::basic_ostream<CharT, Traits>&
+threefry_engine<UIntType, w, n, r>::stream_out(std::basic_ostream<CharT, Traits>& os) const
+{
+  using ostream_type = std::basic_ostream<CharT, Traits>;
+  using ios_base     = typename ostream_type::ios_base;
+
+  const typename ios_base::fmtflags flags = os.flags();
+  const CharT fill                        = os.fill();
+  const CharT space                       = os.widen(' ');
+  os.flags(ios_base::dec | ios_base::fixed | ios_base::left);
+  os.fill(space);
+
+  // the buffered words are a function of the key and the counter
+  for (size_t j = 0; j < word_count; ++j)
+  {
+    os << m_k[j] << space;
+  }
+  for (size_t j = 0; j < word_count; ++j)
+  {
+    os << m_x[j] << space;
+  }
+  os << m_i;
+
+  os.flags(flags);
+  os.fill(fill);
+  return os;
+}
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+template <typename CharT, typename Traits>
+std::basic_istream<CharT, Traits>&
+threefry_engine<UIntType, w, n, r>::stream_in(std::basic_istream<CharT, Traits>& is)
+{
+  using istream_type = std::basic_istream<CharT, Traits>;
+  using ios_base     = typename istream_type::ios_base;
+
+  const typename ios_base::fmtflags flags = is.flags();
+  is.flags(ios_base::dec | ios_base::skipws);
+
+  for (size_t j = 0; j < word_count; ++j)
+  {
+    is >> m_k[j];
+  }
+  for (size_t j = 0; j < word_count; ++j)
+  {
+    is >> m_x[j];
+  }
+  is >> m_i;
+
+  // regenerate the buffered words from the previous counter
+  if (m_i != word_count - 1)
+  {
+    detail::counter_based_engine_counter<UIntType, w, n>::decrement(m_x);
+    generate_block();
+    detail::counter_based_engine_counter<UIntType, w, n>::increment(m_x, 1);
+  }
+
+  is.flags(flags);
+  return is;
+}
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE bool threefry_engine<UIntType, w, n, r>::equal(const threefry_engine& rhs) const
+{
+  for (size_t j = 0; j < word_count; ++j)
+  {
+    if (m_k[j] != rhs.m_k[j] || m_x[j] != rhs.m_x[j])
+    {
+      return false;
+    }
+  }
+
+  return m_i == rhs.m_i;
+}
+
+template <typename UIntType_, size_t w_, size_t n_, size_t r_>
+_CCCL_HOST_DEVICE bool operator==(const threefry_engine<UIntType_, w_, n_, r_>& lhs,
+                                  const threefry_engine<UIntType_, w_, n_, r_>& rhs)
+{
+  return thrust::random::detail::random_core_access::equal(lhs, rhs);
+}
+
+template <typename UIntType_, size_t w_, size_t n_, size_t r_>
+_CCCL_HOST_DEVICE bool operator!=(const threefry_engine<UIntType_, w_, n_, r_>& lhs,
+                                  const threefry_engine<UIntType_, w_, n_, r_>& rhs)
+{
+  return !(lhs == rhs);
+}
+
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, typename CharT, typename Traits>
+std::basic_ostream<CharT, Traits>&
+operator<<(std::basic_ostream<CharT, Traits>& os, const threefry_engine<UIntType_, w_, n_, r_>& e)
+{
+  return thrust::random::detail::random_core_access::stream_out(os, e);
+}
+
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, typename CharT, typename Traits>
+std::basic_istream<CharT, Traits>&
+operator>>(std::basic_istream<CharT, Traits>& is, threefry_engine<UIntType_, w_, n_, r_>& e)
+{
+  return thrust::random::detail::random_core_access::stream_in(is, e);
+}
+
+} // namespace random
+
+THRUST_NAMESPACE_END
@@ -78,6 +78,39 @@ uniform_int_distribution<IntType>::operator()(UniformRandomNumberGenerator& urng
   return static_cast<result_type>(real_dist(urng));
 } // end uniform_int_distribution::operator()()
 
+template <typename IntType>
+template <typename UniformRandomNumberGenerator, typename OutputIterator, typename Size>
+_CCCL_HOST_DEVICE OutputIterator
+uniform_int_distribution<IntType>::generate_n(UniformRandomNumberGenerator& urng, OutputIterator result, Size n)
+{
+  using float_type = typename thrust::detail::largest_available_float::type;
+
+  const float_type real_min(static_cast<float_type>(m_param.first));
+  const float_type real_max(static_cast<float_type>(m_param.second));
+
+  // produce the same values as operator() through a block of uniform reals
+  uniform_real_distribution<float_type> real_dist(real_min, real_max + float_type(1));
+
+  const int block_size = 64;
+  float_type block[block_size];
+
+  while (n > 0)
+  {
+    const int count = n < Size(block_size) ? static_cast<int>(n) : block_size;
+
+    real_dist.generate_n(urng, block, count);
+
+    for (int i = 0; i < count; ++i, ++result)
+    {
+      *result = static_cast<result_type>(block[i]);
+    }
+
+    n -= count;
+  }
+
+  return result;
+} // end uniform_int_distribution::generate_n()
+
 template <typename IntType>
 _CCCL_HOST_DEVICE typename uniform_int_distribution<IntType>::result_type uniform_int_distribution<IntType>::a() const
 {
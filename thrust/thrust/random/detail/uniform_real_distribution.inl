@@ -60,8 +60,48 @@ template <typename UniformRandomNumberGenerator>
 _CCCL_HOST_DEVICE typename uniform_real_distribution<RealType>::result_type
 uniform_real_distribution<RealType>::operator()(UniformRandomNumberGenerator& urng, const param_type& parm)
 {
-  // call the urng & map its result to [0,1)
-  result_type result = static_cast<result_type>(urng() - UniformRandomNumberGenerator::min);
+  return convert<UniformRandomNumberGenerator>(urng(), parm);
+} // end uniform_real::operator()()
+
+template <typename RealType>
+template <typename UniformRandomNumberGenerator, typename OutputIterator, typename Size>
+_CCCL_HOST_DEVICE OutputIterator
+uniform_real_distribution<RealType>::generate_n(UniformRandomNumberGenerator& urng, OutputIterator result, Size n)
+{
+  using value_type = typename UniformRandomNumberGenerator::result_type;
+
+  const int block_size = 64;
+  value_type block[block_size];
+
+  // draw a block of values before converting it, so that the conversion loop has no calls in it
+  while (n > 0)
+  {
+    const int count = n < Size(block_size) ? static_cast<int>(n) : block_size;
+
+    for (int i = 0; i < count; ++i)
+    {
+      block[i] = urng();
+    }
+
+    for (int i = 0; i < count; ++i, ++result)
+    {
+      *result = convert<UniformRandomNumberGenerator>(block[i], m_param);
+    }
+
+    n -= count;
+  }
+
+  return result;
+} // end uniform_real::generate_n()
+
+template <typename RealType>
+template <typename UniformRandomNumberGenerator>
+_CCCL_HOST_DEVICE typename uniform_real_distribution<RealType>::result_type
+uniform_real_distribution<RealType>::convert(typename UniformRandomNumberGenerator::result_type value,
+                                             const param_type& parm)
+{
+  // map the urng's result to [0,1)
+  result_type result = static_cast<result_type>(value - UniformRandomNumberGenerator::min);
 
   // adding one to the denominator ensures that the interval is half-open at 1.0
   // XXX adding 1.0 to a potentially large floating point number seems like a bad idea
@@ -72,7 +112,7 @@ uniform_real_distribution<RealType>::operator()(UniformRandomNumberGenerator& ur
     (result_type(1) + static_cast<result_type>(UniformRandomNumberGenerator::max - UniformRandomNumberGenerator::min));
 
   return (result * (parm.second - parm.first)) + parm.first;
-} // end uniform_real::operator()()
+} // end uniform_real::convert()
 
 template <typename RealType>
 _CCCL_HOST_DEVICE typename uniform_real_distribution<RealType>::result_type
@@ -91,10 +91,9 @@ xor_combine_engine<Engine1, s1, Engine2, s2>::operator()(void)
 template <typename Engine1, size_t s1, typename Engine2, size_t s2>
 _CCCL_HOST_DEVICE void xor_combine_engine<Engine1, s1, Engine2, s2>::discard(unsigned long long z)
 {
-  for (; z > 0; --z)
-  {
-    this->operator()();
-  } // end for
+  // each value consumes one value of each base engine
+  m_b1.discard(z);
+  m_b2.discard(z);
 } // end xor_combine_engine::discard()
 
 template <typename Engine1, size_t s1, typename Engine2, size_t s2>
@@ -157,7 +157,7 @@ public:
    *  and discards the results.
    *
    *  \param z The number of random values to discard.
-   *  \note This function is provided because an implementation may be able to accelerate it.
+   *  \note This function discards the values of the base engine with a single call to its \p discard.
    */
   _CCCL_HOST_DEVICE void discard(unsigned long long z);
 
@@ -0,0 +1,233 @@
+/*
+ *  Copyright 2025 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file generate_random.h
+ *  \brief Fills a range with the values of a random number distribution in parallel
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+#include <thrust/random/normal_distribution.h>
+#include <thrust/random/uniform_int_distribution.h>
+#include <thrust/random/uniform_real_distribution.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+/*! \addtogroup random
+ *  \{
+ */
+
+/*! \p generate_random_traits describes how many values of a
+ *  \p UniformRandomNumberGenerator a random number distribution consumes, so that
+ *  \p generate_random may split a range into tiles, which are generated independently
+ *  by copies of the engine discarded to the beginning of their tile.
+ *
+ *  A distribution consumes \c draws_per_block values of the engine for each block of
+ *  \c results_per_block consecutive results, beginning at the first result after its
+ *  \p reset. It is specialized for the distributions of \p thrust::random, and may be
+ *  specialized for user-defined distributions which provide \p generate_n.
+ *
+ *  \tparam Distribution The type of the random number distribution.
+ */
+template <typename Distribution>
+struct generate_random_traits;
+
+/*! \cond
+ */
+
+template <typename RealType>
+struct generate_random_traits<uniform_real_distribution<RealType>>
+{
+  static const unsigned long long results_per_block = 1;
+  static const unsigned long long draws_per_block   = 1;
+};
+
+template <typename IntType>
+struct generate_random_traits<uniform_int_distribution<IntType>>
+{
+  static const unsigned long long results_per_block = 1;
+  static const unsigned long long draws_per_block   = 1;
+};
+
+template <typename RealType>
+struct generate_random_traits<normal_distribution<RealType>>
+{
+  // the Box-Muller transform produces a pair of results from a pair of draws
+  static const unsigned long long results_per_block =
+    ::cuda::std::is_base_of<detail::normal_distribution_portable<RealType>, normal_distribution<RealType>>::value ? 2
+                                                                                                                  : 1;
+  static const unsigned long long draws_per_block = results_per_block;
+};
+
+/*! \endcond
+ */
+
+/*! \p generate_random_n writes \p n values of the distribution \p dist, drawn from
+ *  \p urng, to the range <tt>[result, result + n)</tt>.
+ *
+ *  The values are those which \p n calls of <tt>dist(urng)</tt> would produce after
+ *  <tt>dist.reset()</tt>, but they are generated in parallel as determined by \p exec:
+ *  the range is split into tiles, and each tile is generated in blocks by
+ *  <tt>Distribution::generate_n</tt> from a copy of \p urng which is discarded to the
+ *  tile's beginning. Afterwards, \p urng is advanced past the values consumed, and
+ *  \p dist is reset.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param result The beginning of the range to write to.
+ *  \param n The number of values to generate.
+ *  \param urng The \p UniformRandomNumberGenerator to use as a source of randomness.
+ *  \param dist The random number distribution to sample.
+ *  \return <tt>result + n</tt>
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and \p
+ * RandomAccessIterator is mutable.
+ *  \tparam Size is an integral type.
+ *  \tparam UniformRandomNumberGenerator is a random number engine, whose \p discard should be fast.
+ *  \tparam Distribution is a random number distribution for which \p generate_random_traits is specialized.
+ *
+ *  The following code snippet demonstrates how to fill a \c device_vector with normally distributed values:
+ *
+ *  \code
+ *  #include <thrust/random.h>
+ *  #include <thrust/random/generate_random.h>
+ *  #include <thrust/device_vector.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  thrust::device_vector<float> v(1 << 20);
+ *  thrust::philox4x32 rng;
+ *  thrust::normal_distribution<float> dist(0.0f, 1.0f);
+ *  thrust::random::generate_random_n(thrust::device, v.begin(), v.size(), rng, dist);
+ *  \endcode
+ *
+ *  \see generate_random_traits
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename Size,
+          typename UniformRandomNumberGenerator,
+          typename Distribution>
+_CCCL_HOST_DEVICE RandomAccessIterator generate_random_n(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator result,
+  Size n,
+  UniformRandomNumberGenerator& urng,
+  Distribution& dist);
+
+/*! \p generate_random_n writes \p n values of the distribution \p dist, drawn from
+ *  \p urng, to the range <tt>[result, result + n)</tt>, in parallel as determined by
+ *  the system of \p RandomAccessIterator.
+ *
+ *  \param result The beginning of the range to write to.
+ *  \param n The number of values to generate.
+ *  \param urng The \p UniformRandomNumberGenerator to use as a source of randomness.
+ *  \param dist The random number distribution to sample.
+ *  \return <tt>result + n</tt>
+ *
+ *  \see generate_random_n
+ */
+template <typename RandomAccessIterator, typename Size, typename UniformRandomNumberGenerator, typename Distribution>
+RandomAccessIterator
+generate_random_n(RandomAccessIterator result, Size n, UniformRandomNumberGenerator& urng, Distribution& dist);
+
+/*! \p generate_random_n writes the next \p n values of \p urng to the range
+ *  <tt>[result, result + n)</tt>, in parallel as determined by \p exec, and
+ *  advances \p urng past them.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param result The beginning of the range to write to.
+ *  \param n The number of values to generate.
+ *  \param urng The \p UniformRandomNumberGenerator to use as a source of randomness.
+ *  \return <tt>result + n</tt>
+ */
+template <typename DerivedPolicy, typename RandomAccessIterator, typename Size, typename UniformRandomNumberGenerator>
+_CCCL_HOST_DEVICE RandomAccessIterator generate_random_n(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator result,
+  Size n,
+  UniformRandomNumberGenerator& urng);
+
+/*! \p generate_random_n writes the next \p n values of \p urng to the range
+ *  <tt>[result, result + n)</tt>, in parallel as determined by the system of
+ *  \p RandomAccessIterator, and advances \p urng past them.
+ *
+ *  \param result The beginning of the range to write to.
+ *  \param n The number of values to generate.
+ *  \param urng The \p UniformRandomNumberGenerator to use as a source of randomness.
+ *  \return <tt>result + n</tt>
+ */
+template <typename RandomAccessIterator, typename Size, typename UniformRandomNumberGenerator>
+RandomAccessIterator generate_random_n(RandomAccessIterator result, Size n, UniformRandomNumberGenerator& urng);
+
+/*! \p generate_random writes values of the distribution \p dist, drawn from \p urng,
+ *  to the range <tt>[first, last)</tt>, in parallel as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the range to write to.
+ *  \param last The end of the range to write to.
+ *  \param urng The \p UniformRandomNumberGenerator to use as a source of randomness.
+ *  \param dist The random number distribution to sample.
+ *
+ *  \see generate_random_n
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename UniformRandomNumberGenerator,
+          typename Distribution>
+_CCCL_HOST_DEVICE void generate_random(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  UniformRandomNumberGenerator& urng,
+  Distribution& dist);
+
+/*! \p generate_random writes values of the distribution \p dist, drawn from \p urng,
+ *  to the range <tt>[first, last)</tt>, in parallel as determined by the system of
+ *  \p RandomAccessIterator.
+ *
+ *  \param first The beginning of the range to write to.
+ *  \param last The end of the range to write to.
+ *  \param urng The \p UniformRandomNumberGenerator to use as a source of randomness.
+ *  \param dist The random number distribution to sample.
+ *
+ *  \see generate_random_n
+ */
+template <typename RandomAccessIterator, typename UniformRandomNumberGenerator, typename Distribution>
+void generate_random(
+  RandomAccessIterator first, RandomAccessIterator last, UniformRandomNumberGenerator& urng, Distribution& dist);
+
+/*! \} // end random
+ */
+
+} // namespace random
+
+THRUST_NAMESPACE_END
+
+#include <thrust/random/detail/generate_random.inl>
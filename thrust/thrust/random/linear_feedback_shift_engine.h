@@ -143,7 +143,7 @@ public:
    *  and discards the results.
    *
    *  \param z The number of random values to discard.
-   *  \note This function is provided because an implementation may be able to accelerate it.
+   *  \note This function takes time logarithmic in \p z.
    */
   _CCCL_HOST_DEVICE void discard(unsigned long long z);
 
@@ -153,6 +153,9 @@ public:
 private:
   result_type m_value;
 
+  // the state following the given state
+  _CCCL_HOST_DEVICE static result_type transition(result_type value);
+
   friend struct thrust::random::detail::random_core_access;
 
   _CCCL_HOST_DEVICE bool equal(const linear_feedback_shift_engine& rhs) const;
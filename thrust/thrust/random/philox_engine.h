@@ -0,0 +1,313 @@
+/*
+ *  Copyright 2025 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file philox_engine.h
+ *  \brief A counter-based pseudorandom number generator
+ *         based on Salmon, Moraes, Dror & Shaw.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/random/detail/counter_based_engine.h>
+#include <thrust/random/detail/random_core_access.h>
+
+#include <cstddef> // for size_t
+#include <cstdint>
+#include <iostream>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+/*! \addtogroup random_number_engine_templates
+ *  \{
+ */
+
+/*! \class philox_engine
+ *  \brief A \p philox_engine random number engine produces unsigned integer
+ *         random numbers using the counter-based Philox algorithm of Salmon et al.
+ *
+ *         The state of a \p philox_engine consists of an <tt>n</tt>-word counter \c X,
+ *         an <tt>n/2</tt>-word key \c K, a buffer \c Y of \c n words and an index \c i.
+ *         The generation algorithm is performed as follows:
+ *         -# Increment \c i. If <tt>i == n</tt>, set \c Y to the result of \c r rounds of the
+ *            Philox bijection applied to \c X under the key \c K, increment \c X and set \c i to \c 0.
+ *         -# Return <tt>Y_i</tt>.
+ *
+ *         As the produced values are a function of the counter, \p discard and \p set_counter
+ *         take constant time, which makes it cheap to give every thread its own subsequence.
+ *
+ *  \tparam UIntType The type of unsigned integer to produce.
+ *  \tparam w The word size of the produced values (<tt>w <= 32</tt> or <tt>w == 64</tt>).
+ *  \tparam n The number of words of the counter (\c 2 or \c 4).
+ *  \tparam r The number of rounds of the generation algorithm.
+ *  \tparam consts The multiplier and the round constant of each pair of words,
+ *          in the order <tt>M_0, C_0, M_1, C_1</tt>.
+ *
+ *  \note Inexperienced users should not use this class template directly.  Instead, use
+ *  \p philox4x32 or \p philox4x64, which are instances of \p philox_engine.
+ *
+ *  The following code snippet shows how a \p philox_engine gives each element of a
+ *  sequence an independent random value:
+ *
+ *  \code
+ *  #include <thrust/random.h>
+ *  #include <thrust/tabulate.h>
+ *  #include <thrust/device_vector.h>
+ *
+ *  struct draw
+ *  {
+ *    __host__ __device__ unsigned int operator()(unsigned int i) const
+ *    {
+ *      thrust::philox4x32 rng;
+ *
+ *      // skipping to the i-th value takes constant time
+ *      rng.discard(i);
+ *      return rng();
+ *    }
+ *  };
+ *
+ *  ...
+ *
+ *  thrust::device_vector<unsigned int> v(1 << 20);
+ *  thrust::tabulate(v.begin(), v.end(), draw());
+ *  \endcode
+ *
+ *  \see thrust::random::philox4x32
+ *  \see thrust::random::philox4x64
+ */
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+class philox_engine
+{
+  static_assert(n == 2 || n == 4, "philox_engine requires a counter of two or four words");
+  static_assert(sizeof...(consts) == n, "philox_engine requires a multiplier and a round constant per pair of words");
+  static_assert(0 < w && (w <= 32 || w == 64) && w <= sizeof(UIntType) * 8,
+                "philox_engine requires a word size of at most 32 bits, or of 64 bits");
+
+  /*! \cond
+   */
+
+private:
+  static const UIntType wordmask = detail::counter_based_engine_wordmask<UIntType, w>::value;
+  /*! \endcond
+   */
+
+public:
+  // types
+
+  /*! \typedef result_type
+   *  \brief The type of the unsigned integer produced by this \p philox_engine.
+   */
+  using result_type = UIntType;
+
+  // engine characteristics
+
+  /*! The word size of the produced values.
+   */
+  static const size_t word_size = w;
+
+  /*! The number of words of the counter.
+   */
+  static const size_t word_count = n;
+
+  /*! The number of rounds of the generation algorithm.
+   */
+  static const size_t round_count = r;
+
+  /*! The smallest value this \p philox_engine may potentially produce.
+   */
+  static const result_type min = 0;
+
+  /*! The largest value this \p philox_engine may potentially produce.
+   */
+  static const result_type max = wordmask;
+
+  /*! The default seed of this \p philox_engine.
+   */
+  static const result_type default_seed = 20111115u;
+
+  // constructors and seeding functions
+
+  /*! This constructor, which optionally accepts a seed, initializes a new
+   *  \p philox_engine.
+   *
+   *  \param value The seed used to intialize this \p philox_engine's state.
+   */
+  _CCCL_HOST_DEVICE explicit philox_engine(result_type value = default_seed);
+
+  /*! This method initializes this \p philox_engine's state, and optionally accepts
+   *  a seed value. The seed becomes the first word of the key, and the counter is reset to zero.
+   *
+   *  \param value The seed used to initializes this \p philox_engine's state.
+   */
+  _CCCL_HOST_DEVICE void seed(result_type value = default_seed);
+
+  /*! This method sets the counter of this \p philox_engine, so that the next value is the first
+   *  word produced from \p counter. This selects one of <tt>2^(n*w)</tt> blocks of values in constant time.
+   *
+   *  \param counter The new counter, with its most significant word first.
+   */
+  _CCCL_HOST_DEVICE void set_counter(const result_type (&counter)[word_count]);
+
+  // generating functions
+
+  /*! This member function produces a new random value and updates this \p philox_engine's state.
+   *  \return A new random number.
+   */
+  _CCCL_HOST_DEVICE result_type operator()(void);
+
+  /*! This member function advances this \p philox_engine's state a given number of times
+   *  and discards the results.
+   *
+   *  \param z The number of random values to discard.
+   *  \note This function takes constant time.
+   */
+  _CCCL_HOST_DEVICE void discard(unsigned long long z);
+
+  /*! \cond
+   */
+
+private:
+  result_type m_x[word_count];
+  result_type m_k[word_count / 2];
+  result_type m_y[word_count];
+  unsigned int m_i;
+
+  // sets m_y to the words produced from the counter m_x
+  _CCCL_HOST_DEVICE void generate_block();
+
+  _CCCL_HOST_DEVICE static constexpr result_type multiplier(size_t k)
+  {
+    return constant(2 * k);
+  }
+
+  _CCCL_HOST_DEVICE static constexpr result_type round_constant(size_t k)
+  {
+    return constant(2 * k + 1);
+  }
+
+  _CCCL_HOST_DEVICE static constexpr result_type constant(size_t i)
+  {
+    const result_type c[] = {consts...};
+    return c[i];
+  }
+
+  friend struct thrust::random::detail::random_core_access;
+
+  _CCCL_HOST_DEVICE bool equal(const philox_engine& rhs) const;
+
+  template <typename CharT, typename Traits>
+  std::basic_ostream<CharT, Traits>& stream_out(std::basic_ostream<CharT, Traits>& os) const;
+
+  template <typename CharT, typename Traits>
+  std::basic_istream<CharT, Traits>& stream_in(std::basic_istream<CharT, Traits>& is);
+
+  /*! \endcond
+   */
+}; // end philox_engine
+
+/*! This function checks two \p philox_engines for equality.
+ *  \param lhs The first \p philox_engine to test.
+ *  \param rhs The second \p philox_engine to test.
+ *  \return \c true if \p lhs is equal to \p rhs; \c false, otherwise.
+ */
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_>
+_CCCL_HOST_DEVICE bool operator==(const philox_engine<UIntType_, w_, n_, r_, consts_...>& lhs,
+                                  const philox_engine<UIntType_, w_, n_, r_, consts_...>& rhs);
+
+/*! This function checks two \p philox_engines for inequality.
+ *  \param lhs The first \p philox_engine to test.
+ *  \param rhs The second \p philox_engine to test.
+ *  \return \c true if \p lhs is not equal to \p rhs; \c false, otherwise.
+ */
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_>
+_CCCL_HOST_DEVICE bool operator!=(const philox_engine<UIntType_, w_, n_, r_, consts_...>& lhs,
+                                  const philox_engine<UIntType_, w_, n_, r_, consts_...>& rhs);
+
+/*! This function streams a philox_engine to a \p std::basic_ostream.
+ *  \param os The \p basic_ostream to stream out to.
+ *  \param e The \p philox_engine to stream out.
+ *  \return \p os
+ */
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_, typename CharT, typename Traits>
+std::basic_ostream<CharT, Traits>&
+operator<<(std::basic_ostream<CharT, Traits>& os, const philox_engine<UIntType_, w_, n_, r_, consts_...>& e);
+
+/*! This function streams a philox_engine in from a std::basic_istream.
+ *  \param is The \p basic_istream to stream from.
+ *  \param e The \p philox_engine to stream in.
+ *  \return \p is
+ */
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_, typename CharT, typename Traits>
+std::basic_istream<CharT, Traits>&
+operator>>(std::basic_istream<CharT, Traits>& is, philox_engine<UIntType_, w_, n_, r_, consts_...>& e);
+
+/*! \} // end random_number_engine_templates
+ */
+
+/*! \addtogroup predefined_random
+ *  \{
+ */
+
+/*! \typedef philox4x32
+ *  \brief A random number engine with predefined parameters which implements the
+ *         Philox4x32-10 random number generation algorithm.
+ *  \note The 10000th consecutive invocation of a default-constructed object of type \p philox4x32
+ *        shall produce the value \c 1955073260 .
+ */
+using philox4x32 =
+  philox_engine<std::uint32_t, 32, 4, 10, 0xCD9E8D57u, 0x9E3779B9u, 0xD2511F53u, 0xBB67AE85u>;
+
+/*! \typedef philox4x64
+ *  \brief A random number engine with predefined parameters which implements the
+ *         Philox4x64-10 random number generation algorithm.
+ *  \note The 10000th consecutive invocation of a default-constructed object of type \p philox4x64
+ *        shall produce the value \c 3409172418970261260 .
+ */
+using philox4x64 = philox_engine<std::uint64_t,
+                                 64,
+                                 4,
+                                 10,
+                                 0xCA5A826395121157ull,
+                                 0x9E3779B97F4A7C15ull,
+                                 0xD2E7470EE14C6C93ull,
+                                 0xBB67AE8584CAA73Bull>;
+
+/*! \} // end predefined_random
+ */
+
+} // namespace random
+
+// import names into thrust::
+using random::philox4x32;
+using random::philox4x64;
+using random::philox_engine;
+
+THRUST_NAMESPACE_END
+
+#include <thrust/random/detail/philox_engine.inl>
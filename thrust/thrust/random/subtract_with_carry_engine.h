@@ -142,7 +142,7 @@ public:
    *  and discards the results.
    *
    *  \param z The number of random values to discard.
-   *  \note This function is provided because an implementation may be able to accelerate it.
+   *  \note This function takes time logarithmic in \p z.
    */
   _CCCL_HOST_DEVICE void discard(unsigned long long z);
 
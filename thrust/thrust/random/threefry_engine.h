@@ -0,0 +1,282 @@
+/*
+ *  Copyright 2025 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file threefry_engine.h
+ *  \brief A counter-based pseudorandom number generator
+ *         based on Salmon, Moraes, Dror & Shaw.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/random/detail/counter_based_engine.h>
+#include <thrust/random/detail/random_core_access.h>
+
+#include <cstddef> // for size_t
+#include <cstdint>
+#include <iostream>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+/*! \addtogroup random_number_engine_templates
+ *  \{
+ */
+
+/*! \class threefry_engine
+ *  \brief A \p threefry_engine random number engine produces unsigned integer
+ *         random numbers using the counter-based Threefry algorithm of Salmon et al.,
+ *         which is derived from the Threefish block cipher.
+ *
+ *         The state of a \p threefry_engine consists of an <tt>n</tt>-word counter \c X,
+ *         an <tt>n</tt>-word key \c K, a buffer \c Y of \c n words and an index \c i.
+ *         The generation algorithm is performed as follows:
+ *         -# Increment \c i. If <tt>i == n</tt>, set \c Y to the result of \c r rounds of the
+ *            Threefry bijection applied to \c X under the key \c K, increment \c X and set \c i to \c 0.
+ *         -# Return <tt>Y_i</tt>.
+ *
+ *         Unlike \p philox_engine, \p threefry_engine only adds, rotates and xors, which makes
+ *         it a good choice where wide multiplies are slow. As with \p philox_engine,
+ *         \p discard and \p set_counter take constant time.
+ *
+ *  \tparam UIntType The type of unsigned integer to produce.
+ *  \tparam w The word size of the produced values (\c 32 or \c 64).
+ *  \tparam n The number of words of the counter and of the key (\c 2 or \c 4).
+ *  \tparam r The number of rounds of the generation algorithm.
+ *
+ *  \note Inexperienced users should not use this class template directly.  Instead, use
+ *  \p threefry2x32, \p threefry4x32, \p threefry2x64 or \p threefry4x64, which are instances
+ *  of \p threefry_engine.
+ *
+ *  \see thrust::random::philox_engine
+ *  \see thrust::random::threefry4x32
+ *  \see thrust::random::threefry4x64
+ */
+template <typename UIntType, size_t w, size_t n, size_t r>
+class threefry_engine
+{
+  static_assert(n == 2 || n == 4, "threefry_engine requires a counter of two or four words");
+  static_assert((w == 32 || w == 64) && w <= sizeof(UIntType) * 8,
+                "threefry_engine requires a word size of 32 or 64 bits");
+
+  /*! \cond
+   */
+
+private:
+  static const UIntType wordmask = detail::counter_based_engine_wordmask<UIntType, w>::value;
+  /*! \endcond
+   */
+
+public:
+  // types
+
+  /*! \typedef result_type
+   *  \brief The type of the unsigned integer produced by this \p threefry_engine.
+   */
+  using result_type = UIntType;
+
+  // engine characteristics
+
+  /*! The word size of the produced values.
+   */
+  static const size_t word_size = w;
+
+  /*! The number of words of the counter.
+   */
+  static const size_t word_count = n;
+
+  /*! The number of rounds of the generation algorithm.
+   */
+  static const size_t round_count = r;
+
+  /*! The smallest value this \p threefry_engine may potentially produce.
+   */
+  static const result_type min = 0;
+
+  /*! The largest value this \p threefry_engine may potentially produce.
+   */
+  static const result_type max = wordmask;
+
+  /*! The default seed of this \p threefry_engine.
+   */
+  static const result_type default_seed = 20111115u;
+
+  // constructors and seeding functions
+
+  /*! This constructor, which optionally accepts a seed, initializes a new
+   *  \p threefry_engine.
+   *
+   *  \param value The seed used to intialize this \p threefry_engine's state.
+   */
+  _CCCL_HOST_DEVICE explicit threefry_engine(result_type value = default_seed);
+
+  /*! This method initializes this \p threefry_engine's state, and optionally accepts
+   *  a seed value. The seed becomes the first word of the key, and the counter is reset to zero.
+   *
+   *  \param value The seed used to initializes this \p threefry_engine's state.
+   */
+  _CCCL_HOST_DEVICE void seed(result_type value = default_seed);
+
+  /*! This method sets the counter of this \p threefry_engine, so that the next value is the first
+   *  word produced from \p counter. This selects one of <tt>2^(n*w)</tt> blocks of values in constant time.
+   *
+   *  \param counter The new counter, with its most significant word first.
+   */
+  _CCCL_HOST_DEVICE void set_counter(const result_type (&counter)[word_count]);
+
+  // generating functions
+
+  /*! This member function produces a new random value and updates this \p threefry_engine's state.
+   *  \return A new random number.
+   */
+  _CCCL_HOST_DEVICE result_type operator()(void);
+
+  /*! This member function advances this \p threefry_engine's state a given number of times
+   *  and discards the results.
+   *
+   *  \param z The number of random values to discard.
+   *  \note This function takes constant time.
+   */
+  _CCCL_HOST_DEVICE void discard(unsigned long long z);
+
+  /*! \cond
+   */
+
+private:
+  result_type m_x[word_count];
+  result_type m_k[word_count];
+  result_type m_y[word_count];
+  unsigned int m_i;
+
+  // sets m_y to the words produced from the counter m_x
+  _CCCL_HOST_DEVICE void generate_block();
+
+  friend struct thrust::random::detail::random_core_access;
+
+  _CCCL_HOST_DEVICE bool equal(const threefry_engine& rhs) const;
+
+  template <typename CharT, typename Traits>
+  std::basic_ostream<CharT, Traits>& stream_out(std::basic_ostream<CharT, Traits>& os) const;
+
+  template <typename CharT, typename Traits>
+  std::basic_istream<CharT, Traits>& stream_in(std::basic_istream<CharT, Traits>& is);
+
+  /*! \endcond
+   */
+}; // end threefry_engine
+
+/*! This function checks two \p threefry_engines for equality.
+ *  \param lhs The first \p threefry_engine to test.
+ *  \param rhs The second \p threefry_engine to test.
+ *  \return \c true if \p lhs is equal to \p rhs; \c false, otherwise.
+ */
+template <typename UIntType_, size_t w_, size_t n_, size_t r_>
+_CCCL_HOST_DEVICE bool operator==(const threefry_engine<UIntType_, w_, n_, r_>& lhs,
+                                  const threefry_engine<UIntType_, w_, n_, r_>& rhs);
+
+/*! This function checks two \p threefry_engines for inequality.
+ *  \param lhs The first \p threefry_engine to test.
+ *  \param rhs The second \p threefry_engine to test.
+ *  \return \c true if \p lhs is not equal to \p rhs; \c false, otherwise.
+ */
+template <typename UIntType_, size_t w_, size_t n_, size_t r_>
+_CCCL_HOST_DEVICE bool operator!=(const threefry_engine<UIntType_, w_, n_, r_>& lhs,
+                                  const threefry_engine<UIntType_, w_, n_, r_>& rhs);
+
+/*! This function streams a threefry_engine to a \p std::basic_ostream.
+ *  \param os The \p basic_ostream to stream out to.
+ *  \param e The \p threefry_engine to stream out.
+ *  \return \p os
+ */
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, typename CharT, typename Traits>
+std::basic_ostream<CharT, Traits>&
+operator<<(std::basic_ostream<CharT, Traits>& os, const threefry_engine<UIntType_, w_, n_, r_>& e);
+
+/*! This function streams a threefry_engine in from a std::basic_istream.
+ *  \param is The \p basic_istream to stream from.
+ *  \param e The \p threefry_engine to stream in.
+ *  \return \p is
+ */
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, typename CharT, typename Traits>
+std::basic_istream<CharT, Traits>&
+operator>>(std::basic_istream<CharT, Traits>& is, threefry_engine<UIntType_, w_, n_, r_>& e);
+
+/*! \} // end random_number_engine_templates
+ */
+
+/*! \addtogroup predefined_random
+ *  \{
+ */
+
+/*! \typedef threefry2x32
+ *  \brief A random number engine with predefined parameters which implements the
+ *         Threefry2x32-20 random number generation algorithm.
+ *  \note The 10000th consecutive invocation of a default-constructed object of type \p threefry2x32
+ *        shall produce the value \c 1363243192 .
+ */
+using threefry2x32 = threefry_engine<std::uint32_t, 32, 2, 20>;
+
+/*! \typedef threefry4x32
+ *  \brief A random number engine with predefined parameters which implements the
+ *         Threefry4x32-20 random number generation algorithm.
+ *  \note The 10000th consecutive invocation of a default-constructed object of type \p threefry4x32
+ *        shall produce the value \c 112810865 .
+ */
+using threefry4x32 = threefry_engine<std::uint32_t, 32, 4, 20>;
+
+/*! \typedef threefry2x64
+ *  \brief A random number engine with predefined parameters which implements the
+ *         Threefry2x64-20 random number generation algorithm.
+ *  \note The 10000th consecutive invocation of a default-constructed object of type \p threefry2x64
+ *        shall produce the value \c 10067442004315573443 .
+ */
+using threefry2x64 = threefry_engine<std::uint64_t, 64, 2, 20>;
+
+/*! \typedef threefry4x64
+ *  \brief A random number engine with predefined parameters which implements the
+ *         Threefry4x64-20 random number generation algorithm.
+ *  \note The 10000th consecutive invocation of a default-constructed object of type \p threefry4x64
+ *        shall produce the value \c 9253438642465275567 .
+ */
+using threefry4x64 = threefry_engine<std::uint64_t, 64, 4, 20>;
+
+/*! \} // end predefined_random
+ */
+
+} // namespace random
+
+// import names into thrust::
+using random::threefry2x32;
+using random::threefry2x64;
+using random::threefry4x32;
+using random::threefry4x64;
+using random::threefry_engine;
+
+THRUST_NAMESPACE_END
+
+#include <thrust/random/detail/threefry_engine.inl>
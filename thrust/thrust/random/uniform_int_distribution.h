@@ -151,6 +151,18 @@ public:
   template <typename UniformRandomNumberGenerator>
   _CCCL_HOST_DEVICE result_type operator()(UniformRandomNumberGenerator& urng, const param_type& parm);
 
+  /*! This method produces \p n new random numbers as if by \p n calls of <tt>operator()(urng)</tt>,
+   *  and writes them to the range beginning at \p result. The numbers are produced in blocks, so that
+   *  the conversion of a block of the \p UniformRandomNumberGenerator's values may be vectorized.
+   *
+   *  \param urng The \p UniformRandomNumberGenerator to use as a source of randomness.
+   *  \param result The beginning of the range to write to.
+   *  \param n The number of random numbers to produce.
+   *  \return The end of the written range.
+   */
+  template <typename UniformRandomNumberGenerator, typename OutputIterator, typename Size>
+  _CCCL_HOST_DEVICE OutputIterator generate_n(UniformRandomNumberGenerator& urng, OutputIterator result, Size n);
+
   // property functions
 
   /*! This method returns the value of the parameter with which this \p uniform_int_distribution
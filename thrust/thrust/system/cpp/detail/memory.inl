@@ -55,6 +55,16 @@ void free(pointer<void> ptr)
   return thrust::system::detail::sequential::free(t, ptr);
 } // end free()
 
+temporary_cache_statistics get_temporary_cache_statistics()
+{
+  return detail::temporary_cache::this_thread().statistics();
+} // end get_temporary_cache_statistics()
+
+void trim_temporary_cache(std::size_t max_cached_bytes)
+{
+  detail::temporary_cache::this_thread().trim(max_cached_bytes);
+} // end trim_temporary_cache()
+
 } // namespace cpp
 } // namespace system
 THRUST_NAMESPACE_END
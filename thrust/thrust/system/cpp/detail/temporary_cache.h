@@ -0,0 +1,292 @@
+/*
+ *  Copyright 2025 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/integer_math.h>
+#include <thrust/system/detail/bad_alloc.h>
+
+#include <climits>
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace cpp
+{
+
+/*! \p temporary_cache_statistics describes the state of the temporary
+ *  buffer cache of one thread.
+ *
+ *  \see get_temporary_cache_statistics
+ */
+struct temporary_cache_statistics
+{
+  /*! The number of temporary buffers which were served from the cache.
+   */
+  std::size_t hits;
+
+  /*! The number of temporary buffers which had to be allocated with \p std::malloc.
+   */
+  std::size_t misses;
+
+  /*! The number of bytes which are currently held by the cache, without being in use.
+   */
+  std::size_t cached_bytes;
+};
+
+namespace detail
+{
+
+// A cache of the temporary buffers of the host systems, with one instance
+// per thread. Requests are rounded up to a power of two, and freed blocks are
+// kept in a free list of their size instead of being returned to std::free,
+// so that a loop of algorithm calls reuses the same few blocks instead of
+// allocating, and page faulting, fresh ones every time. Blocks know their size
+// class, so they may be returned on any thread.
+//
+// A thread which frees the buffers of other threads would otherwise collect
+// them without bound, so every free list keeps at most max_blocks_per_bin
+// blocks and the whole cache at most max_cached_bytes. Blocks freed beyond
+// that go straight back to std::free.
+class temporary_cache
+{
+public:
+  temporary_cache()
+      : m_hits(0)
+      , m_misses(0)
+      , m_cached_bytes(0)
+  {
+    for (std::size_t i = 0; i < bin_count; ++i)
+    {
+      m_free[i]  = nullptr;
+      m_count[i] = 0;
+    }
+  }
+
+  temporary_cache(const temporary_cache&)            = delete;
+  temporary_cache& operator=(const temporary_cache&) = delete;
+
+  ~temporary_cache()
+  {
+    trim(0);
+  }
+
+  static temporary_cache& this_thread()
+  {
+    static thread_local temporary_cache cache;
+    return cache;
+  }
+
+  // returns nullptr when the memory is exhausted, like std::malloc
+  void* allocate(std::size_t bytes)
+  {
+    const std::size_t bin = bin_of(bytes);
+    if (bin >= bin_count)
+    {
+      return nullptr;
+    }
+
+    if (block_header* block = m_free[bin])
+    {
+      m_free[bin] = block->next;
+      --m_count[bin];
+      m_cached_bytes -= block_size(bin);
+      ++m_hits;
+      return block + 1;
+    }
+
+    ++m_misses;
+
+    void* raw = std::malloc(sizeof(block_header) + block_size(bin));
+    if (raw == nullptr)
+    {
+      // give the cached blocks back and try again
+      trim(0);
+      raw = std::malloc(sizeof(block_header) + block_size(bin));
+      if (raw == nullptr)
+      {
+        return nullptr;
+      }
+    }
+
+    block_header* block = static_cast<block_header*>(raw);
+    block->bin          = bin;
+    return block + 1;
+  }
+
+  void deallocate(void* p)
+  {
+    if (p == nullptr)
+    {
+      return;
+    }
+
+    block_header* block   = static_cast<block_header*>(p) - 1;
+    const std::size_t bin = block->bin;
+    if (m_count[bin] == max_blocks_per_bin || block_size(bin) > max_cached_bytes)
+    {
+      std::free(block);
+      return;
+    }
+
+    block->next = m_free[bin];
+    m_free[bin] = block;
+    ++m_count[bin];
+    m_cached_bytes += block_size(bin);
+
+    trim(max_cached_bytes);
+  }
+
+  // frees the largest cached blocks until at most max_cached_bytes remain
+  void trim(std::size_t max_cached_bytes)
+  {
+    for (std::size_t bin = bin_count; bin-- > 0 && m_cached_bytes > max_cached_bytes;)
+    {
+      while (m_free[bin] != nullptr && m_cached_bytes > max_cached_bytes)
+      {
+        block_header* block = m_free[bin];
+        m_free[bin]         = block->next;
+        --m_count[bin];
+        m_cached_bytes -= block_size(bin);
+        std::free(block);
+      }
+    }
+  }
+
+  temporary_cache_statistics statistics() const
+  {
+    return {m_hits, m_misses, m_cached_bytes};
+  }
+
+private:
+  // precedes every block, and keeps its payload aligned as std::malloc would
+  struct alignas(std::max_align_t) block_header
+  {
+    block_header* next;
+    std::size_t bin;
+  };
+
+  static constexpr std::size_t smallest_bin_log2 = 8;
+  static constexpr std::size_t bin_count         = sizeof(std::size_t) * CHAR_BIT - smallest_bin_log2 - 1;
+
+  // XXX these values are a tuning opportunity
+  static constexpr std::size_t max_blocks_per_bin = 4;
+  static constexpr std::size_t max_cached_bytes   = std::size_t{1} << 30;
+
+  static std::size_t bin_of(std::size_t bytes)
+  {
+    const std::size_t log2 = bytes <= 1 ? 0 : static_cast<std::size_t>(thrust::detail::log2_ri(bytes));
+    return log2 <= smallest_bin_log2 ? 0 : log2 - smallest_bin_log2;
+  }
+
+  static std::size_t block_size(std::size_t bin)
+  {
+    return std::size_t{1} << (bin + smallest_bin_log2);
+  }
+
+  block_header* m_free[bin_count];
+  std::size_t m_count[bin_count];
+  std::size_t m_hits;
+  std::size_t m_misses;
+  std::size_t m_cached_bytes;
+};
+
+} // namespace detail
+
+/*! \p temporary_cache_allocator allocates from the temporary buffer cache of
+ *  the calling thread. Passing it to the execution policy of a host system,
+ *  e.g. <tt>thrust::omp::par(thrust::omp::temporary_cache_allocator<char>())</tt>,
+ *  makes the algorithm keep its temporary buffers in the cache after use
+ *  instead of returning them to \p std::free, so that the next algorithm
+ *  call which is passed such a policy reuses them.
+ *
+ *  Memory allocated on one thread may be deallocated on any other thread.
+ *
+ *  \see get_temporary_cache_statistics
+ *  \see trim_temporary_cache
+ */
+template <typename T>
+class temporary_cache_allocator
+{
+public:
+  using value_type      = T;
+  using pointer         = T*;
+  using const_pointer   = const T*;
+  using size_type       = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  template <typename U>
+  struct rebind
+  {
+    using other = temporary_cache_allocator<U>;
+  };
+
+  temporary_cache_allocator() = default;
+
+  template <typename U>
+  temporary_cache_allocator(const temporary_cache_allocator<U>&) noexcept
+  {}
+
+  pointer allocate(size_type n)
+  {
+    void* ptr = nullptr;
+    if (n <= (std::numeric_limits<size_type>::max)() / sizeof(T))
+    {
+      ptr = detail::temporary_cache::this_thread().allocate(n * sizeof(T));
+    }
+
+    if (ptr == nullptr)
+    {
+      throw thrust::system::detail::bad_alloc("temporary_cache_allocator::allocate: malloc failed");
+    } // end if
+
+    return static_cast<pointer>(ptr);
+  }
+
+  void deallocate(pointer p, size_type) noexcept
+  {
+    detail::temporary_cache::this_thread().deallocate(p);
+  }
+
+  // all instances share the caches of the threads
+  template <typename U>
+  bool operator==(const temporary_cache_allocator<U>&) const noexcept
+  {
+    return true;
+  }
+
+  template <typename U>
+  bool operator!=(const temporary_cache_allocator<U>&) const noexcept
+  {
+    return false;
+  }
+};
+
+} // namespace cpp
+} // namespace system
+THRUST_NAMESPACE_END
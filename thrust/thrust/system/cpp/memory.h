@@ -32,6 +32,7 @@
 #include <thrust/detail/type_traits.h>
 #include <thrust/memory.h>
 #include <thrust/mr/allocator.h>
+#include <thrust/system/cpp/detail/temporary_cache.h>
 #include <thrust/system/cpp/memory_resource.h>
 
 #include <ostream>
@@ -75,6 +76,23 @@ inline pointer<T> malloc(std::size_t n);
  */
 inline void free(pointer<void> ptr);
 
+/*! Returns the hit and miss counters and the size of the temporary buffer
+ *  cache of the calling thread. Algorithms of the \p cpp, \p omp and \p tbb
+ *  systems keep their temporary buffers in this cache when their execution
+ *  policy is given a \p temporary_cache_allocator.
+ *  \return The statistics of the cache of the calling thread.
+ *  \see temporary_cache_allocator
+ *  \see trim_temporary_cache
+ */
+inline temporary_cache_statistics get_temporary_cache_statistics();
+
+/*! Frees the largest cached temporary buffers of the calling thread until the
+ *  cache holds at most \p max_cached_bytes.
+ *  \param max_cached_bytes The number of bytes the cache may keep.
+ *  \see get_temporary_cache_statistics
+ */
+inline void trim_temporary_cache(std::size_t max_cached_bytes = 0);
+
 /*! \p cpp::allocator is the default allocator used by the \p cpp system's
  *  containers such as <tt>cpp::vector</tt> if no user-specified allocator is
  *  provided. \p cpp::allocator allocates (deallocates) storage with \p
@@ -101,7 +119,11 @@ namespace cpp
 {
 using thrust::system::cpp::allocator;
 using thrust::system::cpp::free;
+using thrust::system::cpp::get_temporary_cache_statistics;
 using thrust::system::cpp::malloc;
+using thrust::system::cpp::temporary_cache_allocator;
+using thrust::system::cpp::temporary_cache_statistics;
+using thrust::system::cpp::trim_temporary_cache;
 } // namespace cpp
 
 THRUST_NAMESPACE_END
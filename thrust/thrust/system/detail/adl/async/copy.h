@@ -32,9 +32,12 @@
 
 // #include <thrust/system/detail/sequential/async/copy.h>
 
-// #define __THRUST_HOST_SYSTEM_ASYNC_COPY_HEADER <__THRUST_HOST_SYSTEM_ROOT/detail/async/copy.h>
-// #include __THRUST_HOST_SYSTEM_ASYNC_COPY_HEADER
-// #undef __THRUST_HOST_SYSTEM_ASYNC_COPY_HEADER
+// Only the OpenMP and TBB host systems implement the async algorithms.
+#if THRUST_HOST_SYSTEM == THRUST_HOST_SYSTEM_OMP || THRUST_HOST_SYSTEM == THRUST_HOST_SYSTEM_TBB
+#  define __THRUST_HOST_SYSTEM_ASYNC_COPY_HEADER <__THRUST_HOST_SYSTEM_ROOT/detail/async/copy.h>
+#  include __THRUST_HOST_SYSTEM_ASYNC_COPY_HEADER
+#  undef __THRUST_HOST_SYSTEM_ASYNC_COPY_HEADER
+#endif
 
 #define __THRUST_DEVICE_SYSTEM_ASYNC_COPY_HEADER <__THRUST_DEVICE_SYSTEM_ROOT/detail/async/copy.h>
 #include __THRUST_DEVICE_SYSTEM_ASYNC_COPY_HEADER
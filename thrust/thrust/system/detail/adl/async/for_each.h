@@ -32,9 +32,12 @@
 
 // #include <thrust/system/detail/sequential/async/for_each.h>
 
-// #define __THRUST_HOST_SYSTEM_ASYNC_FOR_EACH_HEADER <__THRUST_HOST_SYSTEM_ROOT/detail/async/for_each.h>
-// #include __THRUST_HOST_SYSTEM_ASYNC_FOR_EACH_HEADER
-// #undef __THRUST_HOST_SYSTEM_ASYNC_FOR_EACH_HEADER
+// Only the OpenMP and TBB host systems implement the async algorithms.
+#if THRUST_HOST_SYSTEM == THRUST_HOST_SYSTEM_OMP || THRUST_HOST_SYSTEM == THRUST_HOST_SYSTEM_TBB
+#  define __THRUST_HOST_SYSTEM_ASYNC_FOR_EACH_HEADER <__THRUST_HOST_SYSTEM_ROOT/detail/async/for_each.h>
+#  include __THRUST_HOST_SYSTEM_ASYNC_FOR_EACH_HEADER
+#  undef __THRUST_HOST_SYSTEM_ASYNC_FOR_EACH_HEADER
+#endif
 
 #define __THRUST_DEVICE_SYSTEM_ASYNC_FOR_EACH_HEADER <__THRUST_DEVICE_SYSTEM_ROOT/detail/async/for_each.h>
 #include __THRUST_DEVICE_SYSTEM_ASYNC_FOR_EACH_HEADER
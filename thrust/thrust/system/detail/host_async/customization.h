@@ -0,0 +1,104 @@
+/*
+ *  Copyright 2025 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief The asynchronous algorithms shared by the OpenMP and TBB systems.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cpp14_required.h>
+
+#if _CCCL_STD_VER >= 2014
+
+#  include <thrust/detail/execute_with_allocator.h>
+#  include <thrust/detail/execute_with_dependencies.h>
+#  include <thrust/detail/host_async.h>
+#  include <thrust/detail/type_deduction.h>
+
+#  include <utility>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace system
+{
+namespace detail
+{
+namespace host_async
+{
+
+// A host system implements the asynchronous algorithms by running the
+// synchronous ones as a `Task` of its own, see thrust/detail/host_async.h. The
+// algorithms take the policy they run with, `exec`, which the system derives
+// from the policy the algorithm was called with. It carries the settings of
+// the system, but not the dependencies, which the operation waits for before
+// it starts.
+
+// `exec` as is, if `policy` has no allocator.
+template <typename Exec, typename DerivedPolicy>
+_CCCL_HOST Exec with_allocator_of(Exec const& exec, DerivedPolicy&)
+{
+  return exec;
+}
+
+// `exec` with a copy of the allocator of `policy`, so that the operation does
+// not refer to an allocator which may be gone by the time it runs.
+template <typename Exec, typename Allocator, template <typename> class BaseSystem>
+_CCCL_HOST auto
+with_allocator_of(Exec const& exec, thrust::detail::execute_with_allocator<Allocator, BaseSystem>& policy)
+  THRUST_DECLTYPE_RETURNS(exec(::cuda::std::remove_reference_t<Allocator>(policy.get_allocator())))
+
+template <typename Exec, typename Allocator, template <typename> class BaseSystem, typename... Dependencies>
+_CCCL_HOST auto with_allocator_of(
+  Exec const& exec,
+  thrust::detail::execute_with_allocator_and_dependencies<Allocator, BaseSystem, Dependencies...>& policy)
+  THRUST_DECLTYPE_RETURNS(exec(::cuda::std::remove_reference_t<Allocator>(policy.get_allocator())))
+
+// Runs `f()` as a `Task` once the dependencies of `policy` have completed.
+template <typename Task, typename DerivedPolicy, typename F>
+_CCCL_HOST thrust::detail::host_unique_eager_event<Task>
+make_dependent_event(thrust::execution_policy<DerivedPolicy>& policy, F&& f)
+{
+  return thrust::detail::make_host_dependent_event<Task>(
+    thrust::detail::extract_dependencies(std::move(thrust::detail::derived_cast(policy))), THRUST_FWD(f));
+}
+
+// Computes the content of the future with `f()` as a `Task` once the
+// dependencies of `policy` have completed.
+template <typename T, typename Task, typename DerivedPolicy, typename F>
+_CCCL_HOST thrust::detail::host_unique_eager_future<T, Task>
+make_dependent_future(thrust::execution_policy<DerivedPolicy>& policy, F&& f)
+{
+  return thrust::detail::make_host_dependent_future<T, Task>(
+    thrust::detail::extract_dependencies(std::move(thrust::detail::derived_cast(policy))), THRUST_FWD(f));
+}
+
+} // namespace host_async
+} // namespace detail
+} // namespace system
+
+THRUST_NAMESPACE_END
+
+#endif // C++14
@@ -0,0 +1,68 @@
+/*
+ *  Copyright 2025 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cpp14_required.h>
+
+#if _CCCL_STD_VER >= 2014
+
+#  include <thrust/sort.h>
+#  include <thrust/system/detail/host_async/customization.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace system
+{
+namespace detail
+{
+namespace host_async
+{
+
+template <typename Task,
+          typename Exec,
+          typename DerivedPolicy,
+          typename ForwardIt,
+          typename Sentinel,
+          typename StrictWeakOrdering>
+_CCCL_HOST thrust::detail::host_unique_eager_event<Task> async_stable_sort(
+  Exec const& exec,
+  thrust::execution_policy<DerivedPolicy>& policy,
+  ForwardIt first,
+  Sentinel last,
+  StrictWeakOrdering comp)
+{
+  return make_dependent_event<Task>(policy, [=] {
+    thrust::stable_sort(exec, first, last, comp);
+  });
+}
+
+} // namespace host_async
+} // namespace detail
+} // namespace system
+
+THRUST_NAMESPACE_END
+
+#endif // C++14
@@ -0,0 +1,118 @@
+/*
+ *  Copyright 2025 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// Returns the number of elements of [a, a + a_count) which precede the
+// diag-th element of the stable merge of [a, a + a_count) and
+// [b, b + b_count). Elements of a are ordered before equivalent elements of b.
+template <typename Iterator1, typename Iterator2, typename Size, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE Size
+merge_path(Iterator1 a, Size a_count, Iterator2 b, Size b_count, Size diag, StrictWeakOrdering comp)
+{
+  Size begin = diag > b_count ? diag - b_count : Size(0);
+  Size end   = diag < a_count ? diag : a_count;
+
+  while (begin < end)
+  {
+    Size mid = begin + (end - begin) / 2;
+
+    if (comp(b[diag - 1 - mid], a[mid]))
+    {
+      end = mid;
+    }
+    else
+    {
+      begin = mid + 1;
+    }
+  }
+
+  return begin;
+}
+
+// Returns the number of elements of [a, a + a_count) which are ordered before *value.
+template <typename Iterator1, typename Iterator2, typename Size, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE Size lower_bound_index(Iterator1 a, Size a_count, Iterator2 value, StrictWeakOrdering comp)
+{
+  Size begin = 0;
+  Size end   = a_count;
+
+  while (begin < end)
+  {
+    Size mid = begin + (end - begin) / 2;
+
+    if (comp(a[mid], *value))
+    {
+      begin = mid + 1;
+    }
+    else
+    {
+      end = mid;
+    }
+  }
+
+  return begin;
+}
+
+// Returns a split (i, j) of [a, a + a_count) and [b, b + b_count) near the
+// diag-th element of their merge such that no run of equivalent elements
+// straddles the split. Set operations applied independently to the pieces on
+// either side of the split produce the same output as when applied to the
+// whole ranges.
+template <typename Iterator1, typename Iterator2, typename Size, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE thrust::pair<Size, Size>
+set_operation_path(Iterator1 a, Size a_count, Iterator2 b, Size b_count, Size diag, StrictWeakOrdering comp)
+{
+  const Size i = merge_path(a, a_count, b, b_count, diag, comp);
+  const Size j = diag - i;
+
+  if (i < a_count && (j == b_count || !comp(b[j], a[i])))
+  {
+    // a[i] is the next element of the merge; every element of b before j is ordered before it
+    return thrust::make_pair(lower_bound_index(a, i, a + i, comp), j);
+  }
+  else if (j < b_count)
+  {
+    // b[j] is the next element of the merge
+    return thrust::make_pair(lower_bound_index(a, i, b + j, comp), lower_bound_index(b, j, b + j, comp));
+  }
+
+  return thrust::make_pair(a_count, b_count);
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,157 @@
+/*
+ *  Copyright 2025 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/detail/sequential/stable_radix_sort.h>
+
+#include <cuda/std/utility>
+
+#include <cstddef>
+
+// Building blocks of a tiled LSD radix sort for the parallel host backends.
+// Every pass histograms the digits of each tile, scans the histograms into
+// per-tile scatter offsets and then scatters each tile independently. Tiles
+// are scattered in order, so every pass (and therefore the sort) is stable.
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// extracts the radix digit of a key for one pass of the sort
+// when Descending is true the digits are complemented, which reverses the order of the keys
+template <typename KeyType, bool Descending>
+struct radix_digit
+{
+  using encoder_type = thrust::system::detail::sequential::radix_sort_detail::RadixEncoder<KeyType>;
+  using encoded_type = decltype(::cuda::std::declval<encoder_type>()(::cuda::std::declval<KeyType>()));
+
+  static const unsigned int radix_bits  = 8;
+  static const unsigned int num_buckets = 1u << radix_bits;
+  static const unsigned int num_passes  = (8 * sizeof(encoded_type) + (radix_bits - 1)) / radix_bits;
+
+  encoder_type encode;
+  unsigned int bit_shift;
+
+  _CCCL_HOST_DEVICE radix_digit(unsigned int pass)
+      : encode()
+      , bit_shift(radix_bits * pass)
+  {}
+
+  _CCCL_HOST_DEVICE std::size_t operator()(const KeyType& key) const
+  {
+    const std::size_t digit = static_cast<std::size_t>((encode(key) >> bit_shift) & (num_buckets - 1));
+
+    return Descending ? (num_buckets - 1) - digit : digit;
+  }
+};
+
+// counts the digits of [first, first + n) into histogram[0, num_buckets)
+template <typename RandomAccessIterator, typename Size, typename Digit>
+_CCCL_HOST_DEVICE void radix_histogram(RandomAccessIterator first, Size n, Digit digit, std::size_t* histogram)
+{
+  for (unsigned int i = 0; i < Digit::num_buckets; i++)
+  {
+    histogram[i] = 0;
+  }
+
+  for (Size i = 0; i < n; i++)
+  {
+    histogram[digit(first[i])]++;
+  }
+}
+
+// converts the per-tile histograms, stored tile by tile, into per-tile scatter offsets
+// returns false when every key shares the same digit and the pass may be skipped
+template <unsigned int NumBuckets, typename Size>
+_CCCL_HOST_DEVICE bool radix_scan_histograms(std::size_t* histograms, Size num_tiles, std::size_t n)
+{
+  std::size_t sum = 0;
+
+  for (unsigned int bucket = 0; bucket < NumBuckets; bucket++)
+  {
+    const std::size_t bucket_begin = sum;
+
+    for (Size tile = 0; tile < num_tiles; tile++)
+    {
+      const std::size_t count = histograms[tile * NumBuckets + bucket];
+
+      histograms[tile * NumBuckets + bucket] = sum;
+
+      sum += count;
+    }
+
+    if (sum - bucket_begin == n)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// scatters [first, first + n) to result according to offsets, which are advanced in the process
+template <typename RandomAccessIterator1, typename Size, typename RandomAccessIterator2, typename Digit>
+_CCCL_HOST_DEVICE void
+radix_scatter(RandomAccessIterator1 first, Size n, RandomAccessIterator2 result, Digit digit, std::size_t* offsets)
+{
+  for (Size i = 0; i < n; i++)
+  {
+    result[offsets[digit(first[i])]++] = first[i];
+  }
+}
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename Size,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename Digit>
+_CCCL_HOST_DEVICE void radix_scatter(
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  Size n,
+  RandomAccessIterator3 keys_result,
+  RandomAccessIterator4 values_result,
+  Digit digit,
+  std::size_t* offsets)
+{
+  for (Size i = 0; i < n; i++)
+  {
+    const std::size_t j = offsets[digit(keys_first[i])]++;
+
+    keys_result[j]   = keys_first[i];
+    values_result[j] = values_first[i];
+  }
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
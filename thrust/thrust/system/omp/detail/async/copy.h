@@ -0,0 +1,91 @@
+/*
+ *  Copyright 2025 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cpp14_required.h>
+
+#if _CCCL_STD_VER >= 2014
+
+#  include <thrust/system/cpp/detail/execution_policy.h>
+#  include <thrust/system/detail/host_async/copy.h>
+#  include <thrust/system/omp/detail/async/customization.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+// Copies between this system and the standard C++ system run on this one.
+template <typename DerivedPolicy, typename ForwardIt, typename Sentinel, typename OutputIt>
+_CCCL_HOST unique_eager_event
+async_copy_on(execution_policy<DerivedPolicy>& policy, ForwardIt first, Sentinel last, OutputIt output)
+{
+  return thrust::system::detail::host_async::async_copy<async_task>(async_policy(policy), policy, first, last, output);
+}
+
+// ADL entry point.
+template <typename FromPolicy, typename ToPolicy, typename ForwardIt, typename Sentinel, typename OutputIt>
+_CCCL_HOST unique_eager_event async_copy(
+  execution_policy<FromPolicy>& from_exec, execution_policy<ToPolicy>&, ForwardIt first, Sentinel last, OutputIt output)
+{
+  return async_copy_on(from_exec, first, last, output);
+}
+
+// ADL entry point.
+template <typename FromPolicy, typename ToPolicy, typename ForwardIt, typename Sentinel, typename OutputIt>
+_CCCL_HOST unique_eager_event async_copy(
+  execution_policy<FromPolicy>& from_exec,
+  thrust::cpp::execution_policy<ToPolicy>&,
+  ForwardIt first,
+  Sentinel last,
+  OutputIt output)
+{
+  return async_copy_on(from_exec, first, last, output);
+}
+
+// ADL entry point.
+template <typename FromPolicy, typename ToPolicy, typename ForwardIt, typename Sentinel, typename OutputIt>
+_CCCL_HOST unique_eager_event async_copy(
+  thrust::cpp::execution_policy<FromPolicy>&,
+  execution_policy<ToPolicy>& to_exec,
+  ForwardIt first,
+  Sentinel last,
+  OutputIt output)
+{
+  return async_copy_on(to_exec, first, last, output);
+}
+
+} // namespace detail
+} // namespace omp
+} // namespace system
+
+THRUST_NAMESPACE_END
+
+#endif // C++14
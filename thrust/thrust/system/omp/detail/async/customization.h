@@ -0,0 +1,61 @@
+/*
+ *  Copyright 2025 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cpp14_required.h>
+
+#if _CCCL_STD_VER >= 2014
+
+#  include <thrust/system/detail/host_async/customization.h>
+#  include <thrust/system/omp/detail/par.h>
+#  include <thrust/system/omp/detail/parallel_settings.h>
+#  include <thrust/system/omp/future.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+// The policy the algorithms of an asynchronous operation run with, which keeps
+// the parallel settings and the allocator of `policy` but not its dependencies.
+template <typename DerivedPolicy>
+_CCCL_HOST auto async_policy(execution_policy<DerivedPolicy>& policy)
+{
+  return thrust::system::detail::host_async::with_allocator_of(
+    execute_with_settings(settings(policy)), thrust::detail::derived_cast(policy));
+}
+
+} // namespace detail
+} // namespace omp
+} // namespace system
+
+THRUST_NAMESPACE_END
+
+#endif // C++14
@@ -0,0 +1,182 @@
+/*
+ *  Copyright 2025 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file compact.h
+ *  \brief Single-pass stream compaction for the OpenMP backend.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/pair.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace compact_detail
+{
+
+// Selects element i if pred(stencil[i]) holds.
+template <typename InputIterator, typename Predicate>
+struct stencil_selector
+{
+  InputIterator stencil;
+  thrust::detail::wrapped_function<Predicate, bool> pred;
+
+  template <typename Size>
+  bool operator()(Size i) const
+  {
+    return pred(stencil[i]);
+  }
+};
+
+// Selects element i if it is the first one or differs from its predecessor.
+template <typename InputIterator, typename BinaryPredicate>
+struct unique_selector
+{
+  InputIterator first;
+  thrust::detail::wrapped_function<BinaryPredicate, bool> binary_pred;
+
+  template <typename Size>
+  bool operator()(Size i) const
+  {
+    return i == 0 || !binary_pred(first[i - 1], first[i]);
+  }
+};
+
+} // end namespace compact_detail
+
+// Copies the elements of [first, first + n) for which selected(i) holds to
+// out_true and, if CopyRejected, the others to out_false, keeping the order of
+// both. Every interval of the default decomposition counts its selected
+// elements, a sequential scan over the P counts yields each interval's output
+// offsets, and every interval then writes its elements directly to their final
+// positions. Only O(P) temporary storage is used, at the cost of evaluating
+// selected twice per element.
+template <bool CopyRejected,
+          typename DerivedPolicy,
+          typename InputIterator,
+          typename Size,
+          typename Selector,
+          typename OutputIterator1,
+          typename OutputIterator2>
+thrust::pair<OutputIterator1, OutputIterator2> compact(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  Size n,
+  Selector selected,
+  OutputIterator1 out_true,
+  OutputIterator2 out_false)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  if (n == 0)
+  {
+    return thrust::make_pair(out_true, out_false);
+  }
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition(exec, n);
+
+  using index_type = std::intptr_t;
+
+  index_type num_intervals = static_cast<index_type>(decomp.size());
+
+  // counts[i] is the number of selected elements of interval i, then the number before it
+  thrust::detail::temporary_array<Size, DerivedPolicy> counts(exec, num_intervals + 1);
+  Size* raw_counts = thrust::raw_pointer_cast(counts.data());
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(thrust::system::omp::detail::team_size(exec)))
+  for (index_type i = 0; i < num_intervals; i++)
+  {
+    Size count = 0;
+    for (Size j = decomp[i].begin(); j != decomp[i].end(); ++j)
+    {
+      if (selected(j))
+      {
+        ++count;
+      }
+    }
+    raw_counts[i] = count;
+  }
+
+  Size sum = 0;
+  for (index_type i = 0; i < num_intervals; ++i)
+  {
+    Size count    = raw_counts[i];
+    raw_counts[i] = sum;
+    sum += count;
+  }
+  raw_counts[num_intervals] = sum;
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(thrust::system::omp::detail::team_size(exec)))
+  for (index_type i = 0; i < num_intervals; i++)
+  {
+    OutputIterator1 selected_out = out_true + raw_counts[i];
+    // the rejected elements before this interval are those which were not selected
+    OutputIterator2 rejected_out = out_false + (decomp[i].begin() - raw_counts[i]);
+
+    for (Size j = decomp[i].begin(); j != decomp[i].end(); ++j)
+    {
+      if (selected(j))
+      {
+        *selected_out = first[j];
+        ++selected_out;
+      }
+      else _CCCL_IF_CONSTEXPR (CopyRejected)
+      {
+        *rejected_out = first[j];
+        ++rejected_out;
+      }
+    }
+  }
+
+  return thrust::make_pair(out_true + sum, out_false + (CopyRejected ? n - sum : Size(0)));
+}
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
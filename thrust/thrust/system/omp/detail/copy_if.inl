@@ -25,7 +25,9 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
-#include <thrust/system/detail/generic/copy_if.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/system/omp/detail/compact.h>
 #include <thrust/system/omp/detail/copy_if.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -49,8 +51,9 @@ OutputIterator copy_if(
   OutputIterator result,
   Predicate pred)
 {
-  // omp prefers generic::copy_if to cpp::copy_if
-  return thrust::system::detail::generic::copy_if(exec, first, last, stencil, result, pred);
+  compact_detail::stencil_selector<InputIterator2, Predicate> selected{stencil, {pred}};
+  return compact<false>(exec, first, thrust::distance(first, last), selected, result, thrust::make_discard_iterator())
+    .first;
 } // end copy_if()
 
 } // namespace detail
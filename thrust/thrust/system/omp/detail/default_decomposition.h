@@ -30,6 +30,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/omp/detail/execution_policy.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -39,9 +40,17 @@ namespace omp
 namespace detail
 {
 
+// Decomposes [0, n) into at most one interval per thread of the team a
+// parallel region started by the calling thread would run with.
 template <typename IndexType>
 thrust::system::detail::internal::uniform_decomposition<IndexType> default_decomposition(IndexType n);
 
+// Decomposes [0, n) into at most one interval per thread of the teams exec
+// runs its algorithms with.
+template <typename DerivedPolicy, typename IndexType>
+thrust::system::detail::internal::uniform_decomposition<IndexType>
+default_decomposition(execution_policy<DerivedPolicy>& exec, IndexType n);
+
 } // end namespace detail
 } // end namespace omp
 } // end namespace system
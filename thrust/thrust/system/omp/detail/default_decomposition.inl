@@ -26,11 +26,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/system/omp/detail/default_decomposition.h>
-
-// don't attempt to #include this file without omp support
-#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-#  include <omp.h>
-#endif // omp support
+#include <thrust/system/omp/detail/parallel_settings.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -52,11 +48,16 @@ thrust::system::detail::internal::uniform_decomposition<IndexType> default_decom
     (thrust::detail::depend_on_instantiation<IndexType, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
     "OpenMP compiler support is not enabled");
 
-#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-  return thrust::system::detail::internal::uniform_decomposition<IndexType>(n, 1, omp_get_num_procs());
-#else
-  return thrust::system::detail::internal::uniform_decomposition<IndexType>(n, 1, 1);
-#endif
+  return thrust::system::detail::internal::uniform_decomposition<IndexType>(
+    n, 1, thrust::system::omp::detail::team_size(parallel_settings{}));
+}
+
+template <typename DerivedPolicy, typename IndexType>
+thrust::system::detail::internal::uniform_decomposition<IndexType>
+default_decomposition(execution_policy<DerivedPolicy>& exec, IndexType n)
+{
+  return thrust::system::detail::internal::uniform_decomposition<IndexType>(
+    n, 1, thrust::system::omp::detail::team_size(exec));
 }
 
 } // end namespace detail
@@ -0,0 +1,157 @@
+/*
+ *  Copyright 2025 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/new.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#if defined(__unix__) || defined(__APPLE__)
+#  define THRUST_OMP_FIRST_TOUCH_USE_MMAP
+#  include <sys/mman.h>
+#  include <unistd.h>
+#  if defined(__linux__)
+#    include <sys/syscall.h>
+#  endif
+#endif
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+
+/*! \p page_placement selects on which NUMA nodes the pages of the memory of
+ *  \p omp::first_touch_memory_resource and \p omp::interleaved_memory_resource
+ *  are placed.
+ */
+enum class page_placement
+{
+  first_touch, //!< every page is placed on the node of the thread which first writes to it
+  interleave //!< the pages are spread round-robin over all nodes
+};
+
+namespace detail
+{
+
+// Allocates whole pages straight from the operating system, so that none of
+// them has been touched before it is handed out, and returns them to it on
+// deallocation. On Linux, interleaved pages are bound with mbind; where that is
+// not available they are placed by first touch as well. Platforms without
+// mmap fall back to global operator new.
+template <page_placement Placement>
+class page_resource final : public thrust::mr::memory_resource<>
+{
+public:
+  void* do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+#if defined(THRUST_OMP_FIRST_TOUCH_USE_MMAP)
+    const std::size_t page = page_size();
+    bytes                  = round_up(bytes == 0 ? 1 : bytes, page);
+
+    // map enough to align the start, then unmap what is not needed
+    const std::size_t slack = alignment > page ? alignment - page : 0;
+
+    void* mapping = ::mmap(nullptr, bytes + slack, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED)
+    {
+      throw std::bad_alloc();
+    }
+
+    char* first                  = static_cast<char*>(mapping);
+    const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(first);
+    char* aligned                = first + (round_up(address, alignment) - address);
+    if (aligned != first)
+    {
+      ::munmap(first, aligned - first);
+    }
+    if (aligned + bytes != first + bytes + slack)
+    {
+      ::munmap(aligned + bytes, (first + bytes + slack) - (aligned + bytes));
+    }
+
+    _CCCL_IF_CONSTEXPR (Placement == page_placement::interleave)
+    {
+      interleave(aligned, bytes);
+    }
+
+    return aligned;
+#else
+    return m_fallback.do_allocate(bytes, alignment);
+#endif
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+#if defined(THRUST_OMP_FIRST_TOUCH_USE_MMAP)
+    (void) alignment;
+    ::munmap(p, round_up(bytes == 0 ? 1 : bytes, page_size()));
+#else
+    m_fallback.do_deallocate(p, bytes, alignment);
+#endif
+  }
+
+private:
+#if defined(THRUST_OMP_FIRST_TOUCH_USE_MMAP)
+  static std::size_t page_size()
+  {
+    static const std::size_t size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    return size;
+  }
+
+  static std::size_t round_up(std::size_t n, std::size_t multiple)
+  {
+    return (n + multiple - 1) / multiple * multiple;
+  }
+
+  static void interleave(void* p, std::size_t bytes)
+  {
+#  if defined(__linux__) && defined(SYS_mbind)
+    // MPOL_INTERLEAVE from <numaif.h>, which would add a dependency on libnuma
+    const int mpol_interleave = 3;
+    // the kernel drops the nodes which have no memory or are not allowed
+    unsigned long nodes = ~0ul;
+    // failures are ignored, the pages are then placed by first touch
+    (void) ::syscall(SYS_mbind, p, bytes, mpol_interleave, &nodes, sizeof(nodes) * 8 + 1, 0u);
+#  else
+    (void) p;
+    (void) bytes;
+#  endif
+  }
+#else
+  thrust::mr::new_delete_resource m_fallback;
+#endif
+};
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
+#undef THRUST_OMP_FIRST_TOUCH_USE_MMAP
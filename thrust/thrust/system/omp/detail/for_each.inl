@@ -30,8 +30,12 @@
 #include <thrust/distance.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/parallel_settings.h>
 #include <thrust/system/omp/detail/pragma_omp.h>
 
+#include <cstdint>
+
 THRUST_NAMESPACE_BEGIN
 namespace system
 {
@@ -41,7 +45,8 @@ namespace detail
 {
 
 template <typename DerivedPolicy, typename RandomAccessIterator, typename Size, typename UnaryFunction>
-RandomAccessIterator for_each_n(execution_policy<DerivedPolicy>&, RandomAccessIterator first, Size n, UnaryFunction f)
+RandomAccessIterator
+for_each_n(execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, Size n, UnaryFunction f)
 {
   // we're attempting to launch an omp kernel, assert we're compiling with omp support
   // ========================================================================
@@ -65,11 +70,41 @@ RandomAccessIterator for_each_n(execution_policy<DerivedPolicy>&, RandomAccessIt
   using DifferenceType    = typename thrust::iterator_difference<RandomAccessIterator>::type;
   DifferenceType signed_n = n;
 
-  THRUST_PRAGMA_OMP(parallel for)
-  for (DifferenceType i = 0; i < signed_n; ++i)
+  const parallel_settings policy_settings = thrust::system::omp::detail::settings(exec);
+
+  if (policy_settings.schedule == schedule_kind::default_schedule)
   {
-    RandomAccessIterator temp = first + i;
-    wrapped_f(*temp);
+    // Every thread processes the interval it gets in the other algorithms, so
+    // that the pages first touched here, e.g. when constructing the elements
+    // of an omp::first_touch_vector, are local to the threads reading them later.
+    thrust::system::detail::internal::uniform_decomposition<DifferenceType> decomp =
+      thrust::system::omp::detail::default_decomposition(exec, signed_n);
+
+    using index_type = std::intptr_t;
+
+    index_type num_intervals = static_cast<index_type>(decomp.size());
+
+    THRUST_PRAGMA_OMP(parallel for num_threads(thrust::system::omp::detail::team_size(exec)))
+    for (index_type i = 0; i < num_intervals; i++)
+    {
+      for (DifferenceType j = decomp[i].begin(); j != decomp[i].end(); ++j)
+      {
+        RandomAccessIterator temp = first + j;
+        wrapped_f(*temp);
+      }
+    }
+  }
+  else
+  {
+    // the loop is scheduled as the policy asks
+    schedule_scope scope(policy_settings);
+
+    THRUST_PRAGMA_OMP(parallel for num_threads(thrust::system::omp::detail::team_size(policy_settings)) schedule(runtime))
+    for (DifferenceType i = 0; i < signed_n; ++i)
+    {
+      RandomAccessIterator temp = first + i;
+      wrapped_f(*temp);
+    }
   }
 
   return first + n;
@@ -26,7 +26,13 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/allocator_aware_execution_policy.h>
+#include <thrust/detail/dependencies_aware_execution_policy.h>
+#include <thrust/detail/execute_with_allocator.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/parallel_settings.h>
+
+#include <type_traits>
+#include <utility>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -36,13 +42,113 @@ namespace omp
 namespace detail
 {
 
+template <typename Derived>
+struct execute_with_settings_base : thrust::system::omp::detail::execution_policy<Derived>
+{
+private:
+  parallel_settings m_settings;
+
+public:
+  _CCCL_HOST_DEVICE execute_with_settings_base(parallel_settings s = parallel_settings{})
+      : m_settings(s)
+  {}
+
+  // runs the algorithms with teams of n threads, or the team size of the calling thread if n is zero
+  Derived num_threads(int n) const
+  {
+    Derived result                = thrust::detail::derived_cast(*this);
+    result.m_settings.num_threads = n;
+    return result;
+  }
+
+  // runs the elementwise loops with the given schedule and chunk size
+  Derived schedule(schedule_kind kind, int chunk_size = 0) const
+  {
+    Derived result               = thrust::detail::derived_cast(*this);
+    result.m_settings.schedule   = kind;
+    result.m_settings.chunk_size = chunk_size;
+    return result;
+  }
+
+private:
+  friend _CCCL_HOST_DEVICE parallel_settings get_parallel_settings(const execute_with_settings_base& exec)
+  {
+    return exec.m_settings;
+  }
+};
+
+struct execute_with_settings : execute_with_settings_base<execute_with_settings>
+{
+  using base_t = execute_with_settings_base<execute_with_settings>;
+
+  template <typename Allocator>
+  using execute_with_allocator_type = thrust::detail::execute_with_allocator<Allocator, execute_with_settings_base>;
+
+  _CCCL_HOST_DEVICE execute_with_settings()
+      : base_t()
+  {}
+  _CCCL_HOST_DEVICE execute_with_settings(parallel_settings s)
+      : base_t(s)
+  {}
+
+  // the overloads of thrust::detail::allocator_aware_execution_policy, but the returned policies keep the settings
+
+  template <typename MemoryResource>
+  execute_with_allocator_type<thrust::mr::allocator<thrust::detail::max_align_t, MemoryResource>>
+  operator()(MemoryResource* mem_res) const
+  {
+    return with_allocator<thrust::mr::allocator<thrust::detail::max_align_t, MemoryResource>>(mem_res);
+  }
+
+  template <typename Allocator>
+  execute_with_allocator_type<Allocator&> operator()(Allocator& alloc) const
+  {
+    return with_allocator<Allocator&>(alloc);
+  }
+
+  template <typename Allocator>
+  execute_with_allocator_type<Allocator> operator()(const Allocator& alloc) const
+  {
+    return with_allocator<Allocator>(alloc);
+  }
+
+  template <typename Allocator, typename std::enable_if<!std::is_lvalue_reference<Allocator>::value>::type* = nullptr>
+  execute_with_allocator_type<Allocator> operator()(Allocator&& alloc) const
+  {
+    return with_allocator<Allocator>(std::move(alloc));
+  }
+
+private:
+  template <typename Allocator, typename Arg>
+  execute_with_allocator_type<Allocator> with_allocator(Arg&& arg) const
+  {
+    using result_t = execute_with_allocator_type<Allocator>;
+
+    return result_t(execute_with_settings_base<result_t>(get_parallel_settings(*this)),
+                    Allocator(std::forward<Arg>(arg)));
+  }
+};
+
 struct par_t
     : thrust::system::omp::detail::execution_policy<par_t>
-    , thrust::detail::allocator_aware_execution_policy<thrust::system::omp::detail::execution_policy>
+    , thrust::detail::allocator_aware_execution_policy<execute_with_settings_base>
+    , thrust::detail::dependencies_aware_execution_policy<execute_with_settings_base>
 {
   _CCCL_HOST_DEVICE constexpr par_t()
       : thrust::system::omp::detail::execution_policy<par_t>()
   {}
+
+  using settings_attachment_type = execute_with_settings;
+
+  settings_attachment_type num_threads(int n) const
+  {
+    return execute_with_settings(parallel_settings{n, schedule_kind::default_schedule, 0});
+  }
+
+  settings_attachment_type schedule(schedule_kind kind, int chunk_size = 0) const
+  {
+    return execute_with_settings(parallel_settings{0, kind, chunk_size});
+  }
 };
 
 } // namespace detail
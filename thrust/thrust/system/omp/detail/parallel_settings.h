@@ -0,0 +1,161 @@
+/*
+ *  Copyright 2025 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/omp/detail/execution_policy.h>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#  include <omp.h>
+#endif // omp support
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+
+/*! \p schedule_kind selects how the elementwise loops of the OpenMP system,
+ *  such as the one of \p thrust::for_each, are divided among the threads.
+ *  It is passed to \p thrust::omp::par.schedule().
+ */
+enum class schedule_kind
+{
+  default_schedule, //!< static scheduling with one contiguous chunk per thread
+  static_schedule, //!< <tt>schedule(static, chunk_size)</tt>
+  dynamic_schedule, //!< <tt>schedule(dynamic, chunk_size)</tt>
+  guided_schedule //!< <tt>schedule(guided, chunk_size)</tt>
+};
+
+namespace detail
+{
+
+// The settings an execution policy runs the OpenMP algorithms with. A
+// num_threads of zero stands for the team size of the calling thread and a
+// chunk_size of zero for the default chunk size of the schedule, so that
+// parallel_settings{} are the defaults. An aggregate, so that it can be
+// brace-initialized in C++11.
+struct parallel_settings
+{
+  int num_threads;
+  schedule_kind schedule;
+  int chunk_size;
+};
+
+// policies which carry no settings run with the defaults
+template <typename DerivedPolicy>
+_CCCL_HOST_DEVICE parallel_settings get_parallel_settings(execution_policy<DerivedPolicy>&)
+{
+  return parallel_settings{};
+}
+
+template <typename DerivedPolicy>
+_CCCL_HOST_DEVICE parallel_settings settings(execution_policy<DerivedPolicy>& exec)
+{
+  return get_parallel_settings(thrust::detail::derived_cast(exec));
+}
+
+// Returns the number of threads a parallel region started by the calling
+// thread would run with, following omp_set_num_threads, OMP_NUM_THREADS and
+// the nesting limit.
+inline int team_size(const parallel_settings& s)
+{
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  if (omp_get_active_level() >= omp_get_max_active_levels())
+  {
+    return 1;
+  }
+
+  return s.num_threads > 0 ? s.num_threads : omp_get_max_threads();
+#else
+  (void) s;
+  return 1;
+#endif
+}
+
+template <typename DerivedPolicy>
+int team_size(execution_policy<DerivedPolicy>& exec)
+{
+  return team_size(settings(exec));
+}
+
+// Sets the schedule of the loops declared with schedule(runtime) for its
+// lifetime, and restores the previous one afterwards.
+class schedule_scope
+{
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  omp_sched_t m_kind;
+  int m_chunk_size;
+#endif
+
+public:
+  explicit schedule_scope(const parallel_settings& s)
+  {
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    omp_get_schedule(&m_kind, &m_chunk_size);
+
+    omp_sched_t kind = omp_sched_static;
+    switch (s.schedule)
+    {
+      case schedule_kind::dynamic_schedule:
+        kind = omp_sched_dynamic;
+        break;
+      case schedule_kind::guided_schedule:
+        kind = omp_sched_guided;
+        break;
+      default:
+        break;
+    }
+
+    // a chunk size below one selects the default of the schedule
+    omp_set_schedule(kind, s.schedule == schedule_kind::default_schedule ? 0 : s.chunk_size);
+#else
+    (void) s;
+#endif
+  }
+
+  ~schedule_scope()
+  {
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    omp_set_schedule(m_kind, m_chunk_size);
+#endif
+  }
+
+  schedule_scope(const schedule_scope&)            = delete;
+  schedule_scope& operator=(const schedule_scope&) = delete;
+};
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+
+namespace omp
+{
+
+using thrust::system::omp::schedule_kind;
+
+} // end namespace omp
+THRUST_NAMESPACE_END
@@ -29,7 +29,9 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/distance.h>
 #include <thrust/system/detail/generic/partition.h>
+#include <thrust/system/omp/detail/compact.h>
 #include <thrust/system/omp/detail/partition.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -73,8 +75,7 @@ thrust::pair<OutputIterator1, OutputIterator2> stable_partition_copy(
   OutputIterator2 out_false,
   Predicate pred)
 {
-  // omp prefers generic::stable_partition_copy to cpp::stable_partition_copy
-  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, out_true, out_false, pred);
+  return thrust::system::omp::detail::stable_partition_copy(exec, first, last, first, out_true, out_false, pred);
 } // end stable_partition_copy()
 
 template <typename DerivedPolicy,
@@ -92,8 +93,8 @@ thrust::pair<OutputIterator1, OutputIterator2> stable_partition_copy(
   OutputIterator2 out_false,
   Predicate pred)
 {
-  // omp prefers generic::stable_partition_copy to cpp::stable_partition_copy
-  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, stencil, out_true, out_false, pred);
+  compact_detail::stencil_selector<InputIterator2, Predicate> selected{stencil, {pred}};
+  return compact<true>(exec, first, thrust::distance(first, last), selected, out_true, out_false);
 } // end stable_partition_copy()
 
 } // end namespace detail
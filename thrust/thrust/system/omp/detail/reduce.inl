@@ -53,7 +53,7 @@ OutputType reduce(execution_policy<DerivedPolicy>& exec,
 
   // determine first and second level decomposition
   thrust::system::detail::internal::uniform_decomposition<difference_type> decomp1 =
-    thrust::system::omp::detail::default_decomposition(n);
+    thrust::system::omp::detail::default_decomposition(exec, n);
   thrust::system::detail::internal::uniform_decomposition<difference_type> decomp2(decomp1.size() + 1, 1, 1);
 
   // allocate storage for the initializer and partial sums
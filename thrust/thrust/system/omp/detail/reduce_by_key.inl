@@ -25,10 +25,19 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
 #include <thrust/distance.h>
-#include <thrust/system/detail/generic/reduce_by_key.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
 #include <thrust/system/omp/detail/reduce_by_key.h>
 
+#include <cstdint>
+
 THRUST_NAMESPACE_BEGIN
 namespace system
 {
@@ -36,7 +45,129 @@ namespace omp
 {
 namespace detail
 {
+namespace reduce_by_key_detail
+{
+
+// Every interval of the decomposition reports how many segments end in it and,
+// if its last segment continues into the next interval (it is open), the sum
+// and the first index of that segment.
+template <typename ValueType, typename Size>
+struct interval_state
+{
+  Size count;
+  ValueType tail;
+  Size tail_start;
+  bool open;
+};
 
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename ValueType,
+          typename Size,
+          typename BinaryPredicate,
+          typename BinaryFunction,
+          typename Decomposition>
+void reduce_open_segments(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 keys,
+  InputIterator2 values,
+  Size n,
+  interval_state<ValueType, Size>* states,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op,
+  Decomposition decomp)
+{
+  using KeyType    = typename thrust::iterator_value<InputIterator1>::type;
+  using index_type = std::intptr_t;
+
+  index_type num_intervals = static_cast<index_type>(decomp.size());
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(thrust::system::omp::detail::team_size(exec)))
+  for (index_type i = 0; i < num_intervals; i++)
+  {
+    const Size begin = decomp[i].begin();
+    const Size end   = decomp[i].end();
+
+    // a segment ends at every key which is not followed by an equivalent one
+    Size count       = 0;
+    KeyType prev_key = keys[begin];
+    for (Size j = begin + 1; j < end; ++j)
+    {
+      KeyType key = keys[j];
+      if (!binary_pred(prev_key, key))
+      {
+        ++count;
+      }
+      prev_key = key;
+    }
+
+    states[i].open = end < n && binary_pred(prev_key, keys[end]);
+
+    if (states[i].open)
+    {
+      // find where the open segment starts and reduce it
+      Size start = end - 1;
+      while (start > begin && binary_pred(keys[start - 1], keys[start]))
+      {
+        --start;
+      }
+
+      ValueType sum = values[start];
+      for (Size j = start + 1; j < end; ++j)
+      {
+        sum = binary_op(sum, values[j]);
+      }
+
+      states[i].tail       = sum;
+      states[i].tail_start = start;
+    }
+    else
+    {
+      ++count;
+    }
+
+    states[i].count = count;
+  }
+}
+
+// Folds the open segment of each interval into the open segments of the
+// intervals it spans, so that each open segment's sum and start cover the
+// whole segment up to the end of its interval. Also replaces each count with
+// the number of segments which end before the interval.
+template <typename ValueType, typename Size, typename BinaryFunction, typename Decomposition>
+Size propagate_open_segments(
+  interval_state<ValueType, Size>* states, BinaryFunction binary_op, Decomposition decomp)
+{
+  using index_type = std::intptr_t;
+
+  index_type num_intervals = static_cast<index_type>(decomp.size());
+
+  Size sum = 0;
+  for (index_type i = 0; i < num_intervals; ++i)
+  {
+    Size count      = states[i].count;
+    states[i].count = sum;
+    sum += count;
+
+    if (i > 0 && states[i - 1].open && states[i].open && states[i].tail_start == decomp[i].begin())
+    {
+      states[i].tail       = binary_op(states[i - 1].tail, states[i].tail);
+      states[i].tail_start = states[i - 1].tail_start;
+    }
+  }
+
+  return sum;
+}
+
+} // end namespace reduce_by_key_detail
+
+// Reduces the segments of every interval of the default decomposition in
+// parallel. A first pass counts the segments ending in each interval and
+// reduces the segment left open at its end, a sequential pass over the P
+// intervals carries the open segments across interval boundaries, and a second
+// parallel pass writes every segment, starting from the carry of the preceding
+// interval, to its final position. Only O(P) temporary storage is used.
 template <typename DerivedPolicy,
           typename InputIterator1,
           typename InputIterator2,
@@ -54,12 +185,97 @@ thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key(
   BinaryPredicate binary_pred,
   BinaryFunction binary_op)
 {
-  // omp prefers generic::reduce_by_key to cpp::reduce_by_key
-  return thrust::system::detail::generic::reduce_by_key(
-    exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator1,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  using KeyType = typename thrust::iterator_value<InputIterator1>::type;
+  // Use the input iterator's value type per https://wg21.link/P0571
+  using ValueType  = typename thrust::iterator_value<InputIterator2>::type;
+  using Size       = typename thrust::iterator_difference<InputIterator1>::type;
+  using StateType  = reduce_by_key_detail::interval_state<ValueType, Size>;
+  using index_type = std::intptr_t;
+
+  Size n = thrust::distance(keys_first, keys_last);
+
+  if (n == 0)
+  {
+    return thrust::make_pair(keys_output, values_output);
+  }
+
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op{binary_op};
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition(exec, n);
+
+  thrust::detail::temporary_array<StateType, DerivedPolicy> states(exec, decomp.size());
+  StateType* raw_states = thrust::raw_pointer_cast(states.data());
+
+  reduce_by_key_detail::reduce_open_segments(
+    exec, keys_first, values_first, n, raw_states, binary_pred, wrapped_binary_op, decomp);
+
+  const Size num_segments = reduce_by_key_detail::propagate_open_segments(raw_states, wrapped_binary_op, decomp);
+
+  index_type num_intervals = static_cast<index_type>(decomp.size());
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(thrust::system::omp::detail::team_size(exec)))
+  for (index_type i = 0; i < num_intervals; i++)
+  {
+    const Size begin = decomp[i].begin();
+    const Size end   = decomp[i].end();
+
+    OutputIterator1 keys_out   = keys_output + raw_states[i].count;
+    OutputIterator2 values_out = values_output + raw_states[i].count;
+
+    // the first segment may continue the open segment of the preceding interval
+    const bool continues = i > 0 && raw_states[i - 1].open;
+
+    KeyType prev_key   = keys_first[begin];
+    KeyType temp_key   = continues ? KeyType(keys_first[raw_states[i - 1].tail_start]) : prev_key;
+    ValueType temp_sum = continues ? wrapped_binary_op(raw_states[i - 1].tail, values_first[begin])
+                                   : ValueType(values_first[begin]);
+
+    for (Size j = begin + 1; j < end; ++j)
+    {
+      KeyType key = keys_first[j];
+
+      if (binary_pred(prev_key, key))
+      {
+        temp_sum = wrapped_binary_op(temp_sum, values_first[j]);
+      }
+      else
+      {
+        *keys_out   = temp_key;
+        *values_out = temp_sum;
+
+        ++keys_out;
+        ++values_out;
+
+        temp_key = key;
+        temp_sum = values_first[j];
+      }
+
+      prev_key = key;
+    }
+
+    // the open segment is written by the interval it ends in
+    if (!raw_states[i].open)
+    {
+      *keys_out   = temp_key;
+      *values_out = temp_sum;
+    }
+  }
+
+  return thrust::make_pair(keys_output + num_segments, values_output + num_segments);
 } // end reduce_by_key()
 
-} // namespace detail
-} // namespace omp
-} // namespace system
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
 THRUST_NAMESPACE_END
@@ -28,6 +28,7 @@
 #include <thrust/detail/function.h>
 #include <thrust/detail/static_assert.h> // for depend_on_instantiation
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/omp/detail/parallel_settings.h>
 #include <thrust/system/omp/detail/pragma_omp.h>
 #include <thrust/system/omp/detail/reduce_intervals.h>
 
@@ -47,7 +48,7 @@ template <typename DerivedPolicy,
           typename BinaryFunction,
           typename Decomposition>
 void reduce_intervals(
-  execution_policy<DerivedPolicy>&,
+  execution_policy<DerivedPolicy>& exec,
   InputIterator input,
   OutputIterator output,
   BinaryFunction binary_op,
@@ -73,7 +74,7 @@ void reduce_intervals(
 
   index_type n = static_cast<index_type>(decomp.size());
 
-  THRUST_PRAGMA_OMP(parallel for)
+  THRUST_PRAGMA_OMP(parallel for num_threads(thrust::system::omp::detail::team_size(exec)))
   for (index_type i = 0; i < n; i++)
   {
     InputIterator begin = input + decomp[i].begin();
@@ -25,7 +25,11 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/distance.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/discard_iterator.h>
 #include <thrust/system/detail/generic/remove.h>
+#include <thrust/system/omp/detail/compact.h>
 #include <thrust/system/omp/detail/remove.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -60,8 +64,7 @@ template <typename DerivedPolicy, typename InputIterator, typename OutputIterato
 OutputIterator remove_copy_if(
   execution_policy<DerivedPolicy>& exec, InputIterator first, InputIterator last, OutputIterator result, Predicate pred)
 {
-  // omp prefers generic::remove_copy_if to cpp::remove_copy_if
-  return thrust::system::detail::generic::remove_copy_if(exec, first, last, result, pred);
+  return thrust::system::omp::detail::remove_copy_if(exec, first, last, first, result, pred);
 }
 
 template <typename DerivedPolicy,
@@ -77,8 +80,10 @@ OutputIterator remove_copy_if(
   OutputIterator result,
   Predicate pred)
 {
-  // omp prefers generic::remove_copy_if to cpp::remove_copy_if
-  return thrust::system::detail::generic::remove_copy_if(exec, first, last, stencil, result, pred);
+  using not_pred_type = decltype(thrust::not_fn(pred));
+  compact_detail::stencil_selector<InputIterator2, not_pred_type> selected{stencil, {thrust::not_fn(pred)}};
+  return compact<false>(exec, first, thrust::distance(first, last), selected, result, thrust::make_discard_iterator())
+    .first;
 }
 
 } // end namespace detail
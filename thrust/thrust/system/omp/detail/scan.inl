@@ -0,0 +1,306 @@
+/*
+ *  Copyright 2025 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/reduce_intervals.h>
+#include <thrust/system/omp/detail/scan.h>
+
+#include <cuda/std/__functional/invoke.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace scan_detail
+{
+
+// Replaces each interval sum but the first with the sum of all preceding intervals.
+template <typename ValueType, typename BinaryFunction, typename Size>
+void scan_interval_sums(ValueType* sums, Size num_intervals, BinaryFunction binary_op)
+{
+  ValueType sum = sums[0];
+
+  for (Size i = 1; i < num_intervals; ++i)
+  {
+    ValueType tmp = sums[i];
+    sums[i]       = sum;
+    sum           = binary_op(sum, tmp);
+  }
+}
+
+// Replaces each interval sum with init plus the sum of all preceding intervals.
+template <typename ValueType, typename InitialValueType, typename BinaryFunction, typename Size>
+void scan_interval_sums(ValueType* sums, Size num_intervals, InitialValueType init, BinaryFunction binary_op)
+{
+  ValueType sum = init;
+
+  for (Size i = 0; i < num_intervals; ++i)
+  {
+    ValueType tmp = sums[i];
+    sums[i]       = sum;
+    sum           = binary_op(sum, tmp);
+  }
+}
+
+template <bool HasInit,
+          typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename ValueType,
+          typename BinaryFunction,
+          typename Decomposition>
+void inclusive_scan_intervals(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator input,
+  OutputIterator output,
+  const ValueType* carries,
+  BinaryFunction binary_op,
+  Decomposition decomp)
+{
+  using index_type = std::intptr_t;
+
+  index_type n = static_cast<index_type>(decomp.size());
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(thrust::system::omp::detail::team_size(exec)))
+  for (index_type i = 0; i < n; i++)
+  {
+    InputIterator begin = input + decomp[i].begin();
+    InputIterator end   = input + decomp[i].end();
+    OutputIterator out  = output + decomp[i].begin();
+
+    if (begin != end)
+    {
+      ValueType sum = (HasInit || i > 0) ? binary_op(carries[i], *begin) : ValueType(*begin);
+
+      *out = sum;
+
+      for (++begin, ++out; begin != end; ++begin, (void) ++out)
+      {
+        *out = sum = binary_op(sum, *begin);
+      }
+    }
+  }
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename ValueType,
+          typename BinaryFunction,
+          typename Decomposition>
+void exclusive_scan_intervals(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator input,
+  OutputIterator output,
+  const ValueType* carries,
+  BinaryFunction binary_op,
+  Decomposition decomp)
+{
+  using index_type = std::intptr_t;
+
+  index_type n = static_cast<index_type>(decomp.size());
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(thrust::system::omp::detail::team_size(exec)))
+  for (index_type i = 0; i < n; i++)
+  {
+    InputIterator begin = input + decomp[i].begin();
+    InputIterator end   = input + decomp[i].end();
+    OutputIterator out  = output + decomp[i].begin();
+
+    ValueType sum = carries[i];
+
+    for (; begin != end; ++begin, (void) ++out)
+    {
+      ValueType tmp = *begin; // temporary value allows in-situ scan
+      *out          = sum;
+      sum           = binary_op(sum, tmp);
+    }
+  }
+}
+
+} // end namespace scan_detail
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename BinaryFunction>
+OutputIterator inclusive_scan(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  // Use the input iterator's value type per https://wg21.link/P0571
+  using ValueType = typename thrust::iterator_value<InputIterator>::type;
+
+  using Size = typename thrust::iterator_difference<InputIterator>::type;
+  Size n     = thrust::distance(first, last);
+
+  if (n != 0)
+  {
+    thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op{binary_op};
+
+    thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+      thrust::system::omp::detail::default_decomposition(exec, n);
+
+    // reduce each interval, then scan the interval sums to find each interval's carry-in
+    thrust::detail::temporary_array<ValueType, DerivedPolicy> carries(exec, decomp.size());
+    ValueType* raw_carries = thrust::raw_pointer_cast(carries.data());
+
+    thrust::system::omp::detail::reduce_intervals(exec, first, carries.begin(), binary_op, decomp);
+
+    scan_detail::scan_interval_sums(raw_carries, decomp.size(), wrapped_binary_op);
+
+    scan_detail::inclusive_scan_intervals<false>(exec, first, result, raw_carries, wrapped_binary_op, decomp);
+  }
+
+  return result + n;
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename InitialValueType,
+          typename BinaryFunction>
+OutputIterator inclusive_scan(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  InitialValueType init,
+  BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  // Use the input iterator's value type and the initial value type per wg21.link/p2322
+  using ValueType = typename ::cuda::std::
+    __accumulator_t<BinaryFunction, typename ::cuda::std::iterator_traits<InputIterator>::value_type, InitialValueType>;
+
+  using Size = typename thrust::iterator_difference<InputIterator>::type;
+  Size n     = thrust::distance(first, last);
+
+  if (n != 0)
+  {
+    thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op{binary_op};
+
+    thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+      thrust::system::omp::detail::default_decomposition(exec, n);
+
+    // reduce each interval, then scan the interval sums to find each interval's carry-in
+    thrust::detail::temporary_array<ValueType, DerivedPolicy> carries(exec, decomp.size());
+    ValueType* raw_carries = thrust::raw_pointer_cast(carries.data());
+
+    thrust::system::omp::detail::reduce_intervals(exec, first, carries.begin(), binary_op, decomp);
+
+    scan_detail::scan_interval_sums(raw_carries, decomp.size(), init, wrapped_binary_op);
+
+    scan_detail::inclusive_scan_intervals<true>(exec, first, result, raw_carries, wrapped_binary_op, decomp);
+  }
+
+  return result + n;
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename InitialValueType,
+          typename BinaryFunction>
+OutputIterator exclusive_scan(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  InitialValueType init,
+  BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  // Use the initial value type per https://wg21.link/P0571
+  using ValueType = InitialValueType;
+
+  using Size = typename thrust::iterator_difference<InputIterator>::type;
+  Size n     = thrust::distance(first, last);
+
+  if (n != 0)
+  {
+    thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+      thrust::system::omp::detail::default_decomposition(exec, n);
+
+    // reduce each interval, then scan the interval sums to find each interval's carry-in
+    thrust::detail::temporary_array<ValueType, DerivedPolicy> carries(exec, decomp.size());
+    ValueType* raw_carries = thrust::raw_pointer_cast(carries.data());
+
+    thrust::system::omp::detail::reduce_intervals(exec, first, carries.begin(), binary_op, decomp);
+
+    scan_detail::scan_interval_sums(raw_carries, decomp.size(), init, binary_op);
+
+    scan_detail::exclusive_scan_intervals(exec, first, result, raw_carries, binary_op, decomp);
+  }
+
+  return result + n;
+}
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,319 @@
+/*
+ *  Copyright 2025 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/scan_by_key.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace scan_by_key_detail
+{
+
+// Every interval of the decomposition reports the sum of the segment it ends
+// with (its tail), whether its first key continues the segment which ends the
+// preceding interval, and whether its tail spans the whole interval.
+template <typename ValueType>
+struct interval_state
+{
+  ValueType tail;
+  bool continues;
+  bool spans;
+};
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename ValueType,
+          typename BinaryPredicate,
+          typename BinaryFunction,
+          typename Decomposition>
+void reduce_tail_segments(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 keys,
+  InputIterator2 values,
+  interval_state<ValueType>* states,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op,
+  Decomposition decomp)
+{
+  using KeyType    = typename thrust::iterator_value<InputIterator1>::type;
+  using index_type = std::intptr_t;
+
+  index_type n = static_cast<index_type>(decomp.size());
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(thrust::system::omp::detail::team_size(exec)))
+  for (index_type i = 0; i < n; i++)
+  {
+    InputIterator1 first1 = keys + decomp[i].begin();
+    InputIterator1 last1  = keys + decomp[i].end();
+    InputIterator2 first2 = values + decomp[i].begin();
+
+    KeyType prev_key = *first1;
+    ValueType sum    = *first2;
+    bool spans       = true;
+
+    for (++first1, ++first2; first1 != last1; ++first1, (void) ++first2)
+    {
+      KeyType key     = *first1;
+      ValueType value = *first2;
+
+      if (binary_pred(prev_key, key))
+      {
+        sum = binary_op(sum, value);
+      }
+      else
+      {
+        sum   = value;
+        spans = false;
+      }
+
+      prev_key = key;
+    }
+
+    states[i].tail      = sum;
+    states[i].continues = false;
+    states[i].spans     = spans;
+
+    if (i > 0)
+    {
+      KeyType first_key     = keys[decomp[i].begin()];
+      KeyType preceding_key = keys[decomp[i].begin() - 1];
+      states[i].continues   = binary_pred(preceding_key, first_key);
+    }
+  }
+}
+
+// Folds the tail of each interval into the tails of the intervals its segment
+// continues into, so each interval's tail becomes the sum of its whole segment
+// up to the end of the interval.
+template <typename ValueType, typename BinaryFunction, typename Size>
+void propagate_tails(interval_state<ValueType>* states, Size num_intervals, BinaryFunction binary_op)
+{
+  for (Size i = 1; i < num_intervals; ++i)
+  {
+    if (states[i].continues && states[i].spans)
+    {
+      states[i].tail = binary_op(states[i - 1].tail, states[i].tail);
+    }
+  }
+}
+
+} // end namespace scan_by_key_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+OutputIterator inclusive_scan_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  OutputIterator result,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator1,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  using KeyType    = typename thrust::iterator_value<InputIterator1>::type;
+  using ValueType  = typename thrust::iterator_value<InputIterator2>::type;
+  using StateType  = scan_by_key_detail::interval_state<ValueType>;
+  using Size       = typename thrust::iterator_difference<InputIterator1>::type;
+  using index_type = std::intptr_t;
+
+  Size n = thrust::distance(first1, last1);
+
+  if (n != 0)
+  {
+    // wrap binary_op
+    thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op{binary_op};
+
+    thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+      thrust::system::omp::detail::default_decomposition(exec, n);
+
+    thrust::detail::temporary_array<StateType, DerivedPolicy> states(exec, decomp.size());
+    StateType* raw_states = thrust::raw_pointer_cast(states.data());
+
+    scan_by_key_detail::reduce_tail_segments(exec, first1, first2, raw_states, binary_pred, wrapped_binary_op, decomp);
+
+    scan_by_key_detail::propagate_tails(raw_states, decomp.size(), wrapped_binary_op);
+
+    index_type num_intervals = static_cast<index_type>(decomp.size());
+
+    THRUST_PRAGMA_OMP(parallel for num_threads(thrust::system::omp::detail::team_size(exec)))
+    for (index_type i = 0; i < num_intervals; i++)
+    {
+      InputIterator1 keys   = first1 + decomp[i].begin();
+      InputIterator1 end    = first1 + decomp[i].end();
+      InputIterator2 values = first2 + decomp[i].begin();
+      OutputIterator out    = result + decomp[i].begin();
+
+      KeyType prev_key     = *keys;
+      ValueType prev_value = raw_states[i].continues
+                             ? wrapped_binary_op(raw_states[i - 1].tail, *values)
+                             : ValueType(*values);
+
+      *out = prev_value;
+
+      for (++keys, ++values, ++out; keys != end; ++keys, (void) ++values, (void) ++out)
+      {
+        KeyType key = *keys;
+
+        if (binary_pred(prev_key, key))
+        {
+          *out = prev_value = wrapped_binary_op(prev_value, *values);
+        }
+        else
+        {
+          *out = prev_value = *values;
+        }
+
+        prev_key = key;
+      }
+    }
+  }
+
+  return result + n;
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename T,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+OutputIterator exclusive_scan_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  OutputIterator result,
+  T init,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator1,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  using KeyType    = typename thrust::iterator_value<InputIterator1>::type;
+  using ValueType  = T;
+  using StateType  = scan_by_key_detail::interval_state<ValueType>;
+  using Size       = typename thrust::iterator_difference<InputIterator1>::type;
+  using index_type = std::intptr_t;
+
+  Size n = thrust::distance(first1, last1);
+
+  if (n != 0)
+  {
+    thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+      thrust::system::omp::detail::default_decomposition(exec, n);
+
+    thrust::detail::temporary_array<StateType, DerivedPolicy> states(exec, decomp.size());
+    StateType* raw_states = thrust::raw_pointer_cast(states.data());
+
+    scan_by_key_detail::reduce_tail_segments(exec, first1, first2, raw_states, binary_pred, binary_op, decomp);
+
+    scan_by_key_detail::propagate_tails(raw_states, decomp.size(), binary_op);
+
+    index_type num_intervals = static_cast<index_type>(decomp.size());
+
+    THRUST_PRAGMA_OMP(parallel for num_threads(thrust::system::omp::detail::team_size(exec)))
+    for (index_type i = 0; i < num_intervals; i++)
+    {
+      InputIterator1 keys   = first1 + decomp[i].begin();
+      InputIterator1 end    = first1 + decomp[i].end();
+      InputIterator2 values = first2 + decomp[i].begin();
+      OutputIterator out    = result + decomp[i].begin();
+
+      KeyType temp_key     = *keys;
+      ValueType temp_value = *values;
+
+      ValueType next = raw_states[i].continues ? binary_op(init, raw_states[i - 1].tail) : init;
+
+      *out = next;
+
+      next = binary_op(next, temp_value);
+
+      for (++keys, ++values, ++out; keys != end; ++keys, (void) ++values, (void) ++out)
+      {
+        KeyType key = *keys;
+
+        // use temp to permit in-place scans
+        temp_value = *values;
+
+        if (!binary_pred(temp_key, key))
+        {
+          next = init; // reset sum
+        }
+
+        *out = next;
+        next = binary_op(next, temp_value);
+
+        temp_key = key;
+      }
+    }
+  }
+
+  return result + n;
+}
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,237 @@
+/*
+ *  Copyright 2025 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/merge_path.h>
+#include <thrust/system/detail/internal/set_operations.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/set_operations.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace set_operations_detail
+{
+
+// Splits both inputs into one piece per interval of the merged input, counts
+// the output of every piece in parallel, scans the counts to find each piece's
+// output offset, and finally applies the set operation to every piece in
+// parallel.
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering,
+          typename SetOperation>
+OutputIterator set_operation(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp,
+  SetOperation set_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator1,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  using Size = typename thrust::iterator_difference<InputIterator1>::type;
+
+  const Size n1 = thrust::distance(first1, last1);
+  const Size n2 = static_cast<Size>(thrust::distance(first2, last2));
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition(exec, n1 + n2);
+
+  if (decomp.size() <= 1)
+  {
+    return set_op(first1, last1, first2, last2, result, comp);
+  }
+
+  using index_type = std::intptr_t;
+
+  index_type num_intervals = static_cast<index_type>(decomp.size());
+
+  // splits[i] is where piece i begins in both inputs; counts[i] is the size of its output
+  thrust::detail::temporary_array<thrust::pair<Size, Size>, DerivedPolicy> splits(exec, num_intervals + 1);
+  thrust::detail::temporary_array<Size, DerivedPolicy> counts(exec, num_intervals + 1);
+
+  thrust::pair<Size, Size>* raw_splits = thrust::raw_pointer_cast(splits.data());
+  Size* raw_counts                     = thrust::raw_pointer_cast(counts.data());
+
+  raw_splits[num_intervals] = thrust::make_pair(n1, n2);
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(thrust::system::omp::detail::team_size(exec)))
+  for (index_type i = 0; i < num_intervals; i++)
+  {
+    raw_splits[i] =
+      thrust::system::detail::internal::set_operation_path(first1, n1, first2, n2, decomp[i].begin(), comp);
+  }
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(thrust::system::omp::detail::team_size(exec)))
+  for (index_type i = 0; i < num_intervals; i++)
+  {
+    thrust::discard_iterator<> counter = set_op(
+      first1 + raw_splits[i].first,
+      first1 + raw_splits[i + 1].first,
+      first2 + raw_splits[i].second,
+      first2 + raw_splits[i + 1].second,
+      thrust::make_discard_iterator(),
+      comp);
+
+    raw_counts[i] = counter - thrust::make_discard_iterator();
+  }
+
+  // scan the counts to get each piece's output offset
+  Size sum = 0;
+  for (index_type i = 0; i < num_intervals; ++i)
+  {
+    Size count    = raw_counts[i];
+    raw_counts[i] = sum;
+    sum += count;
+  }
+  raw_counts[num_intervals] = sum;
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(thrust::system::omp::detail::team_size(exec)))
+  for (index_type i = 0; i < num_intervals; i++)
+  {
+    set_op(first1 + raw_splits[i].first,
+           first1 + raw_splits[i + 1].first,
+           first2 + raw_splits[i].second,
+           first2 + raw_splits[i + 1].second,
+           result + raw_counts[i],
+           comp);
+  }
+
+  return result + raw_counts[num_intervals];
+}
+
+} // end namespace set_operations_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::set_difference_functor());
+} // end set_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_intersection(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::set_intersection_functor());
+} // end set_intersection()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_symmetric_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec,
+    first1,
+    last1,
+    first2,
+    last2,
+    result,
+    comp,
+    thrust::system::detail::internal::set_symmetric_difference_functor());
+} // end set_symmetric_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_union(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::set_union_functor());
+} // end set_union()
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -31,13 +31,24 @@
 #  include <omp.h>
 #endif // omp support
 
+#include <thrust/copy.h>
+#include <thrust/detail/minmax.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
 #include <thrust/sort.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/merge_path.h>
+#include <thrust/system/detail/internal/radix_sort.h>
+#include <thrust/system/detail/sequential/sort.h>
+#include <thrust/system/detail/sequential/stable_merge_sort.h>
 #include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cstddef>
+#include <cstdint>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -49,76 +60,323 @@ namespace detail
 namespace sort_detail
 {
 
+using thrust::system::detail::sequential::sort_detail::needs_reverse;
+using thrust::system::detail::sequential::sort_detail::use_primitive_sort;
+
+// inputs shorter than this are sorted sequentially by comparison instead of radix sorted
+// XXX this value is a tuning opportunity
+const std::ptrdiff_t comparison_sort_threshold = 512;
+
+template <typename Decomposition>
+typename Decomposition::index_type
+run_boundary(const Decomposition& tiles, typename Decomposition::index_type tile, typename Decomposition::index_type n)
+{
+  return tile < tiles.size() ? tiles[tile].begin() : n;
+}
+
+// Merges adjacent pairs of sorted runs of run_width tiles each from src into dst.
+// Rather than assigning whole pairs to threads, the output is split into one
+// equal slice per thread and each thread locates the boundaries of its slice in
+// the inputs with a merge path search, so every round keeps all threads busy.
+template <typename Iterator1, typename Iterator2, typename Decomposition, typename StrictWeakOrdering>
+void merge_runs(Iterator1 src,
+                Iterator2 dst,
+                const Decomposition& tiles,
+                typename Decomposition::index_type n,
+                typename Decomposition::index_type run_width,
+                typename Decomposition::index_type p_i,
+                StrictWeakOrdering comp)
+{
+  using IndexType = typename Decomposition::index_type;
+
+  if (p_i >= tiles.size())
+  {
+    return;
+  }
+
+  const IndexType slice_begin = tiles[p_i].begin();
+  const IndexType slice_end   = tiles[p_i].end();
+
+  for (IndexType tile = 0; tile < tiles.size(); tile += 2 * run_width)
+  {
+    const IndexType pair_begin = run_boundary(tiles, tile, n);
+    const IndexType pair_mid   = run_boundary(tiles, tile + run_width, n);
+    const IndexType pair_end   = run_boundary(tiles, tile + 2 * run_width, n);
+
+    if (pair_end <= slice_begin)
+    {
+      continue;
+    }
+
+    if (pair_begin >= slice_end)
+    {
+      break;
+    }
+
+    const IndexType lo = (thrust::max)(slice_begin, pair_begin) - pair_begin;
+    const IndexType hi = (thrust::min)(slice_end, pair_end) - pair_begin;
+
+    Iterator1 a             = src + pair_begin;
+    Iterator1 b             = src + pair_mid;
+    const IndexType a_count = pair_mid - pair_begin;
+    const IndexType b_count = pair_end - pair_mid;
+
+    const IndexType a_lo = thrust::system::detail::internal::merge_path(a, a_count, b, b_count, lo, comp);
+    const IndexType a_hi = thrust::system::detail::internal::merge_path(a, a_count, b, b_count, hi, comp);
+
+    thrust::merge(thrust::seq, a + a_lo, a + a_hi, b + (lo - a_lo), b + (hi - a_hi), dst + pair_begin + lo, comp);
+  }
+}
+
+template <typename Iterator1,
+          typename Iterator2,
+          typename Iterator3,
+          typename Iterator4,
+          typename Decomposition,
+          typename StrictWeakOrdering>
+void merge_runs_by_key(
+  Iterator1 keys_src,
+  Iterator2 values_src,
+  Iterator3 keys_dst,
+  Iterator4 values_dst,
+  const Decomposition& tiles,
+  typename Decomposition::index_type n,
+  typename Decomposition::index_type run_width,
+  typename Decomposition::index_type p_i,
+  StrictWeakOrdering comp)
+{
+  using IndexType = typename Decomposition::index_type;
+
+  if (p_i >= tiles.size())
+  {
+    return;
+  }
+
+  const IndexType slice_begin = tiles[p_i].begin();
+  const IndexType slice_end   = tiles[p_i].end();
+
+  for (IndexType tile = 0; tile < tiles.size(); tile += 2 * run_width)
+  {
+    const IndexType pair_begin = run_boundary(tiles, tile, n);
+    const IndexType pair_mid   = run_boundary(tiles, tile + run_width, n);
+    const IndexType pair_end   = run_boundary(tiles, tile + 2 * run_width, n);
+
+    if (pair_end <= slice_begin)
+    {
+      continue;
+    }
+
+    if (pair_begin >= slice_end)
+    {
+      break;
+    }
+
+    const IndexType lo = (thrust::max)(slice_begin, pair_begin) - pair_begin;
+    const IndexType hi = (thrust::min)(slice_end, pair_end) - pair_begin;
+
+    Iterator1 a             = keys_src + pair_begin;
+    Iterator1 b             = keys_src + pair_mid;
+    Iterator2 a_values      = values_src + pair_begin;
+    Iterator2 b_values      = values_src + pair_mid;
+    const IndexType a_count = pair_mid - pair_begin;
+    const IndexType b_count = pair_end - pair_mid;
+
+    const IndexType a_lo = thrust::system::detail::internal::merge_path(a, a_count, b, b_count, lo, comp);
+    const IndexType a_hi = thrust::system::detail::internal::merge_path(a, a_count, b, b_count, hi, comp);
+
+    thrust::merge_by_key(
+      thrust::seq,
+      a + a_lo,
+      a + a_hi,
+      b + (lo - a_lo),
+      b + (hi - a_hi),
+      a_values + a_lo,
+      b_values + (lo - a_lo),
+      keys_dst + pair_begin + lo,
+      values_dst + pair_begin + lo,
+      comp);
+  }
+}
+
+template <bool Descending,
+          bool HasValues,
+          typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename Size>
+void radix_sort(execution_policy<DerivedPolicy>& exec, RandomAccessIterator1 keys, RandomAccessIterator2 values, Size n)
+{
+  using key_type   = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  using value_type = typename thrust::iterator_value<RandomAccessIterator2>::type;
+  using digit_type = thrust::system::detail::internal::radix_digit<key_type, Descending>;
+  using index_type = std::intptr_t;
+
+  const unsigned int num_buckets = digit_type::num_buckets;
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition(exec, n);
+
+  const index_type num_tiles = static_cast<index_type>(decomp.size());
+
+  // every element of the buffers is written by the first pass that is not skipped
+  thrust::detail::temporary_array<key_type, DerivedPolicy> keys_buffer(thrust::default_init, exec, n);
+  thrust::detail::temporary_array<value_type, DerivedPolicy> values_buffer(
+    thrust::default_init, exec, HasValues ? n : 0);
+
+  // one histogram per tile, stored tile by tile
+  thrust::detail::temporary_array<std::size_t, DerivedPolicy> histograms(exec, num_tiles * num_buckets);
+  std::size_t* raw_histograms = thrust::raw_pointer_cast(histograms.data());
+
+  bool in_buffer = false;
+
+  for (unsigned int pass = 0; pass < digit_type::num_passes; pass++)
+  {
+    const digit_type digit(pass);
+
+    THRUST_PRAGMA_OMP(parallel for num_threads(thrust::system::omp::detail::team_size(exec)))
+    for (index_type i = 0; i < num_tiles; i++)
+    {
+      if (in_buffer)
+      {
+        thrust::system::detail::internal::radix_histogram(
+          keys_buffer.begin() + decomp[i].begin(), decomp[i].size(), digit, raw_histograms + i * num_buckets);
+      }
+      else
+      {
+        thrust::system::detail::internal::radix_histogram(
+          keys + decomp[i].begin(), decomp[i].size(), digit, raw_histograms + i * num_buckets);
+      }
+    }
+
+    // skip the pass if every key shares the same digit
+    if (!thrust::system::detail::internal::radix_scan_histograms<digit_type::num_buckets>(
+          raw_histograms, num_tiles, static_cast<std::size_t>(n)))
+    {
+      continue;
+    }
+
+    THRUST_PRAGMA_OMP(parallel for num_threads(thrust::system::omp::detail::team_size(exec)))
+    for (index_type i = 0; i < num_tiles; i++)
+    {
+      const Size begin     = decomp[i].begin();
+      std::size_t* offsets = raw_histograms + i * num_buckets;
+
+      if (in_buffer)
+      {
+        if (HasValues)
+        {
+          thrust::system::detail::internal::radix_scatter(
+            keys_buffer.begin() + begin, values_buffer.begin() + begin, decomp[i].size(), keys, values, digit, offsets);
+        }
+        else
+        {
+          thrust::system::detail::internal::radix_scatter(
+            keys_buffer.begin() + begin, decomp[i].size(), keys, digit, offsets);
+        }
+      }
+      else
+      {
+        if (HasValues)
+        {
+          thrust::system::detail::internal::radix_scatter(
+            keys + begin, values + begin, decomp[i].size(), keys_buffer.begin(), values_buffer.begin(), digit, offsets);
+        }
+        else
+        {
+          thrust::system::detail::internal::radix_scatter(
+            keys + begin, decomp[i].size(), keys_buffer.begin(), digit, offsets);
+        }
+      }
+    }
+
+    in_buffer = !in_buffer;
+  }
+
+  // ensure the result ends up in the input range
+  if (in_buffer)
+  {
+    thrust::copy(exec, keys_buffer.begin(), keys_buffer.end(), keys);
+
+    if (HasValues)
+    {
+      thrust::copy(exec, values_buffer.begin(), values_buffer.end(), values);
+    }
+  }
+}
+
 template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
-void inplace_merge(execution_policy<DerivedPolicy>& exec,
-                   RandomAccessIterator first,
-                   RandomAccessIterator middle,
-                   RandomAccessIterator last,
-                   StrictWeakOrdering comp)
+void stable_sort(execution_policy<DerivedPolicy>& exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp,
+                 thrust::detail::true_type)
 {
-  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+  using key_type = typename thrust::iterator_value<RandomAccessIterator>::type;
 
-  thrust::detail::temporary_array<value_type, DerivedPolicy> a(exec, first, middle);
-  thrust::detail::temporary_array<value_type, DerivedPolicy> b(exec, middle, last);
+  if (last - first < comparison_sort_threshold)
+  {
+    // short inputs are not worth a histogram pass
+    thrust::detail::seq_t seq;
+    thrust::system::detail::sequential::stable_merge_sort(seq, first, last, comp);
+    return;
+  }
 
-  thrust::merge(thrust::seq, a.begin(), a.end(), b.begin(), b.end(), first, comp);
+  // radix sort keys in descending order directly to preserve stability
+  sort_detail::radix_sort<needs_reverse<key_type, StrictWeakOrdering>::value, false>(
+    exec, first, static_cast<key_type*>(0), last - first);
 }
 
 template <typename DerivedPolicy,
           typename RandomAccessIterator1,
           typename RandomAccessIterator2,
           typename StrictWeakOrdering>
-void inplace_merge_by_key(
+void stable_sort_by_key(
   execution_policy<DerivedPolicy>& exec,
-  RandomAccessIterator1 first1,
-  RandomAccessIterator1 middle1,
-  RandomAccessIterator1 last1,
-  RandomAccessIterator2 first2,
-  StrictWeakOrdering comp)
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp,
+  thrust::detail::true_type)
 {
-  using value_type1 = typename thrust::iterator_value<RandomAccessIterator1>::type;
-  using value_type2 = typename thrust::iterator_value<RandomAccessIterator2>::type;
+  using key_type = typename thrust::iterator_value<RandomAccessIterator1>::type;
 
-  RandomAccessIterator2 middle2 = first2 + (middle1 - first1);
-  RandomAccessIterator2 last2   = first2 + (last1 - first1);
-
-  thrust::detail::temporary_array<value_type1, DerivedPolicy> lhs1(exec, first1, middle1);
-  thrust::detail::temporary_array<value_type1, DerivedPolicy> rhs1(exec, middle1, last1);
-  thrust::detail::temporary_array<value_type2, DerivedPolicy> lhs2(exec, first2, middle2);
-  thrust::detail::temporary_array<value_type2, DerivedPolicy> rhs2(exec, middle2, last2);
+  if (keys_last - keys_first < comparison_sort_threshold)
+  {
+    // short inputs are not worth a histogram pass
+    thrust::detail::seq_t seq;
+    thrust::system::detail::sequential::stable_merge_sort_by_key(seq, keys_first, keys_last, values_first, comp);
+    return;
+  }
 
-  thrust::merge_by_key(
-    thrust::seq, lhs1.begin(), lhs1.end(), rhs1.begin(), rhs1.end(), lhs2.begin(), rhs2.begin(), first1, first2, comp);
+  sort_detail::radix_sort<needs_reverse<key_type, StrictWeakOrdering>::value, true>(
+    exec, keys_first, values_first, keys_last - keys_first);
 }
 
-} // namespace sort_detail
-
 template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
-void stable_sort(
-  execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
+void stable_sort(execution_policy<DerivedPolicy>& exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp,
+                 thrust::detail::false_type)
 {
-  // we're attempting to launch an omp kernel, assert we're compiling with omp support
-  // ========================================================================
-  // X Note to the user: If you've found this line due to a compiler error, X
-  // X you need to enable OpenMP support in your compiler.                  X
-  // ========================================================================
-  THRUST_STATIC_ASSERT_MSG(
-    (thrust::detail::depend_on_instantiation<RandomAccessIterator,
-                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
-    "OpenMP compiler support is not enabled");
-
   // Avoid issues on compilers that don't provide `omp_get_num_threads()`.
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-  using IndexType = typename thrust::iterator_difference<RandomAccessIterator>::type;
+  using IndexType  = typename thrust::iterator_difference<RandomAccessIterator>::type;
+  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
 
   if (first == last)
   {
     return;
   }
 
-  THRUST_PRAGMA_OMP(parallel)
+  const IndexType n = last - first;
+
+  // a single ping-pong buffer serves every merge round
+  thrust::detail::temporary_array<value_type, DerivedPolicy> buffer(exec, n);
+
+  THRUST_PRAGMA_OMP(parallel num_threads(thrust::system::omp::detail::team_size(exec)))
   {
-    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(last - first, 1, omp_get_num_threads());
+    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(n, 1, omp_get_num_threads());
 
     // process id
     IndexType p_i = omp_get_thread_num();
@@ -134,33 +392,32 @@ void stable_sort(
     // XXX For some reason, MSVC 2015 yields an error unless we include this meaningless semicolon here
     ;
 
-    IndexType nseg = decomp.size();
-    IndexType h    = 2;
-
-    // keep track of which sub-range we're processing
-    IndexType a = p_i, b = p_i, c = p_i + 1;
+    bool in_buffer = false;
 
-    while (nseg > 1)
+    for (IndexType run_width = 1; run_width < decomp.size(); run_width *= 2)
     {
-      if (c >= decomp.size())
+      if (in_buffer)
       {
-        c = decomp.size() - 1;
+        sort_detail::merge_runs(buffer.begin(), first, decomp, n, run_width, p_i, comp);
       }
-
-      if ((p_i % h) == 0 && c > b)
+      else
       {
-        sort_detail::inplace_merge(
-          exec, first + decomp[a].begin(), first + decomp[b].end(), first + decomp[c].end(), comp);
-
-        b = c;
-        c += h;
+        sort_detail::merge_runs(first, buffer.begin(), decomp, n, run_width, p_i, comp);
       }
 
-      nseg = (nseg + 1) / 2;
-      h *= 2;
+      in_buffer = !in_buffer;
 
       THRUST_PRAGMA_OMP(barrier)
     }
+
+    // every thread copies its own slice of the result back
+    if (in_buffer && p_i < decomp.size())
+    {
+      thrust::copy(thrust::seq,
+                   buffer.begin() + decomp[p_i].begin(),
+                   buffer.begin() + decomp[p_i].end(),
+                   first + decomp[p_i].begin());
+    }
   }
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
@@ -174,31 +431,29 @@ void stable_sort_by_key(
   RandomAccessIterator1 keys_first,
   RandomAccessIterator1 keys_last,
   RandomAccessIterator2 values_first,
-  StrictWeakOrdering comp)
+  StrictWeakOrdering comp,
+  thrust::detail::false_type)
 {
-  // we're attempting to launch an omp kernel, assert we're compiling with omp support
-  // ========================================================================
-  // X Note to the user: If you've found this line due to a compiler error, X
-  // X you need to enable OpenMP support in your compiler.                  X
-  // ========================================================================
-  THRUST_STATIC_ASSERT_MSG(
-    (thrust::detail::depend_on_instantiation<RandomAccessIterator1,
-                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
-    "OpenMP compiler support is not enabled");
-
   // Avoid issues on compilers that don't provide `omp_get_num_threads()`.
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-  using IndexType = typename thrust::iterator_difference<RandomAccessIterator1>::type;
+  using IndexType  = typename thrust::iterator_difference<RandomAccessIterator1>::type;
+  using key_type   = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  using value_type = typename thrust::iterator_value<RandomAccessIterator2>::type;
 
   if (keys_first == keys_last)
   {
     return;
   }
 
-  THRUST_PRAGMA_OMP(parallel)
+  const IndexType n = keys_last - keys_first;
+
+  // a single pair of ping-pong buffers serves every merge round
+  thrust::detail::temporary_array<key_type, DerivedPolicy> keys_buffer(exec, n);
+  thrust::detail::temporary_array<value_type, DerivedPolicy> values_buffer(exec, n);
+
+  THRUST_PRAGMA_OMP(parallel num_threads(thrust::system::omp::detail::team_size(exec)))
   {
-    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(
-      keys_last - keys_first, 1, omp_get_num_threads());
+    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(n, 1, omp_get_num_threads());
 
     // process id
     IndexType p_i = omp_get_thread_num();
@@ -219,42 +474,91 @@ void stable_sort_by_key(
     // XXX For some reason, MSVC 2015 yields an error unless we include this meaningless semicolon here
     ;
 
-    IndexType nseg = decomp.size();
-    IndexType h    = 2;
-
-    // keep track of which sub-range we're processing
-    IndexType a = p_i, b = p_i, c = p_i + 1;
+    bool in_buffer = false;
 
-    while (nseg > 1)
+    for (IndexType run_width = 1; run_width < decomp.size(); run_width *= 2)
     {
-      if (c >= decomp.size())
+      if (in_buffer)
       {
-        c = decomp.size() - 1;
+        sort_detail::merge_runs_by_key(
+          keys_buffer.begin(), values_buffer.begin(), keys_first, values_first, decomp, n, run_width, p_i, comp);
       }
-
-      if ((p_i % h) == 0 && c > b)
+      else
       {
-        sort_detail::inplace_merge_by_key(
-          exec,
-          keys_first + decomp[a].begin(),
-          keys_first + decomp[b].end(),
-          keys_first + decomp[c].end(),
-          values_first + decomp[a].begin(),
-          comp);
-
-        b = c;
-        c += h;
+        sort_detail::merge_runs_by_key(
+          keys_first, values_first, keys_buffer.begin(), values_buffer.begin(), decomp, n, run_width, p_i, comp);
       }
 
-      nseg = (nseg + 1) / 2;
-      h *= 2;
+      in_buffer = !in_buffer;
 
       THRUST_PRAGMA_OMP(barrier)
     }
+
+    // every thread copies its own slice of the result back
+    if (in_buffer && p_i < decomp.size())
+    {
+      thrust::copy(thrust::seq,
+                   keys_buffer.begin() + decomp[p_i].begin(),
+                   keys_buffer.begin() + decomp[p_i].end(),
+                   keys_first + decomp[p_i].begin());
+      thrust::copy(thrust::seq,
+                   values_buffer.begin() + decomp[p_i].begin(),
+                   values_buffer.begin() + decomp[p_i].end(),
+                   values_first + decomp[p_i].begin());
+    }
   }
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
 
+} // namespace sort_detail
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void stable_sort(
+  execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<RandomAccessIterator,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  using key_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  sort_detail::use_primitive_sort<key_type, StrictWeakOrdering> use_primitive_sort;
+  sort_detail::stable_sort(exec, first, last, comp, use_primitive_sort);
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void stable_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<RandomAccessIterator1,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  using key_type = typename thrust::iterator_value<RandomAccessIterator1>::type;
+
+  sort_detail::use_primitive_sort<key_type, StrictWeakOrdering> use_primitive_sort;
+  sort_detail::stable_sort_by_key(exec, keys_first, keys_last, values_first, comp, use_primitive_sort);
+}
+
 } // end namespace detail
 } // end namespace omp
 } // end namespace system
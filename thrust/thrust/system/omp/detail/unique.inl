@@ -25,8 +25,11 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/distance.h>
+#include <thrust/iterator/discard_iterator.h>
 #include <thrust/pair.h>
 #include <thrust/system/detail/generic/unique.h>
+#include <thrust/system/omp/detail/compact.h>
 #include <thrust/system/omp/detail/unique.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -53,8 +56,9 @@ OutputIterator unique_copy(
   OutputIterator output,
   BinaryPredicate binary_pred)
 {
-  // omp prefers generic::unique_copy to cpp::unique_copy
-  return thrust::system::detail::generic::unique_copy(exec, first, last, output, binary_pred);
+  compact_detail::unique_selector<InputIterator, BinaryPredicate> selected{first, {binary_pred}};
+  return compact<false>(exec, first, thrust::distance(first, last), selected, output, thrust::make_discard_iterator())
+    .first;
 } // end unique_copy()
 
 template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
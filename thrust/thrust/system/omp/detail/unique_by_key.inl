@@ -25,8 +25,12 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/distance.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
 #include <thrust/pair.h>
 #include <thrust/system/detail/generic/unique_by_key.h>
+#include <thrust/system/omp/detail/compact.h>
 #include <thrust/system/omp/detail/unique_by_key.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -64,9 +68,18 @@ thrust::pair<OutputIterator1, OutputIterator2> unique_by_key_copy(
   OutputIterator2 values_output,
   BinaryPredicate binary_pred)
 {
-  // omp prefers generic::unique_by_key_copy to cpp::unique_by_key_copy
-  return thrust::system::detail::generic::unique_by_key_copy(
-    exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred);
+  compact_detail::unique_selector<InputIterator1, BinaryPredicate> selected{keys_first, {binary_pred}};
+
+  auto result = thrust::system::omp::detail::compact<false>(
+    exec,
+    thrust::make_zip_iterator(thrust::make_tuple(keys_first, values_first)),
+    thrust::distance(keys_first, keys_last),
+    selected,
+    thrust::make_zip_iterator(thrust::make_tuple(keys_output, values_output)),
+    thrust::make_discard_iterator());
+
+  return thrust::make_pair(thrust::get<0>(result.first.get_iterator_tuple()),
+                           thrust::get<1>(result.first.get_iterator_tuple()));
 } // end unique_by_key_copy()
 
 } // end namespace detail
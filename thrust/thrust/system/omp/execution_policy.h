@@ -80,6 +80,16 @@
 #include <thrust/system/omp/detail/unique.h>
 #include <thrust/system/omp/detail/unique_by_key.h>
 
+// and the asynchronous ones, which require C++14
+#if _CCCL_STD_VER >= 2014
+#  include <thrust/system/omp/detail/async/copy.h>
+#  include <thrust/system/omp/detail/async/for_each.h>
+#  include <thrust/system/omp/detail/async/reduce.h>
+#  include <thrust/system/omp/detail/async/scan.h>
+#  include <thrust/system/omp/detail/async/sort.h>
+#  include <thrust/system/omp/detail/async/transform.h>
+#endif // C++14
+
 // define these entities here for the purpose of Doxygenating them
 // they are actually defined elsewhere
 #if 0
@@ -146,6 +156,16 @@ struct tag : thrust::system::omp::execution_policy<tag> { unspecified };
  *
  *  // 0 1 2 is printed to standard output in some unspecified order
  *  \endcode
+ *
+ *  By default, the algorithms run with the team size of the calling thread, as set by
+ *  \p omp_set_num_threads or \p OMP_NUM_THREADS. \p par.num_threads(n) runs them with teams of
+ *  \p n threads instead, and \p par.schedule(kind, chunk_size) selects the \p schedule_kind of
+ *  their elementwise loops. Both may be combined with each other and with an allocator:
+ *
+ *  \code
+ *  thrust::for_each(thrust::omp::par(alloc).num_threads(16).schedule(thrust::omp::schedule_kind::dynamic_schedule, 4096),
+ *                   vec.begin(), vec.end(), printf_functor());
+ *  \endcode
  */
 static const unspecified par;
 
@@ -0,0 +1,212 @@
+/*
+ *  Copyright 2025 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file thrust/system/omp/future.h
+ *  \brief `thrust::event` and `thrust::future` of the OpenMP system.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cpp14_required.h>
+
+#if _CCCL_STD_VER >= 2014
+
+#  include <thrust/detail/host_async.h>
+#  include <thrust/system/omp/detail/execution_policy.h>
+#  include <thrust/type_traits/remove_cvref.h>
+
+#  include <algorithm>
+#  include <condition_variable>
+#  include <cstddef>
+#  include <deque>
+#  include <functional>
+#  include <future>
+#  include <memory>
+#  include <mutex>
+#  include <thread>
+#  include <utility>
+#  include <vector>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+// OpenMP tasks cannot outlive the parallel region which created them, so the
+// asynchronous operations are queued for a few threads of their own, whose
+// parallel regions start teams of their own. The threads are started as the
+// operations need them, up to one per processor, and kept for later operations,
+// so that their teams are reused too. An operation only enters the queue once
+// its dependencies on this system have completed, so it never waits for an
+// operation behind it in the queue.
+class async_queue
+{
+  std::mutex mutex_;
+  std::condition_variable ready_;
+  std::deque<std::function<void()>> queue_;
+  std::vector<std::thread> threads_;
+  std::size_t idle_ = 0;
+  bool stopping_    = false;
+
+  void work()
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;)
+    {
+      ++idle_;
+      ready_.wait(lock, [this] {
+        return stopping_ || !queue_.empty();
+      });
+      --idle_;
+
+      if (queue_.empty())
+      {
+        return;
+      }
+
+      std::function<void()> f = std::move(queue_.front());
+      queue_.pop_front();
+
+      lock.unlock();
+      f();
+      f = nullptr;
+      lock.lock();
+    }
+  }
+
+public:
+  async_queue() = default;
+
+  async_queue(async_queue const&)            = delete;
+  async_queue& operator=(async_queue const&) = delete;
+
+  ~async_queue()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    ready_.notify_all();
+
+    for (auto& thread : threads_)
+    {
+      thread.join();
+    }
+  }
+
+  static async_queue& get()
+  {
+    static async_queue queue;
+    return queue;
+  }
+
+  void push(std::function<void()> f)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      queue_.push_back(std::move(f));
+
+      const std::size_t max_threads = (std::max)(std::thread::hardware_concurrency(), 1u);
+      if (idle_ < queue_.size() && threads_.size() < max_threads)
+      {
+        threads_.emplace_back([this] {
+          work();
+        });
+      }
+    }
+    ready_.notify_one();
+  }
+};
+
+class async_task
+{
+  std::future<void> done_;
+
+public:
+  template <typename F>
+  _CCCL_HOST void run(F&& f)
+  {
+    auto done = std::make_shared<std::promise<void>>();
+    done_ = done->get_future();
+    async_queue::get().push([done, f = remove_cvref_t<F>(THRUST_FWD(f))]() mutable {
+      f();
+      done->set_value();
+    });
+  }
+
+  _CCCL_HOST void join()
+  {
+    if (done_.valid())
+    {
+      done_.wait();
+    }
+  }
+};
+
+} // namespace detail
+
+using unique_eager_event = thrust::detail::host_unique_eager_event<detail::async_task>;
+
+template <typename T>
+using unique_eager_future = thrust::detail::host_unique_eager_future<T, detail::async_task>;
+
+template <typename... Events>
+_CCCL_HOST unique_eager_event when_all(Events&&... evs)
+{
+  return thrust::detail::host_when_all<detail::async_task>(THRUST_FWD(evs)...);
+}
+
+} // namespace omp
+} // namespace system
+
+namespace omp
+{
+
+using thrust::system::omp::unique_eager_event;
+using event = unique_eager_event;
+
+using thrust::system::omp::unique_eager_future;
+template <typename T>
+using future = unique_eager_future<T>;
+
+using thrust::system::omp::when_all;
+
+} // namespace omp
+
+template <typename DerivedPolicy>
+_CCCL_HOST thrust::omp::unique_eager_event
+unique_eager_event_type(thrust::omp::execution_policy<DerivedPolicy> const&) noexcept;
+
+template <typename T, typename DerivedPolicy>
+_CCCL_HOST thrust::omp::unique_eager_future<T>
+unique_eager_future_type(thrust::omp::execution_policy<DerivedPolicy> const&) noexcept;
+
+THRUST_NAMESPACE_END
+
+#endif // C++14
@@ -32,6 +32,7 @@
 #include <thrust/detail/type_traits.h>
 #include <thrust/memory.h>
 #include <thrust/mr/allocator.h>
+#include <thrust/system/cpp/memory.h>
 #include <thrust/system/omp/memory_resource.h>
 
 #include <ostream>
@@ -91,6 +92,22 @@ using universal_allocator = thrust::mr::stateless_resource_allocator<T, thrust::
 template <typename T>
 using universal_host_pinned_allocator =
   thrust::mr::stateless_resource_allocator<T, thrust::system::omp::universal_host_pinned_memory_resource>;
+
+//! \p omp::first_touch_allocator allocates untouched pages, placed by the threads which construct the elements.
+template <typename T>
+using first_touch_allocator =
+  thrust::mr::stateless_resource_allocator<T, thrust::system::omp::first_touch_memory_resource>;
+
+//! \p omp::interleaved_allocator allocates pages spread round-robin over all NUMA nodes.
+template <typename T>
+using interleaved_allocator =
+  thrust::mr::stateless_resource_allocator<T, thrust::system::omp::interleaved_memory_resource>;
+
+// the temporary buffer cache is shared with the cpp system
+using thrust::system::cpp::get_temporary_cache_statistics;
+using thrust::system::cpp::temporary_cache_allocator;
+using thrust::system::cpp::temporary_cache_statistics;
+using thrust::system::cpp::trim_temporary_cache;
 } // namespace omp
 } // namespace system
 
@@ -100,8 +117,14 @@ using universal_host_pinned_allocator =
 namespace omp
 {
 using thrust::system::omp::allocator;
+using thrust::system::omp::first_touch_allocator;
 using thrust::system::omp::free;
+using thrust::system::omp::get_temporary_cache_statistics;
+using thrust::system::omp::interleaved_allocator;
 using thrust::system::omp::malloc;
+using thrust::system::omp::temporary_cache_allocator;
+using thrust::system::omp::temporary_cache_statistics;
+using thrust::system::omp::trim_temporary_cache;
 using thrust::system::omp::universal_allocator;
 using thrust::system::omp::universal_host_pinned_allocator;
 } // namespace omp
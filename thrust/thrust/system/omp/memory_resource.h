@@ -31,6 +31,7 @@
 #endif // no system header
 #include <thrust/mr/fancy_pointer_resource.h>
 #include <thrust/mr/new.h>
+#include <thrust/system/omp/detail/first_touch_resource.h>
 #include <thrust/system/omp/pointer.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -46,6 +47,12 @@ using native_resource = thrust::mr::fancy_pointer_resource<thrust::mr::new_delet
 
 using universal_native_resource =
   thrust::mr::fancy_pointer_resource<thrust::mr::new_delete_resource, thrust::omp::universal_pointer<void>>;
+
+using first_touch_native_resource =
+  thrust::mr::fancy_pointer_resource<page_resource<page_placement::first_touch>, thrust::omp::pointer<void>>;
+
+using interleaved_native_resource =
+  thrust::mr::fancy_pointer_resource<page_resource<page_placement::interleave>, thrust::omp::pointer<void>>;
 } // namespace detail
 //! \endcond
 
@@ -65,6 +72,23 @@ using universal_memory_resource = detail::universal_native_resource;
 // FIXME(bgruber): comment below is wrong or alias should be to universal_memory_resource
 /*! An alias for \p omp::universal_memory_resource. */
 using universal_host_pinned_memory_resource = detail::native_resource;
+/*! A memory resource for the OpenMP system which maps fresh pages from the
+ *  operating system for every allocation. As none of them has been touched
+ *  before, each page is placed on the NUMA node of the thread which first
+ *  writes to it. Containers using it, such as \p omp::first_touch_vector,
+ *  construct their elements in parallel with the decomposition of the OpenMP
+ *  algorithms, so that with threads bound to cores (e.g. \p OMP_PROC_BIND)
+ *  every thread later reads its part of the data from local memory. It is
+ *  meant for large, long-lived allocations, as each one takes whole pages and
+ *  a system call.
+ */
+using first_touch_memory_resource = detail::first_touch_native_resource;
+/*! Like \p omp::first_touch_memory_resource, but spreads the pages of every
+ *  allocation round-robin over all NUMA nodes, which evens out the bandwidth
+ *  of accesses which do not follow the decomposition of the algorithms. On
+ *  systems other than Linux the pages are placed by first touch.
+ */
+using interleaved_memory_resource = detail::interleaved_native_resource;
 
 /*! \}
  */
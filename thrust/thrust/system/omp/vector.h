@@ -84,11 +84,38 @@ using universal_vector = thrust::detail::vector_base<T, Allocator>;
 
 template <typename T>
 using universal_host_pinned_vector = thrust::detail::vector_base<T, universal_host_pinned_allocator<T>>;
+
+/*! \p omp::first_touch_vector is an \p omp::vector whose elements reside in
+ *  pages which are placed on the NUMA node of the thread that first writes to
+ *  them. Its elements are constructed in parallel with the decomposition the
+ *  \p omp system uses for its algorithms, so that, with threads bound to
+ *  cores, they later read their parts of it from local memory.
+ *
+ *  \tparam T The element type of the \p omp::first_touch_vector.
+ *
+ *  \see omp::first_touch_memory_resource
+ *  \see omp::interleaved_vector
+ */
+template <typename T>
+using first_touch_vector = thrust::detail::vector_base<T, first_touch_allocator<T>>;
+
+/*! \p omp::interleaved_vector is an \p omp::vector whose elements reside in
+ *  pages which are spread round-robin over all NUMA nodes.
+ *
+ *  \tparam T The element type of the \p omp::interleaved_vector.
+ *
+ *  \see omp::interleaved_memory_resource
+ *  \see omp::first_touch_vector
+ */
+template <typename T>
+using interleaved_vector = thrust::detail::vector_base<T, interleaved_allocator<T>>;
 } // namespace omp
 } // namespace system
 
 namespace omp
 {
+using thrust::system::omp::first_touch_vector;
+using thrust::system::omp::interleaved_vector;
 using thrust::system::omp::universal_vector;
 using thrust::system::omp::vector;
 } // namespace omp
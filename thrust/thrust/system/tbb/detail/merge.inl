@@ -32,6 +32,9 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/sort_cutoffs.h>
+
+#include <cstddef>
 
 #include <tbb/parallel_for.h>
 
@@ -255,7 +258,7 @@ template <typename DerivedPolicy,
           typename OutputIterator,
           typename StrictWeakOrdering>
 OutputIterator
-merge(execution_policy<DerivedPolicy>&,
+merge(execution_policy<DerivedPolicy>& exec,
       InputIterator1 first1,
       InputIterator1 last1,
       InputIterator2 first2,
@@ -263,9 +266,16 @@ merge(execution_policy<DerivedPolicy>&,
       OutputIterator result,
       StrictWeakOrdering comp)
 {
-  using Range = typename merge_detail::range<InputIterator1, InputIterator2, OutputIterator, StrictWeakOrdering>;
-  using Body  = merge_detail::body;
-  Range range(first1, last1, first2, last2, result, comp);
+  using Range      = typename merge_detail::range<InputIterator1, InputIterator2, OutputIterator, StrictWeakOrdering>;
+  using Body       = merge_detail::body;
+  using value_type = typename thrust::iterator_value<InputIterator1>::type;
+
+  const std::size_t grain_size = merge_grain_size(
+    get_sort_cutoffs(thrust::detail::derived_cast(exec)),
+    thrust::distance(first1, last1) + thrust::distance(first2, last2),
+    sizeof(value_type));
+
+  Range range(first1, last1, first2, last2, result, comp, grain_size);
   Body body;
 
   ::tbb::parallel_for(range, body);
@@ -284,7 +294,7 @@ template <typename DerivedPolicy,
           typename OutputIterator2,
           typename StrictWeakOrdering>
 thrust::pair<OutputIterator1, OutputIterator2> merge_by_key(
-  execution_policy<DerivedPolicy>&,
+  execution_policy<DerivedPolicy>& exec,
   InputIterator1 keys_first1,
   InputIterator1 keys_last1,
   InputIterator2 keys_first2,
@@ -303,10 +313,26 @@ thrust::pair<OutputIterator1, OutputIterator2> merge_by_key(
     OutputIterator1,
     OutputIterator2,
     StrictWeakOrdering>;
-  using Body = merge_by_key_detail::body;
+  using Body       = merge_by_key_detail::body;
+  using key_type   = typename thrust::iterator_value<InputIterator1>::type;
+  using value_type = typename thrust::iterator_value<InputIterator3>::type;
+
+  const std::size_t grain_size = merge_grain_size(
+    get_sort_cutoffs(thrust::detail::derived_cast(exec)),
+    thrust::distance(keys_first1, keys_last1) + thrust::distance(keys_first2, keys_last2),
+    sizeof(key_type) + sizeof(value_type));
 
   Range range(
-    keys_first1, keys_last1, keys_first2, keys_last2, values_first3, values_first4, keys_result, values_result, comp);
+    keys_first1,
+    keys_last1,
+    keys_first2,
+    keys_last2,
+    values_first3,
+    values_first4,
+    keys_result,
+    values_result,
+    comp,
+    grain_size);
   Body body;
 
   ::tbb::parallel_for(range, body);
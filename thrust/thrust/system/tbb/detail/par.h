@@ -26,7 +26,13 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/allocator_aware_execution_policy.h>
+#include <thrust/detail/dependencies_aware_execution_policy.h>
+#include <thrust/detail/execute_with_allocator.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/sort_cutoffs.h>
+
+#include <type_traits>
+#include <utility>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -36,13 +42,92 @@ namespace tbb
 namespace detail
 {
 
+template <typename Derived>
+struct execute_with_sort_cutoffs_base : thrust::system::tbb::detail::execution_policy<Derived>
+{
+private:
+  sort_cutoffs cutoffs;
+
+public:
+  execute_with_sort_cutoffs_base(const sort_cutoffs& cutoffs_ = sort_cutoffs())
+      : cutoffs(cutoffs_)
+  {}
+
+  Derived with_cutoffs(const sort_cutoffs& c) const
+  {
+    Derived result = thrust::detail::derived_cast(*this);
+    result.cutoffs = c;
+    return result;
+  }
+
+private:
+  friend sort_cutoffs get_sort_cutoffs(const execute_with_sort_cutoffs_base& exec)
+  {
+    return exec.cutoffs;
+  }
+};
+
+struct execute_with_sort_cutoffs : execute_with_sort_cutoffs_base<execute_with_sort_cutoffs>
+{
+  using base_t = execute_with_sort_cutoffs_base<execute_with_sort_cutoffs>;
+
+  template <typename Allocator>
+  using execute_with_allocator_type = thrust::detail::execute_with_allocator<Allocator, execute_with_sort_cutoffs_base>;
+
+  execute_with_sort_cutoffs(const sort_cutoffs& cutoffs = sort_cutoffs())
+      : base_t(cutoffs)
+  {}
+
+  // the overloads of thrust::detail::allocator_aware_execution_policy, but the returned policies keep the cutoffs
+
+  template <typename MemoryResource>
+  execute_with_allocator_type<thrust::mr::allocator<thrust::detail::max_align_t, MemoryResource>>
+  operator()(MemoryResource* mem_res) const
+  {
+    return with_allocator<thrust::mr::allocator<thrust::detail::max_align_t, MemoryResource>>(mem_res);
+  }
+
+  template <typename Allocator>
+  execute_with_allocator_type<Allocator&> operator()(Allocator& alloc) const
+  {
+    return with_allocator<Allocator&>(alloc);
+  }
+
+  template <typename Allocator>
+  execute_with_allocator_type<Allocator> operator()(const Allocator& alloc) const
+  {
+    return with_allocator<Allocator>(alloc);
+  }
+
+  template <typename Allocator, typename std::enable_if<!std::is_lvalue_reference<Allocator>::value>::type* = nullptr>
+  execute_with_allocator_type<Allocator> operator()(Allocator&& alloc) const
+  {
+    return with_allocator<Allocator>(std::move(alloc));
+  }
+
+private:
+  template <typename Allocator, typename Arg>
+  execute_with_allocator_type<Allocator> with_allocator(Arg&& arg) const
+  {
+    using result_t = execute_with_allocator_type<Allocator>;
+
+    return result_t(execute_with_sort_cutoffs_base<result_t>(get_sort_cutoffs(*this)), Allocator(std::forward<Arg>(arg)));
+  }
+};
+
 struct par_t
     : thrust::system::tbb::detail::execution_policy<par_t>
-    , thrust::detail::allocator_aware_execution_policy<thrust::system::tbb::detail::execution_policy>
+    , thrust::detail::allocator_aware_execution_policy<execute_with_sort_cutoffs_base>
+    , thrust::detail::dependencies_aware_execution_policy<execute_with_sort_cutoffs_base>
 {
   _CCCL_HOST_DEVICE constexpr par_t()
       : thrust::system::tbb::detail::execution_policy<par_t>()
   {}
+
+  execute_with_sort_cutoffs with_cutoffs(const sort_cutoffs& cutoffs) const
+  {
+    return execute_with_sort_cutoffs(cutoffs);
+  }
 };
 
 } // namespace detail
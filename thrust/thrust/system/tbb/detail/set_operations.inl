@@ -0,0 +1,328 @@
+/*
+ *  Copyright 2025 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+#include <thrust/system/detail/internal/merge_path.h>
+#include <thrust/system/detail/internal/set_operations.h>
+#include <thrust/system/tbb/detail/set_operations.h>
+#include <thrust/system/tbb/detail/sort_cutoffs.h>
+
+#include <cassert>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace set_operations_detail
+{
+
+template <typename L, typename R>
+inline L divide_ri(const L x, const R y)
+{
+  return (x + (y - 1)) / y;
+}
+
+// Locates where an interval of the merged input begins in both inputs, and
+// counts the output the set operation produces for that interval.
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename Size,
+          typename StrictWeakOrdering,
+          typename SetOperation>
+struct count_body
+{
+  InputIterator1 first1;
+  InputIterator2 first2;
+  Size n1, n2, interval_size;
+  thrust::pair<Size, Size>* splits;
+  Size* counts;
+  StrictWeakOrdering comp;
+  SetOperation set_op;
+
+  count_body(InputIterator1 first1,
+             InputIterator2 first2,
+             Size n1,
+             Size n2,
+             Size interval_size,
+             thrust::pair<Size, Size>* splits,
+             Size* counts,
+             StrictWeakOrdering comp,
+             SetOperation set_op)
+      : first1(first1)
+      , first2(first2)
+      , n1(n1)
+      , n2(n2)
+      , interval_size(interval_size)
+      , splits(splits)
+      , counts(counts)
+      , comp(comp)
+      , set_op(set_op)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    assert(r.size() == 1);
+
+    const Size interval_idx = r.begin();
+
+    const Size diag_begin = interval_size * interval_idx;
+    const Size diag_end   = (thrust::min)(n1 + n2, diag_begin + interval_size);
+
+    const thrust::pair<Size, Size> begin =
+      thrust::system::detail::internal::set_operation_path(first1, n1, first2, n2, diag_begin, comp);
+    const thrust::pair<Size, Size> end =
+      thrust::system::detail::internal::set_operation_path(first1, n1, first2, n2, diag_end, comp);
+
+    thrust::discard_iterator<> counter = set_op(
+      first1 + begin.first,
+      first1 + end.first,
+      first2 + begin.second,
+      first2 + end.second,
+      thrust::make_discard_iterator(),
+      comp);
+
+    splits[interval_idx] = begin;
+    counts[interval_idx] = counter - thrust::make_discard_iterator();
+  }
+};
+
+// Applies the set operation to an interval, writing its output at the
+// interval's offset.
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename Size,
+          typename StrictWeakOrdering,
+          typename SetOperation>
+struct apply_body
+{
+  InputIterator1 first1;
+  InputIterator2 first2;
+  OutputIterator result;
+  const thrust::pair<Size, Size>* splits;
+  const Size* offsets;
+  StrictWeakOrdering comp;
+  SetOperation set_op;
+
+  apply_body(InputIterator1 first1,
+             InputIterator2 first2,
+             OutputIterator result,
+             const thrust::pair<Size, Size>* splits,
+             const Size* offsets,
+             StrictWeakOrdering comp,
+             SetOperation set_op)
+      : first1(first1)
+      , first2(first2)
+      , result(result)
+      , splits(splits)
+      , offsets(offsets)
+      , comp(comp)
+      , set_op(set_op)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    assert(r.size() == 1);
+
+    const Size interval_idx = r.begin();
+
+    set_op(first1 + splits[interval_idx].first,
+           first1 + splits[interval_idx + 1].first,
+           first2 + splits[interval_idx].second,
+           first2 + splits[interval_idx + 1].second,
+           result + offsets[interval_idx],
+           comp);
+  }
+};
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering,
+          typename SetOperation>
+OutputIterator set_operation(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp,
+  SetOperation set_op)
+{
+  using Size = typename thrust::iterator_difference<InputIterator1>::type;
+
+  const Size n1 = thrust::distance(first1, last1);
+  const Size n2 = static_cast<Size>(thrust::distance(first2, last2));
+
+  // XXX this value is a tuning opportunity
+  const Size parallelism_threshold = 10000;
+
+  if (n1 + n2 < parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    return set_op(first1, last1, first2, last2, result, comp);
+  }
+
+  // generate several intervals of the merged input per worker of the arena
+  const Size interval_size = thrust::max<Size>(
+    1, static_cast<Size>(thrust::system::tbb::detail::sort_cutoffs_detail::parallel_piece_size(n1 + n2)));
+  const Size num_intervals = divide_ri(n1 + n2, interval_size);
+
+  // splits[i] is where interval i begins in both inputs; counts[i] is the size of its output
+  thrust::detail::temporary_array<thrust::pair<Size, Size>, DerivedPolicy> splits(0, exec, num_intervals + 1);
+  thrust::detail::temporary_array<Size, DerivedPolicy> counts(0, exec, num_intervals + 1);
+
+  thrust::pair<Size, Size>* raw_splits = thrust::raw_pointer_cast(splits.data());
+  Size* raw_counts                     = thrust::raw_pointer_cast(counts.data());
+
+  raw_splits[num_intervals] = thrust::make_pair(n1, n2);
+
+  // force grainsize == 1 with simple_partioner()
+  ::tbb::parallel_for(
+    ::tbb::blocked_range<Size>(0, num_intervals, 1),
+    count_body<InputIterator1, InputIterator2, Size, StrictWeakOrdering, SetOperation>(
+      first1, first2, n1, n2, interval_size, raw_splits, raw_counts, comp, set_op),
+    ::tbb::simple_partitioner());
+
+  // scan the counts to get each interval's output offset
+  Size sum = 0;
+  for (Size i = 0; i < num_intervals; ++i)
+  {
+    Size count    = raw_counts[i];
+    raw_counts[i] = sum;
+    sum += count;
+  }
+  raw_counts[num_intervals] = sum;
+
+  ::tbb::parallel_for(
+    ::tbb::blocked_range<Size>(0, num_intervals, 1),
+    apply_body<InputIterator1, InputIterator2, OutputIterator, Size, StrictWeakOrdering, SetOperation>(
+      first1, first2, result, raw_splits, raw_counts, comp, set_op),
+    ::tbb::simple_partitioner());
+
+  return result + raw_counts[num_intervals];
+}
+
+} // namespace set_operations_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::set_difference_functor());
+} // end set_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_intersection(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::set_intersection_functor());
+} // end set_intersection()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_symmetric_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec,
+    first1,
+    last1,
+    first2,
+    last2,
+    result,
+    comp,
+    thrust::system::detail::internal::set_symmetric_difference_functor());
+} // end set_symmetric_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_union(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::set_union_functor());
+} // end set_union()
+
+} // namespace detail
+} // namespace tbb
+} // namespace system
+THRUST_NAMESPACE_END
@@ -32,7 +32,17 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
 #include <thrust/sort.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/radix_sort.h>
+#include <thrust/system/detail/sequential/sort.h>
+#include <thrust/system/tbb/detail/sort_cutoffs.h>
 
+#include <cassert>
+#include <cstddef>
+#include <thread>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 #include <tbb/parallel_invoke.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -45,16 +55,14 @@ namespace detail
 namespace sort_detail
 {
 
-// TODO tune this based on data type and comp
-const static int threshold = 128 * 1024;
-
 template <typename DerivedPolicy, typename Iterator1, typename Iterator2, typename StrictWeakOrdering>
 void merge_sort(execution_policy<DerivedPolicy>& exec,
                 Iterator1 first1,
                 Iterator1 last1,
                 Iterator2 first2,
                 StrictWeakOrdering comp,
-                bool inplace);
+                bool inplace,
+                std::size_t leaf_size);
 
 template <typename DerivedPolicy, typename Iterator1, typename Iterator2, typename StrictWeakOrdering>
 struct merge_sort_closure
@@ -64,6 +72,7 @@ struct merge_sort_closure
   Iterator2 first2;
   StrictWeakOrdering comp;
   bool inplace;
+  std::size_t leaf_size;
 
   merge_sort_closure(
     execution_policy<DerivedPolicy>& exec,
@@ -71,18 +80,20 @@ struct merge_sort_closure
     Iterator1 last1,
     Iterator2 first2,
     StrictWeakOrdering comp,
-    bool inplace)
+    bool inplace,
+    std::size_t leaf_size)
       : exec(exec)
       , first1(first1)
       , last1(last1)
       , first2(first2)
       , comp(comp)
       , inplace(inplace)
+      , leaf_size(leaf_size)
   {}
 
   void operator()(void) const
   {
-    merge_sort(exec, first1, last1, first2, comp, inplace);
+    merge_sort(exec, first1, last1, first2, comp, inplace, leaf_size);
   }
 };
 
@@ -92,13 +103,14 @@ void merge_sort(execution_policy<DerivedPolicy>& exec,
                 Iterator1 last1,
                 Iterator2 first2,
                 StrictWeakOrdering comp,
-                bool inplace)
+                bool inplace,
+                std::size_t leaf_size)
 {
   using difference_type = typename thrust::iterator_difference<Iterator1>::type;
 
   difference_type n = thrust::distance(first1, last1);
 
-  if (n < threshold)
+  if (static_cast<std::size_t>(n) < leaf_size)
   {
     thrust::stable_sort(thrust::seq, first1, last1, comp);
 
@@ -116,8 +128,8 @@ void merge_sort(execution_policy<DerivedPolicy>& exec,
 
   using Closure = merge_sort_closure<DerivedPolicy, Iterator1, Iterator2, StrictWeakOrdering>;
 
-  Closure left(exec, first1, mid1, first2, comp, !inplace);
-  Closure right(exec, mid1, last1, mid2, comp, !inplace);
+  Closure left(exec, first1, mid1, first2, comp, !inplace, leaf_size);
+  Closure right(exec, mid1, last1, mid2, comp, !inplace, leaf_size);
 
   ::tbb::parallel_invoke(left, right);
 
@@ -136,9 +148,6 @@ void merge_sort(execution_policy<DerivedPolicy>& exec,
 namespace sort_by_key_detail
 {
 
-// TODO tune this based on data type and comp
-const static int threshold = 128 * 1024;
-
 template <typename DerivedPolicy,
           typename Iterator1,
           typename Iterator2,
@@ -153,7 +162,8 @@ void merge_sort_by_key(
   Iterator3 first3,
   Iterator4 first4,
   StrictWeakOrdering comp,
-  bool inplace);
+  bool inplace,
+  std::size_t leaf_size);
 
 template <typename DerivedPolicy,
           typename Iterator1,
@@ -170,6 +180,7 @@ struct merge_sort_by_key_closure
   Iterator4 first4;
   StrictWeakOrdering comp;
   bool inplace;
+  std::size_t leaf_size;
 
   merge_sort_by_key_closure(
     execution_policy<DerivedPolicy>& exec,
@@ -179,7 +190,8 @@ struct merge_sort_by_key_closure
     Iterator3 first3,
     Iterator4 first4,
     StrictWeakOrdering comp,
-    bool inplace)
+    bool inplace,
+    std::size_t leaf_size)
       : exec(exec)
       , first1(first1)
       , last1(last1)
@@ -188,11 +200,12 @@ struct merge_sort_by_key_closure
       , first4(first4)
       , comp(comp)
       , inplace(inplace)
+      , leaf_size(leaf_size)
   {}
 
   void operator()(void) const
   {
-    merge_sort_by_key(exec, first1, last1, first2, first3, first4, comp, inplace);
+    merge_sort_by_key(exec, first1, last1, first2, first3, first4, comp, inplace, leaf_size);
   }
 };
 
@@ -210,7 +223,8 @@ void merge_sort_by_key(
   Iterator3 first3,
   Iterator4 first4,
   StrictWeakOrdering comp,
-  bool inplace)
+  bool inplace,
+  std::size_t leaf_size)
 {
   using difference_type = typename thrust::iterator_difference<Iterator1>::type;
 
@@ -223,7 +237,7 @@ void merge_sort_by_key(
   Iterator2 last2 = first2 + n;
   Iterator3 last3 = first3 + n;
 
-  if (n < threshold)
+  if (static_cast<std::size_t>(n) < leaf_size)
   {
     thrust::stable_sort_by_key(thrust::seq, first1, last1, first2, comp);
 
@@ -239,8 +253,8 @@ void merge_sort_by_key(
   using Closure =
     merge_sort_by_key_closure<DerivedPolicy, Iterator1, Iterator2, Iterator3, Iterator4, StrictWeakOrdering>;
 
-  Closure left(exec, first1, mid1, first2, first3, first4, comp, !inplace);
-  Closure right(exec, mid1, last1, mid2, mid3, mid4, comp, !inplace);
+  Closure left(exec, first1, mid1, first2, first3, first4, comp, !inplace, leaf_size);
+  Closure right(exec, mid1, last1, mid2, mid3, mid4, comp, !inplace, leaf_size);
 
   ::tbb::parallel_invoke(left, right);
 
@@ -256,15 +270,252 @@ void merge_sort_by_key(
 
 } // namespace sort_by_key_detail
 
+namespace radix_sort_detail
+{
+
+using thrust::system::detail::sequential::sort_detail::needs_reverse;
+using thrust::system::detail::sequential::sort_detail::use_primitive_sort;
+
+// counts the digits of every key of a tile
+template <typename Iterator, typename Size, typename Digit>
+struct histogram_body
+{
+  Iterator keys;
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp;
+  Digit digit;
+  std::size_t* histograms;
+
+  histogram_body(Iterator keys,
+                 thrust::system::detail::internal::uniform_decomposition<Size> decomp,
+                 Digit digit,
+                 std::size_t* histograms)
+      : keys(keys)
+      , decomp(decomp)
+      , digit(digit)
+      , histograms(histograms)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    assert(r.size() == 1);
+
+    const Size tile = r.begin();
+
+    thrust::system::detail::internal::radix_histogram(
+      keys + decomp[tile].begin(), decomp[tile].size(), digit, histograms + tile * Digit::num_buckets);
+  }
+};
+
+// scatters every key (and value) of a tile to its offset in the output
+template <bool HasValues,
+          typename Iterator1,
+          typename Iterator2,
+          typename Iterator3,
+          typename Iterator4,
+          typename Size,
+          typename Digit>
+struct scatter_body
+{
+  Iterator1 keys_first;
+  Iterator2 values_first;
+  Iterator3 keys_result;
+  Iterator4 values_result;
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp;
+  Digit digit;
+  std::size_t* offsets;
+
+  scatter_body(Iterator1 keys_first,
+               Iterator2 values_first,
+               Iterator3 keys_result,
+               Iterator4 values_result,
+               thrust::system::detail::internal::uniform_decomposition<Size> decomp,
+               Digit digit,
+               std::size_t* offsets)
+      : keys_first(keys_first)
+      , values_first(values_first)
+      , keys_result(keys_result)
+      , values_result(values_result)
+      , decomp(decomp)
+      , digit(digit)
+      , offsets(offsets)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    assert(r.size() == 1);
+
+    const Size tile  = r.begin();
+    const Size begin = decomp[tile].begin();
+
+    if (HasValues)
+    {
+      thrust::system::detail::internal::radix_scatter(
+        keys_first + begin,
+        values_first + begin,
+        decomp[tile].size(),
+        keys_result,
+        values_result,
+        digit,
+        offsets + tile * Digit::num_buckets);
+    }
+    else
+    {
+      thrust::system::detail::internal::radix_scatter(
+        keys_first + begin, decomp[tile].size(), keys_result, digit, offsets + tile * Digit::num_buckets);
+    }
+  }
+};
+
+template <bool HasValues,
+          typename Iterator1,
+          typename Iterator2,
+          typename Iterator3,
+          typename Iterator4,
+          typename Size,
+          typename Digit>
+void scatter_tiles(
+  Iterator1 keys_first,
+  Iterator2 values_first,
+  Iterator3 keys_result,
+  Iterator4 values_result,
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp,
+  Digit digit,
+  std::size_t* offsets)
+{
+  // force grainsize == 1 with simple_partioner()
+  ::tbb::parallel_for(
+    ::tbb::blocked_range<Size>(0, decomp.size(), 1),
+    scatter_body<HasValues, Iterator1, Iterator2, Iterator3, Iterator4, Size, Digit>(
+      keys_first, values_first, keys_result, values_result, decomp, digit, offsets),
+    ::tbb::simple_partitioner());
+}
+
+template <bool Descending,
+          bool HasValues,
+          typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename Size>
+void radix_sort(execution_policy<DerivedPolicy>& exec, RandomAccessIterator1 keys, RandomAccessIterator2 values, Size n)
+{
+  using key_type   = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  using value_type = typename thrust::iterator_value<RandomAccessIterator2>::type;
+  using digit_type = thrust::system::detail::internal::radix_digit<key_type, Descending>;
+
+  using key_buffer_iterator = typename thrust::detail::temporary_array<key_type, DerivedPolicy>::iterator;
+
+  // count the number of processors
+  const unsigned int p = thrust::max<unsigned int>(1u, std::thread::hardware_concurrency());
+
+  // XXX the number of tiles is a tuning opportunity
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp(n, 1, p);
+
+  // every element of the buffers is written by the first pass that is not skipped
+  thrust::detail::temporary_array<key_type, DerivedPolicy> keys_buffer(thrust::default_init, exec, n);
+  thrust::detail::temporary_array<value_type, DerivedPolicy> values_buffer(
+    thrust::default_init, exec, HasValues ? n : 0);
+
+  // one histogram per tile, stored tile by tile
+  thrust::detail::temporary_array<std::size_t, DerivedPolicy> histograms(
+    0, exec, decomp.size() * digit_type::num_buckets);
+  std::size_t* raw_histograms = thrust::raw_pointer_cast(histograms.data());
+
+  bool in_buffer = false;
+
+  for (unsigned int pass = 0; pass < digit_type::num_passes; pass++)
+  {
+    const digit_type digit(pass);
+
+    // force grainsize == 1 with simple_partioner()
+    if (in_buffer)
+    {
+      ::tbb::parallel_for(::tbb::blocked_range<Size>(0, decomp.size(), 1),
+                          histogram_body<key_buffer_iterator, Size, digit_type>(
+                            keys_buffer.begin(), decomp, digit, raw_histograms),
+                          ::tbb::simple_partitioner());
+    }
+    else
+    {
+      ::tbb::parallel_for(::tbb::blocked_range<Size>(0, decomp.size(), 1),
+                          histogram_body<RandomAccessIterator1, Size, digit_type>(keys, decomp, digit, raw_histograms),
+                          ::tbb::simple_partitioner());
+    }
+
+    // skip the pass if every key shares the same digit
+    if (!thrust::system::detail::internal::radix_scan_histograms<digit_type::num_buckets>(
+          raw_histograms, decomp.size(), static_cast<std::size_t>(n)))
+    {
+      continue;
+    }
+
+    if (in_buffer)
+    {
+      scatter_tiles<HasValues>(keys_buffer.begin(), values_buffer.begin(), keys, values, decomp, digit, raw_histograms);
+    }
+    else
+    {
+      scatter_tiles<HasValues>(keys, values, keys_buffer.begin(), values_buffer.begin(), decomp, digit, raw_histograms);
+    }
+
+    in_buffer = !in_buffer;
+  }
+
+  // ensure the result ends up in the input range
+  if (in_buffer)
+  {
+    thrust::copy(exec, keys_buffer.begin(), keys_buffer.end(), keys);
+
+    if (HasValues)
+    {
+      thrust::copy(exec, values_buffer.begin(), values_buffer.end(), values);
+    }
+  }
+}
+
+} // namespace radix_sort_detail
+
+namespace sort_detail
+{
+
 template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
-void stable_sort(
-  execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
+void stable_sort(execution_policy<DerivedPolicy>& exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp,
+                 thrust::detail::true_type)
+{
+  using key_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  // XXX this value is a tuning opportunity
+  const std::ptrdiff_t parallelism_threshold = 10000;
+
+  if (last - first < parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    thrust::stable_sort(thrust::seq, first, last, comp);
+    return;
+  }
+
+  // radix sort keys in descending order directly to preserve stability
+  radix_sort_detail::radix_sort<radix_sort_detail::needs_reverse<key_type, StrictWeakOrdering>::value, false>(
+    exec, first, static_cast<key_type*>(0), last - first);
+}
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void stable_sort(execution_policy<DerivedPolicy>& exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp,
+                 thrust::detail::false_type)
 {
   using key_type = typename thrust::iterator_value<RandomAccessIterator>::type;
 
   thrust::detail::temporary_array<key_type, DerivedPolicy> temp(exec, first, last);
 
-  sort_detail::merge_sort(exec, first, last, temp.begin(), comp, true);
+  const std::size_t leaf_size = merge_sort_leaf_size(
+    get_sort_cutoffs(thrust::detail::derived_cast(exec)), thrust::distance(first, last), sizeof(key_type));
+
+  sort_detail::merge_sort(exec, first, last, temp.begin(), comp, true, leaf_size);
 }
 
 template <typename DerivedPolicy,
@@ -276,7 +527,36 @@ void stable_sort_by_key(
   RandomAccessIterator1 first1,
   RandomAccessIterator1 last1,
   RandomAccessIterator2 first2,
-  StrictWeakOrdering comp)
+  StrictWeakOrdering comp,
+  thrust::detail::true_type)
+{
+  using key_type = typename thrust::iterator_value<RandomAccessIterator1>::type;
+
+  // XXX this value is a tuning opportunity
+  const std::ptrdiff_t parallelism_threshold = 10000;
+
+  if (last1 - first1 < parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    thrust::stable_sort_by_key(thrust::seq, first1, last1, first2, comp);
+    return;
+  }
+
+  radix_sort_detail::radix_sort<radix_sort_detail::needs_reverse<key_type, StrictWeakOrdering>::value, true>(
+    exec, first1, first2, last1 - first1);
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void stable_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  StrictWeakOrdering comp,
+  thrust::detail::false_type)
 {
   using key_type = typename thrust::iterator_value<RandomAccessIterator1>::type;
   using val_type = typename thrust::iterator_value<RandomAccessIterator2>::type;
@@ -286,7 +566,42 @@ void stable_sort_by_key(
   thrust::detail::temporary_array<key_type, DerivedPolicy> temp1(exec, first1, last1);
   thrust::detail::temporary_array<val_type, DerivedPolicy> temp2(exec, first2, last2);
 
-  sort_by_key_detail::merge_sort_by_key(exec, first1, last1, first2, temp1.begin(), temp2.begin(), comp, true);
+  const std::size_t leaf_size = merge_sort_leaf_size(
+    get_sort_cutoffs(thrust::detail::derived_cast(exec)),
+    thrust::distance(first1, last1),
+    sizeof(key_type) + sizeof(val_type));
+
+  sort_by_key_detail::merge_sort_by_key(
+    exec, first1, last1, first2, temp1.begin(), temp2.begin(), comp, true, leaf_size);
+}
+
+} // end namespace sort_detail
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void stable_sort(
+  execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
+{
+  using key_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  radix_sort_detail::use_primitive_sort<key_type, StrictWeakOrdering> use_primitive_sort;
+  sort_detail::stable_sort(exec, first, last, comp, use_primitive_sort);
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void stable_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  StrictWeakOrdering comp)
+{
+  using key_type = typename thrust::iterator_value<RandomAccessIterator1>::type;
+
+  radix_sort_detail::use_primitive_sort<key_type, StrictWeakOrdering> use_primitive_sort;
+  sort_detail::stable_sort_by_key(exec, first1, last1, first2, comp, use_primitive_sort);
 }
 
 } // end namespace detail
@@ -0,0 +1,172 @@
+/*
+ *  Copyright 2025 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/minmax.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+
+#include <cstddef>
+
+#if defined(__unix__) || defined(__APPLE__)
+#  include <unistd.h>
+#endif
+
+#include <tbb/task_arena.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+
+// Cutoffs of the TBB merge sort and merge, in elements. A cutoff of zero
+// selects a value derived from the element size, the cache sizes of the host
+// and the concurrency of the current task arena.
+struct sort_cutoffs
+{
+  // ranges shorter than this are sorted sequentially
+  std::size_t leaf_size;
+
+  // merges shorter than this are performed sequentially
+  std::size_t merge_grain_size;
+
+  sort_cutoffs(std::size_t leaf_size = 0, std::size_t merge_grain_size = 0)
+      : leaf_size(leaf_size)
+      , merge_grain_size(merge_grain_size)
+  {}
+};
+
+// policies which do not carry cutoffs use the derived ones
+template <typename DerivedPolicy>
+sort_cutoffs get_sort_cutoffs(const execution_policy<DerivedPolicy>&)
+{
+  return sort_cutoffs();
+}
+
+namespace sort_cutoffs_detail
+{
+
+struct cache_sizes
+{
+  std::size_t l1;
+  std::size_t l2;
+};
+
+inline std::size_t query_cache_size(int name, std::size_t fallback)
+{
+#if defined(__unix__) || defined(__APPLE__)
+  const long size = ::sysconf(name);
+
+  return size > 0 ? static_cast<std::size_t>(size) : fallback;
+#else
+  (void) name;
+
+  return fallback;
+#endif
+}
+
+inline cache_sizes detect_cache_sizes()
+{
+  // XXX these fallbacks are a tuning opportunity
+  cache_sizes result = {32 * 1024, 1024 * 1024};
+
+#if defined(_SC_LEVEL1_DCACHE_SIZE)
+  result.l1 = query_cache_size(_SC_LEVEL1_DCACHE_SIZE, result.l1);
+#endif
+#if defined(_SC_LEVEL2_CACHE_SIZE)
+  result.l2 = query_cache_size(_SC_LEVEL2_CACHE_SIZE, result.l2);
+#endif
+
+  return result;
+}
+
+inline const cache_sizes& host_cache_sizes()
+{
+  static const cache_sizes sizes = detect_cache_sizes();
+
+  return sizes;
+}
+
+// the largest piece of n elements which still leaves every worker of the arena several pieces
+inline std::size_t parallel_piece_size(std::size_t n)
+{
+  // XXX oversubscribing is a tuning opportunity
+  const std::size_t subscription_rate = 4;
+  const std::size_t concurrency       = thrust::max<std::size_t>(1, ::tbb::this_task_arena::max_concurrency());
+
+  return n / (subscription_rate * concurrency);
+}
+
+} // namespace sort_cutoffs_detail
+
+// number of elements below which merge sort sorts n elements of element_size bytes sequentially
+inline std::size_t merge_sort_leaf_size(const sort_cutoffs& cutoffs, std::size_t n, std::size_t element_size)
+{
+  if (cutoffs.leaf_size > 0)
+  {
+    return cutoffs.leaf_size;
+  }
+
+  // a leaf and the matching part of the merge buffer should stay in the L2 cache
+  const std::size_t cache_leaf_size = sort_cutoffs_detail::host_cache_sizes().l2 / (2 * element_size);
+
+  const std::size_t min_leaf_size = 512;
+
+  return thrust::max(min_leaf_size, thrust::min(cache_leaf_size, sort_cutoffs_detail::parallel_piece_size(n)));
+}
+
+// number of elements below which a merge of n elements of element_size bytes is performed sequentially
+inline std::size_t merge_grain_size(const sort_cutoffs& cutoffs, std::size_t n, std::size_t element_size)
+{
+  if (cutoffs.merge_grain_size > 0)
+  {
+    return cutoffs.merge_grain_size;
+  }
+
+  // every sequential merge should produce about an L1 cache's worth of output
+  const std::size_t cache_grain_size = sort_cutoffs_detail::host_cache_sizes().l1 / element_size;
+
+  const std::size_t min_grain_size = 256;
+
+  return thrust::max(min_grain_size, thrust::min(cache_grain_size, sort_cutoffs_detail::parallel_piece_size(n)));
+}
+
+} // namespace detail
+
+using thrust::system::tbb::detail::sort_cutoffs;
+
+} // namespace tbb
+} // namespace system
+
+namespace tbb
+{
+
+using thrust::system::tbb::sort_cutoffs;
+
+} // namespace tbb
+THRUST_NAMESPACE_END
@@ -80,6 +80,16 @@
 #include <thrust/system/tbb/detail/unique.h>
 #include <thrust/system/tbb/detail/unique_by_key.h>
 
+// and the asynchronous ones, which require C++14
+#if _CCCL_STD_VER >= 2014
+#  include <thrust/system/tbb/detail/async/copy.h>
+#  include <thrust/system/tbb/detail/async/for_each.h>
+#  include <thrust/system/tbb/detail/async/reduce.h>
+#  include <thrust/system/tbb/detail/async/scan.h>
+#  include <thrust/system/tbb/detail/async/sort.h>
+#  include <thrust/system/tbb/detail/async/transform.h>
+#endif // C++14
+
 // define these entities here for the purpose of Doxygenating them
 // they are actually defined elsewhere
 #if 0
@@ -150,6 +160,31 @@ struct tag : thrust::system::tbb::execution_policy<tag> { unspecified };
 static const unspecified par;
 
 
+/*! \p thrust::tbb::sort_cutoffs holds the problem sizes, in elements, below which the merge sort and
+ *  merge of Thrust's TBB backend system stop splitting work into parallel tasks.
+ *
+ *  A cutoff of zero, the default, selects a value derived from the size of the elements, the cache
+ *  sizes of the host and the concurrency of the current TBB task arena.
+ *
+ *  Cutoffs apply to a single algorithm invocation through \p thrust::tbb::par.with_cutoffs:
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  #include <thrust/system/tbb/execution_policy.h>
+ *  ...
+ *  // sort ranges of fewer than 4096 records sequentially
+ *  thrust::sort(thrust::tbb::par.with_cutoffs(thrust::tbb::sort_cutoffs(4096)), vec.begin(), vec.end(), comp);
+ *  \endcode
+ */
+struct sort_cutoffs
+{
+  std::size_t leaf_size;
+  std::size_t merge_grain_size;
+
+  sort_cutoffs(std::size_t leaf_size = 0, std::size_t merge_grain_size = 0);
+};
+
+
 /*! \}
  */
 
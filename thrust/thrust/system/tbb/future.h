@@ -0,0 +1,111 @@
+/*
+ *  Copyright 2025 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file thrust/system/tbb/future.h
+ *  \brief `thrust::event` and `thrust::future` of the TBB system.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cpp14_required.h>
+
+#if _CCCL_STD_VER >= 2014
+
+#  include <thrust/detail/host_async.h>
+#  include <thrust/system/tbb/detail/execution_policy.h>
+
+#  include <tbb/task_arena.h>
+#  include <tbb/task_group.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+
+// An asynchronous operation runs as a task of a task group of its own. The task
+// is enqueued rather than spawned, since a spawned task only makes progress
+// without a waiter when the arena has worker threads.
+class async_task
+{
+  ::tbb::task_group group_;
+
+public:
+  template <typename F>
+  _CCCL_HOST void run(F&& f)
+  {
+    ::tbb::this_task_arena::enqueue(group_.defer(THRUST_FWD(f)));
+  }
+
+  _CCCL_HOST void join()
+  {
+    group_.wait();
+  }
+};
+
+} // namespace detail
+
+using unique_eager_event = thrust::detail::host_unique_eager_event<detail::async_task>;
+
+template <typename T>
+using unique_eager_future = thrust::detail::host_unique_eager_future<T, detail::async_task>;
+
+template <typename... Events>
+_CCCL_HOST unique_eager_event when_all(Events&&... evs)
+{
+  return thrust::detail::host_when_all<detail::async_task>(THRUST_FWD(evs)...);
+}
+
+} // namespace tbb
+} // namespace system
+
+namespace tbb
+{
+
+using thrust::system::tbb::unique_eager_event;
+using event = unique_eager_event;
+
+using thrust::system::tbb::unique_eager_future;
+template <typename T>
+using future = unique_eager_future<T>;
+
+using thrust::system::tbb::when_all;
+
+} // namespace tbb
+
+template <typename DerivedPolicy>
+_CCCL_HOST thrust::tbb::unique_eager_event
+unique_eager_event_type(thrust::tbb::execution_policy<DerivedPolicy> const&) noexcept;
+
+template <typename T, typename DerivedPolicy>
+_CCCL_HOST thrust::tbb::unique_eager_future<T>
+unique_eager_future_type(thrust::tbb::execution_policy<DerivedPolicy> const&) noexcept;
+
+THRUST_NAMESPACE_END
+
+#endif // C++14
@@ -32,6 +32,7 @@
 #include <thrust/detail/type_traits.h>
 #include <thrust/memory.h>
 #include <thrust/mr/allocator.h>
+#include <thrust/system/cpp/memory.h>
 #include <thrust/system/tbb/memory_resource.h>
 
 #include <ostream>
@@ -91,6 +92,12 @@ using universal_allocator = thrust::mr::stateless_resource_allocator<T, thrust::
 template <typename T>
 using universal_host_pinned_allocator =
   thrust::mr::stateless_resource_allocator<T, thrust::system::tbb::universal_host_pinned_memory_resource>;
+
+// the temporary buffer cache is shared with the cpp system
+using thrust::system::cpp::get_temporary_cache_statistics;
+using thrust::system::cpp::temporary_cache_allocator;
+using thrust::system::cpp::temporary_cache_statistics;
+using thrust::system::cpp::trim_temporary_cache;
 } // namespace tbb
 } // namespace system
 
@@ -101,7 +108,11 @@ namespace tbb
 {
 using thrust::system::tbb::allocator;
 using thrust::system::tbb::free;
+using thrust::system::tbb::get_temporary_cache_statistics;
 using thrust::system::tbb::malloc;
+using thrust::system::tbb::temporary_cache_allocator;
+using thrust::system::tbb::temporary_cache_statistics;
+using thrust::system::tbb::trim_temporary_cache;
 using thrust::system::tbb::universal_allocator;
 using thrust::system::tbb::universal_host_pinned_allocator;
 } // namespace tbb